@@ -47,22 +47,27 @@ ProxyAction *AppCommand::GetProxyAction()
 
 void AppCommand::SetCurrentContext(const AppContext &current_context)
 {
-  SetContextStack({current_context});
+  (void)SetContextStack({current_context});
 }
 
-void AppCommand::SetContextStack(const std::vector<AppContext> &context_stack)
+bool AppCommand::SetContextStack(const std::vector<AppContext> &context_stack)
 {
-  for (const auto &current_context : context_stack)
+  auto action = GetActionForContextStack(context_stack);
+  if (action == m_proxy_action->GetAction())
   {
-    if (auto action = GetActionForContext(current_context); action)
-    {
-      m_proxy_action->SetAction(action, ProxyAction::Options::SyncEnabledStatus);
-      return;
-    }
+    return false;
   }
 
-  m_proxy_action->SetAction(nullptr);
-  m_proxy_action->setText(m_default_text);
+  if (action)
+  {
+    m_proxy_action->SetAction(action, ProxyAction::Options::SyncEnabledStatus);
+  }
+  else
+  {
+    m_proxy_action->SetAction(nullptr);
+    m_proxy_action->setText(m_default_text);
+  }
+  return true;
 }
 
 void AppCommand::AddOverrideAction(const AppContext &context, QAction *action)
@@ -101,4 +106,21 @@ QAction *AppCommand::GetActionForContext(const AppContext &context) const
   return iter == m_context_to_action.end() ? nullptr : iter->second;
 }
 
+QAction *AppCommand::GetActionForContextStack(const std::vector<AppContext> &context_stack) const
+{
+  if (m_context_to_action.empty())
+  {
+    return nullptr;
+  }
+
+  for (const auto &current_context : context_stack)
+  {
+    if (auto action = GetActionForContext(current_context); action)
+    {
+      return action;
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace sup::gui
@@ -75,9 +75,12 @@ public:
    * @brief Sets the context to serve.
    *
    * Will run through all given contexts and try to set proxy action for the first matching context.
-   * If no matching action exists, will disable proxy action.
+   * If no matching action exists, will disable proxy action. Proxy action is left untouched, if
+   * the matching action is the same as before.
+   *
+   * @return True if proxy action has been rebound to another action.
    */
-  void SetContextStack(const std::vector<AppContext>& context_stack);
+  bool SetContextStack(const std::vector<AppContext>& context_stack);
 
   /**
    * @brief Append action to the map of actions.
@@ -107,6 +110,11 @@ public:
    */
   QAction* GetActionForContext(const AppContext& context) const;
 
+  /**
+   * @brief Returns action registered for the first matching context in the stack.
+   */
+  QAction* GetActionForContextStack(const std::vector<AppContext>& context_stack) const;
+
 private:
   std::unique_ptr<ProxyAction> m_proxy_action;
   std::map<AppContext, QAction*> m_context_to_action;
@@ -41,6 +41,7 @@ AppCommand *AppCommandManager::RegisterCommand(const QString &command_id,
   auto command = std::make_unique<AppCommand>(command_text);
   auto command_ptr = command.get();
   (void)m_commands.insert({command_id, std::move(command)});
+  m_is_context_stack_dirty = true;
   return command_ptr;
 }
 
@@ -51,6 +52,7 @@ AppCommand *AppCommandManager::RegisterAction(QAction *action, const QString &co
   Q_ASSERT(command);
 
   command->AddOverrideAction(context, action);
+  m_is_context_stack_dirty = true;
   return command;
 }
 
@@ -67,18 +69,28 @@ std::size_t AppCommandManager::GetCommandCount() const
 
 void AppCommandManager::SetCurrentContext(const AppContext &context)
 {
-  for (const auto &[command_id, command] : m_commands)
-  {
-    command->SetCurrentContext(context);
-  }
+  (void)SetContextStack({context});
 }
 
-void AppCommandManager::SetContextStack(const std::vector<AppContext> &context_stack)
+std::size_t AppCommandManager::SetContextStack(const std::vector<AppContext> &context_stack)
 {
+  if (!m_is_context_stack_dirty && context_stack == m_context_stack)
+  {
+    return 0;
+  }
+
+  std::size_t result{0};
   for (const auto &[command_id, command] : m_commands)
   {
-    command->SetContextStack(context_stack);
+    if (command->SetContextStack(context_stack))
+    {
+      ++result;
+    }
   }
+
+  m_context_stack = context_stack;
+  m_is_context_stack_dirty = false;
+  return result;
 }
 
 }  // namespace sup::gui
@@ -21,6 +21,8 @@
 #ifndef SUP_GUI_APP_APP_COMMAND_MANAGER_H_
 #define SUP_GUI_APP_APP_COMMAND_MANAGER_H_
 
+#include <sup/gui/app/app_context.h>
+
 #include <QString>
 #include <map>
 #include <memory>
@@ -32,7 +34,6 @@ namespace sup::gui
 {
 
 class AppCommand;
-class AppContext;
 
 /**
  * @brief The AppCommandManager class holds a collection of commands that can be triggered either
@@ -96,12 +97,23 @@ public:
 
   /**
    * @brief Sets the given context stack for all registered commands.
+   *
+   * Does nothing if the stack is the same as before, and no actions were registered since then.
+   * Otherwise, only commands whose bound action changes will update their proxy actions.
+   *
+   * @return The number of commands that were rebound to another action.
    */
-  void SetContextStack(const std::vector<AppContext>& context_stack);
+  std::size_t SetContextStack(const std::vector<AppContext>& context_stack);
 
 private:
   //!< correspondence of the command_id to commands
   std::map<QString, std::unique_ptr<AppCommand>> m_commands;
+
+  //!< the last applied context stack
+  std::vector<AppContext> m_context_stack;
+
+  //!< true if the last applied context stack might be outdated
+  bool m_is_context_stack_dirty{true};
 };
 
 }  // namespace sup::gui
@@ -55,26 +55,15 @@ void AppContextFocusController::OnFocusWidgetUpdate(QWidget *old, QWidget *now)
     return;
   }
 
-  std::vector<sup::gui::AppContext> context_summary;
+  const auto context_summary = m_context_manager.GetContextStack(now);
 
   if (kPrintDebugMessages)
   {
     qDebug() << "==============================================================================";
-  }
-
-  auto current = now;
-  while (current)
-  {
-    if (kPrintDebugMessages)
+    for (auto current = now; current; current = current->parentWidget())
     {
       qDebug() << current->metaObject()->className();
     }
-
-    if (m_context_manager.HasContext(current))
-    {
-      context_summary.push_back(m_context_manager.GetContext(current));
-    }
-    current = current->parentWidget();
   }
 
   m_command_manager.SetContextStack(context_summary);
@@ -38,6 +38,9 @@ class AppContextManager;
  * It shall be connected with the main window and listen for focusChanged signals. It uses
  * AppContextManager to find a list of active contexts, and AppCommandManager manager to
  * enable/disable all registered commands according to the contexts.
+ *
+ * Context stacks of widgets are cached by AppContextManager, and AppCommandManager updates only
+ * commands whose bound action changes, so moving focus within the same context is cheap.
  */
 class AppContextFocusController : public QObject
 {
@@ -31,6 +31,36 @@
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Maximum number of widgets with cached context stack.
+ *
+ * The cache is keyed by widget pointers and doesn't track widget's deletion. It is cleared when
+ * the limit is reached to avoid unbounded growth.
+ */
+const std::size_t kMaxContextStackCacheSize = 512;
+
+/**
+ * @brief Checks if the parent chain of the widget coincides with the given chain.
+ */
+bool HasSameAncestors(const QWidget *widget, const std::vector<const QWidget *> &ancestors)
+{
+  auto current = widget->parentWidget();
+  for (auto ancestor : ancestors)
+  {
+    if (current != ancestor)
+    {
+      return false;
+    }
+    current = current->parentWidget();
+  }
+  return current == nullptr;
+}
+
+}  // namespace
+
 AppContext AppContextManager::RegisterWidgetUniqueId(const QWidget *widget)
 {
   auto iter = m_widget_to_context.find(widget);
@@ -44,6 +74,7 @@ AppContext AppContextManager::RegisterWidgetUniqueId(const QWidget *widget)
 
   AppContext context(unique_id, context_name);
   (void)m_widget_to_context.insert(iter, {widget, context});
+  m_context_stack_cache.clear();
   return context;
 }
 
@@ -56,6 +87,7 @@ void AppContextManager::UnregisterWidgetUniqueId(const QWidget *widget)
   }
 
   (void)m_widget_to_context.erase(iter);
+  m_context_stack_cache.clear();
 }
 
 AppContext AppContextManager::GetContext(const QWidget *widget) const
@@ -83,4 +115,50 @@ std::size_t AppContextManager::GetNumberOfRegistrations() const
   return m_widget_to_context.size();
 }
 
+std::vector<AppContext> AppContextManager::GetContextStack(const QWidget *widget) const
+{
+  if (!widget)
+  {
+    return {};
+  }
+
+  auto iter = m_context_stack_cache.find(widget);
+  if (iter != m_context_stack_cache.end() && HasSameAncestors(widget, iter->second.ancestors))
+  {
+    return iter->second.context_stack;
+  }
+
+  if (m_context_stack_cache.size() >= kMaxContextStackCacheSize)
+  {
+    m_context_stack_cache.clear();
+  }
+
+  auto entry = CreateContextStackEntry(widget);
+  auto result = entry.context_stack;
+  m_context_stack_cache[widget] = std::move(entry);
+  return result;
+}
+
+AppContextManager::ContextStackEntry AppContextManager::CreateContextStackEntry(
+    const QWidget *widget) const
+{
+  ContextStackEntry result;
+
+  auto current = widget;
+  while (current)
+  {
+    if (auto iter = m_widget_to_context.find(current); iter != m_widget_to_context.end())
+    {
+      result.context_stack.push_back(iter->second);
+    }
+    current = current->parentWidget();
+    if (current)
+    {
+      result.ancestors.push_back(current);
+    }
+  }
+
+  return result;
+}
+
 }  // namespace sup::gui
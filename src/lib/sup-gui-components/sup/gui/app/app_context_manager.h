@@ -21,17 +21,21 @@
 #ifndef SUP_GUI_APP_APP_CONTEXT_MANAGER_H_
 #define SUP_GUI_APP_APP_CONTEXT_MANAGER_H_
 
+#include <sup/gui/app/app_context.h>
+
 #include <map>
+#include <vector>
 
 class QWidget;
 
 namespace sup::gui
 {
 
-class AppContext;
-
 /**
  * @brief The AppContextManager class stores correspondence of focus widgets to context.
+ *
+ * The context stack of a widget, i.e. contexts of the widget itself and all its parents, is cached
+ * to make focus changes cheap. The cache is invalidated on any registration change.
  */
 class AppContextManager
 {
@@ -75,8 +79,29 @@ public:
    */
   std::size_t GetNumberOfRegistrations() const;
 
+  /**
+   * @brief Returns contexts of the given widget and of all its parents.
+   *
+   * The context of the widget itself, if registered, goes first, followed by contexts of parents
+   * up to the top-level widget. Results are cached, a cached stack is reused as long as the chain
+   * of widget's parents remains the same.
+   */
+  std::vector<AppContext> GetContextStack(const QWidget* widget) const;
+
 private:
+  struct ContextStackEntry
+  {
+    std::vector<const QWidget*> ancestors;  //!< the chain of parents at the moment of caching
+    std::vector<AppContext> context_stack;
+  };
+
+  /**
+   * @brief Walks through the widget's parent chain and collects contexts.
+   */
+  ContextStackEntry CreateContextStackEntry(const QWidget* widget) const;
+
   std::map<const QWidget*, AppContext> m_widget_to_context;
+  mutable std::map<const QWidget*, ContextStackEntry> m_context_stack_cache;
 };
 
 }  // namespace sup::gui
@@ -21,6 +21,7 @@
 #include "anyvalue_editor_action_handler.h"
 
 #include "anyvalue_editor_helper.h"
+#include "anyvalue_file_tasks.h"
 #include "anyvalue_item_copy_helper.h"
 #include "item_filter_helper.h"
 #include "mime_conversion_helper.h"
@@ -31,6 +32,8 @@
 #include <sup/gui/model/anyvalue_item.h>
 #include <sup/gui/model/anyvalue_item_utils.h>
 #include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
 
 #include <mvvm/commands/i_command_stack.h>
 #include <mvvm/model/i_session_model.h>
@@ -155,15 +158,63 @@ void AnyValueEditorActionHandler::RemoveSelected()
 }
 
 void AnyValueEditorActionHandler::OnImportFromFileRequest(const std::string& file_name)
+{
+  auto task = CreateImportTask(file_name);
+  if (!task)
+  {
+    return;
+  }
+
+  TaskContext context{CancellationToken{}};
+  task->Run(context);
+
+  if (!task->GetErrorMessage().empty())
+  {
+    SendMessage("Can't import AnyValue from file", "Exception was thrown",
+                task->GetErrorMessage());
+    return;
+  }
+
+  InsertImportedItem(task->TakeItem());
+}
+
+void AnyValueEditorActionHandler::OnExportToFileRequest(const std::string& file_name)
+{
+  auto task = CreateExportTask(file_name);
+  if (!task)
+  {
+    return;
+  }
+
+  TaskContext context{CancellationToken{}};
+  task->Run(context);
+
+  if (!task->GetErrorMessage().empty())
+  {
+    SendMessage("Can't save AnyValue to file", "Exception was thrown", task->GetErrorMessage());
+  }
+}
+
+std::unique_ptr<ImportAnyValueTask> AnyValueEditorActionHandler::CreateImportTask(
+    const std::string& file_name)
 {
   if (!GetSelectedItem() && GetTopItem())
   {
     SendMessage("Please select an item where you want to add a field");
-    return;
+    return {};
   }
 
-  auto anyvalue = AnyValueFromJSONFile(file_name);
-  auto item = CreateAnyValueItem(anyvalue);
+  return std::make_unique<ImportAnyValueTask>(file_name);
+}
+
+void AnyValueEditorActionHandler::InsertImportedItem(std::unique_ptr<AnyValueItem> item)
+{
+  if (!item)
+  {
+    throw NullArgumentException("Imported item is not initialised");
+  }
+
+  // selection might have changed while the import was running
   if (auto query =
           mvvm::utils::CanInsertItem(item.get(), GetParentToInsert(), mvvm::TagIndex::Append());
       !query.first)
@@ -174,24 +225,26 @@ void AnyValueEditorActionHandler::OnImportFromFileRequest(const std::string& fil
   (void)GetModel()->InsertItem(std::move(item), GetParentToInsert(), mvvm::TagIndex::Append());
 }
 
-void AnyValueEditorActionHandler::OnExportToFileRequest(const std::string& file_name)
+std::unique_ptr<ExportAnyValueTask> AnyValueEditorActionHandler::CreateExportTask(
+    const std::string& file_name)
 {
   if (!GetTopItem())
   {
     SendMessage("Nothing to save");
-    return;
+    return {};
   }
 
   try
   {
-    auto anyvalue = CreateAnyValue(*GetTopItem());
-    sup::dto::AnyValueToJSONFile(anyvalue, file_name, /*pretty*/ true);
+    return std::make_unique<ExportAnyValueTask>(CreateAnyValue(*GetTopItem()), file_name);
   }
   catch (const std::exception& ex)
   {
     SendMessage("Can't generate valid JSON presentation from current item", "Exception was thrown",
                 ex.what());
   }
+
+  return {};
 }
 
 void AnyValueEditorActionHandler::MoveUp()
@@ -398,7 +451,7 @@ void AnyValueEditorActionHandler::InsertAfterCurrentSelection(
 
   auto parent_item = selected_item ? selected_item->GetParent() : GetAnyValueItemContainer();
   auto tagindex = selected_item ? selected_item->GetTagIndex().Next() : mvvm::TagIndex::Append();
-  InsertItem(std::move(items), parent_item, tagindex);
+  (void)InsertItems(std::move(items), parent_item, tagindex);
 }
 
 void AnyValueEditorActionHandler::InsertIntoCurrentSelection(
@@ -406,7 +459,7 @@ void AnyValueEditorActionHandler::InsertIntoCurrentSelection(
 {
   if (auto parent_item = GetParentToInsert(); parent_item)
   {
-    InsertItem(std::move(items), parent_item, mvvm::TagIndex::Append());
+    (void)InsertItems(std::move(items), parent_item, mvvm::TagIndex::Append());
   }
 }
 
@@ -489,9 +542,9 @@ QueryResult AnyValueEditorActionHandler::CanInsertTypeIntoCurrentSelection(
   return QueryResult::Success();
 }
 
-void AnyValueEditorActionHandler::InsertItem(std::vector<std::unique_ptr<mvvm::SessionItem>> items,
-                                             mvvm::SessionItem* parent_item,
-                                             const mvvm::TagIndex& index)
+std::vector<mvvm::SessionItem*> AnyValueEditorActionHandler::InsertItems(
+    std::vector<std::unique_ptr<mvvm::SessionItem>> items, mvvm::SessionItem* parent_item,
+    const mvvm::TagIndex& index)
 {
   if (!GetModel())
   {
@@ -506,19 +559,20 @@ void AnyValueEditorActionHandler::InsertItem(std::vector<std::unique_ptr<mvvm::S
   mvvm::utils::BeginMacro(*GetModel(), "Insert AnyValueItem");
 
   auto last_tag_index = index;
-  std::vector<mvvm::SessionItem*> to_notify;
+  std::vector<mvvm::SessionItem*> result;
+  result.reserve(items.size());
 
   for (auto& item : items)
   {
     const auto item_type = item->GetType();
     try
     {
+      // item is still outside of the model, its appearance is updated without model events
       UpdateChildAppearance(*parent_item, *item);
 
       auto inserted = GetModel()->InsertItem(std::move(item), parent_item, last_tag_index);
-      to_notify.push_back(inserted);
+      result.push_back(inserted);
       last_tag_index = inserted->GetTagIndex().Next();
-      UpdateArrayElementNames(*parent_item);
     }
     catch (const std::exception& ex)
     {
@@ -529,12 +583,17 @@ void AnyValueEditorActionHandler::InsertItem(std::vector<std::unique_ptr<mvvm::S
     }
   }
 
+  // renaming of elements once per batch, instead of once per inserted element
+  UpdateArrayElementNames(*parent_item);
+
   mvvm::utils::EndMacro(*GetModel());
 
-  for (auto item : to_notify)
+  for (auto item : result)
   {
     RequestNotify(item);
   }
+
+  return result;
 }
 
 const QMimeData* AnyValueEditorActionHandler::GetClipboardContent() const
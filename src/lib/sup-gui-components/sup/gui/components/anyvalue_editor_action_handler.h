@@ -31,6 +31,9 @@ class QMimeData;
 namespace sup::gui
 {
 
+class ImportAnyValueTask;
+class ExportAnyValueTask;
+
 class QueryResult;
 
 /**
@@ -71,6 +74,45 @@ public:
 
   void OnExportToFileRequest(const std::string& file_name) override;
 
+  /**
+   * @brief Creates a task to import AnyValue from JSON file in a background thread.
+   *
+   * Validates current selection first. If import into the current selection is not possible,
+   * will send a message and return nullptr.
+   */
+  std::unique_ptr<ImportAnyValueTask> CreateImportTask(const std::string& file_name);
+
+  /**
+   * @brief Inserts the item built by the import task into the current selection as a single
+   * model operation.
+   *
+   * Will send a message if the insertion is not possible.
+   */
+  void InsertImportedItem(std::unique_ptr<AnyValueItem> item);
+
+  /**
+   * @brief Creates a task to export top-level AnyValue to JSON file in a background thread.
+   *
+   * AnyValue is created from the top-level item right away, so later editing doesn't affect the
+   * export. If there is nothing to export, will send a message and return nullptr.
+   */
+  std::unique_ptr<ExportAnyValueTask> CreateExportTask(const std::string& file_name);
+
+  /**
+   * @brief Inserts fully built subtrees into the parent, starting from the given index.
+   *
+   * All insertions form a single undo command. Appearance of items is adjusted before they enter
+   * the model, array element names are updated once for the whole batch. Items which can't be
+   * inserted are reported with a message, the rest of the batch is inserted.
+   *
+   * Every item is still inserted on its own, so the model reports one insertion per item.
+   *
+   * @return Items inserted in the model.
+   */
+  std::vector<mvvm::SessionItem*> InsertItems(std::vector<std::unique_ptr<mvvm::SessionItem>> items,
+                                              mvvm::SessionItem* parent_item,
+                                              const mvvm::TagIndex& index);
+
   void MoveUp() override;
 
   void MoveDown() override;
@@ -131,9 +173,6 @@ private:
 
   QueryResult CanInsertTypeIntoCurrentSelection(const std::string& item_type) const;
 
-  void InsertItem(std::vector<std::unique_ptr<mvvm::SessionItem>> items,
-                                mvvm::SessionItem* parent_item, const mvvm::TagIndex& index);
-
   const QMimeData* GetClipboardContent() const;
 
   AnyValueEditorContext m_context;
@@ -116,7 +116,7 @@ void UpdateArrayElementNames(const mvvm::SessionItem& parent)
   if (auto array_item = dynamic_cast<const AnyValueArrayItem*>(&parent); array_item)
   {
     std::uint32_t index{0};
-    for (auto child : array_item->GetChildren())
+    for (auto child : array_item->GetChildRange())
     {
       const auto name = sup::gui::constants::kElementNamePrefix + std::to_string(index++);
       child->SetDisplayName(name);
@@ -0,0 +1,268 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "anyvalue_file_tasks.h"
+
+#include <sup/gui/core/json_validator.h>
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_item_constants.h>
+#include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/model/item_arena.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The size of a chunk to read or write between cancellation checks.
+ */
+const std::size_t kChunkSize = 1024 * 1024;
+
+/**
+ * @brief Maximum length of exception details in the error message.
+ */
+const std::size_t kMaxDetailsLength = 512;
+
+/**
+ * @brief Progress of the import after the file was read.
+ */
+const int kImportReadProgress = 40;
+
+/**
+ * @brief Progress of the import after the content was parsed.
+ */
+const int kImportParseProgress = 70;
+
+/**
+ * @brief Progress of the export after the value was serialized.
+ */
+const int kExportSerializeProgress = 30;
+
+/**
+ * @brief Returns error message containing the beginning of exception details.
+ *
+ * Parser exceptions might contain the whole content of a huge file.
+ */
+std::string CreateErrorMessage(const std::string& text, const std::exception& ex)
+{
+  std::string details(ex.what());
+  if (details.size() > kMaxDetailsLength)
+  {
+    details = details.substr(0, kMaxDetailsLength) + "...";
+  }
+  return text + ": " + details;
+}
+
+/**
+ * @brief Returns progress value for the given number of processed bytes, scaled to the range.
+ */
+int GetProgress(std::size_t processed, std::size_t total, int first, int last)
+{
+  if (total == 0)
+  {
+    return last;
+  }
+  return first + static_cast<int>(static_cast<double>(processed) / total * (last - first));
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// ImportAnyValueTask
+// ----------------------------------------------------------------------------
+
+ImportAnyValueTask::ImportAnyValueTask(std::string file_name) : m_file_name(std::move(file_name))
+{
+}
+
+ImportAnyValueTask::~ImportAnyValueTask() = default;
+
+void ImportAnyValueTask::Run(TaskContext& context)
+{
+  // reading and validating JSON syntax on the fly, so broken files are rejected before any parsing
+  std::ifstream input(m_file_name, std::ios::binary | std::ios::ate);
+  if (!input)
+  {
+    m_error_message = "Can't open file '" + m_file_name + "'";
+    return;
+  }
+
+  const auto file_size = static_cast<std::size_t>(input.tellg());
+  input.seekg(0);
+  std::string content(file_size, '\0');
+  std::size_t bytes_read{0};
+  JsonValidator validator;
+  while (bytes_read < file_size)
+  {
+    if (context.IsCancelled())
+    {
+      return;
+    }
+    const auto chunk_size = std::min(kChunkSize, file_size - bytes_read);
+    if (!input.read(&content[bytes_read], static_cast<std::streamsize>(chunk_size)))
+    {
+      m_error_message = "Can't read file '" + m_file_name + "'";
+      return;
+    }
+    if (!validator.Feed(&content[bytes_read], chunk_size))
+    {
+      break;
+    }
+    bytes_read += chunk_size;
+    context.ReportProgress(GetProgress(bytes_read, file_size, 0, kImportReadProgress));
+  }
+
+  if (!validator.Finish())
+  {
+    m_error_message = "Invalid JSON in file '" + m_file_name + "': " + validator.GetErrorMessage();
+    return;
+  }
+
+  // parsing
+  sup::dto::AnyValue anyvalue;
+  try
+  {
+    anyvalue = AnyValueFromJSONString(content);
+  }
+  catch (const std::exception& ex)
+  {
+    m_error_message = CreateErrorMessage("Can't parse JSON file '" + m_file_name + "'", ex);
+    return;
+  }
+  content = std::string();
+  context.ReportProgress(kImportParseProgress);
+
+  if (context.IsCancelled())
+  {
+    return;
+  }
+
+  // building the item outside of the model, the whole subtree goes into one arena, large numeric
+  // arrays are packed into a single item
+  try
+  {
+    const ItemArenaScope arena_scope;
+    m_item = CreatePackedAnyValueItem(anyvalue, constants::kPackedScalarArrayMinSize);
+  }
+  catch (const std::exception& ex)
+  {
+    m_error_message = CreateErrorMessage("Can't create item from file '" + m_file_name + "'", ex);
+    return;
+  }
+  context.ReportProgress(100);
+}
+
+std::string ImportAnyValueTask::GetFileName() const
+{
+  return m_file_name;
+}
+
+std::string ImportAnyValueTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+std::unique_ptr<AnyValueItem> ImportAnyValueTask::TakeItem()
+{
+  return std::move(m_item);
+}
+
+// ----------------------------------------------------------------------------
+// ExportAnyValueTask
+// ----------------------------------------------------------------------------
+
+ExportAnyValueTask::ExportAnyValueTask(const anyvalue_t& anyvalue, std::string file_name)
+    : m_anyvalue(std::make_unique<anyvalue_t>(anyvalue)), m_file_name(std::move(file_name))
+{
+}
+
+ExportAnyValueTask::~ExportAnyValueTask() = default;
+
+void ExportAnyValueTask::Run(TaskContext& context)
+{
+  // serializing
+  std::string content;
+  try
+  {
+    content = AnyValueToJSONString(*m_anyvalue, /*is_pretty*/ true);
+  }
+  catch (const std::exception& ex)
+  {
+    m_error_message = CreateErrorMessage("Can't generate JSON presentation", ex);
+    return;
+  }
+  context.ReportProgress(kExportSerializeProgress);
+
+  // writing to a temporary file
+  const std::string temp_file_name = m_file_name + ".part";
+  std::size_t bytes_written{0};
+  {
+    std::ofstream output(temp_file_name, std::ios::binary | std::ios::trunc);
+    while (output && bytes_written < content.size() && !context.IsCancelled())
+    {
+      const auto chunk_size = std::min(kChunkSize, content.size() - bytes_written);
+      (void)output.write(&content[bytes_written], static_cast<std::streamsize>(chunk_size));
+      bytes_written += chunk_size;
+      context.ReportProgress(
+          GetProgress(bytes_written, content.size(), kExportSerializeProgress, 100));
+    }
+    output.close();
+
+    if (!output)
+    {
+      m_error_message = "Can't write file '" + m_file_name + "'";
+    }
+  }
+
+  // replacing the target only with the complete content
+  if (!m_error_message.empty() || context.IsCancelled())
+  {
+    (void)std::remove(temp_file_name.c_str());
+    return;
+  }
+
+  if (std::rename(temp_file_name.c_str(), m_file_name.c_str()) != 0)
+  {
+    (void)std::remove(temp_file_name.c_str());
+    m_error_message = "Can't write file '" + m_file_name + "'";
+  }
+}
+
+std::string ExportAnyValueTask::GetFileName() const
+{
+  return m_file_name;
+}
+
+std::string ExportAnyValueTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+}  // namespace sup::gui
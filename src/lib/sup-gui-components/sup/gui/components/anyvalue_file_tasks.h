@@ -0,0 +1,110 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_COMPONENTS_ANYVALUE_FILE_TASKS_H_
+#define SUP_GUI_COMPONENTS_ANYVALUE_FILE_TASKS_H_
+
+//! @file
+//! Tasks to import and export AnyValue from/to JSON files in a background thread.
+
+#include <sup/gui/core/dto_types_fwd.h>
+#include <sup/gui/tasks/i_task.h>
+
+#include <memory>
+#include <string>
+
+namespace sup::gui
+{
+
+class AnyValueItem;
+
+/**
+ * @brief The ImportAnyValueTask class reads JSON file, parses it and builds AnyValueItem outside of
+ * any model.
+ *
+ * Reading the file is reported as a progress by bytes read. JSON syntax is validated while
+ * reading, a broken file is reported with the line and column of the error before any parsing.
+ * The task doesn't touch any model, the item should be taken and inserted in the model in the GUI
+ * thread. Numeric arrays of constants::kPackedScalarArrayMinSize elements and above are packed
+ * into AnyValueScalarArrayItem. Errors don't throw, they are reported by the error message.
+ */
+class ImportAnyValueTask : public ITask
+{
+public:
+  explicit ImportAnyValueTask(std::string file_name);
+  ~ImportAnyValueTask() override;
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the name of the file to import.
+   */
+  std::string GetFileName() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+  /**
+   * @brief Takes the item built from the file, or nullptr if run has failed or was cancelled.
+   */
+  std::unique_ptr<AnyValueItem> TakeItem();
+
+private:
+  std::string m_file_name;
+  std::string m_error_message;
+  std::unique_ptr<AnyValueItem> m_item;
+};
+
+/**
+ * @brief The ExportAnyValueTask class serializes AnyValue into JSON and writes it to a file.
+ *
+ * Writing the file is reported as a progress by bytes written. The content is written to a
+ * temporary file first, which replaces the target file only when complete. A cancelled or failed
+ * run leaves the target file untouched.
+ */
+class ExportAnyValueTask : public ITask
+{
+public:
+  ExportAnyValueTask(const anyvalue_t& anyvalue, std::string file_name);
+  ~ExportAnyValueTask() override;
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the name of the file to export.
+   */
+  std::string GetFileName() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+private:
+  std::unique_ptr<anyvalue_t> m_anyvalue;
+  std::string m_file_name;
+  std::string m_error_message;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_COMPONENTS_ANYVALUE_FILE_TASKS_H_
@@ -25,6 +25,7 @@
 
 #include <sup/gui/model/anyvalue_item.h>
 #include <sup/gui/model/anyvalue_item_constants.h>
+#include <sup/gui/model/item_arena.h>
 
 #include <mvvm/utils/container_utils.h>
 
@@ -55,6 +56,8 @@ std::unique_ptr<QMimeData> CreateAnyValueItemSelectionCopyMimeData(
 
 std::vector<std::unique_ptr<mvvm::SessionItem> > CreateAnyValueItems(const QMimeData *mime_data)
 {
+  // pasted subtrees are allocated together and released in bulk on deletion
+  const ItemArenaScope arena_scope;
   return sup::gui::CreateSessionItems(mime_data, kCopyAnyValueMimeType);
 }
 
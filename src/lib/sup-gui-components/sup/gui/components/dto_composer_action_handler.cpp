@@ -20,6 +20,8 @@
 
 #include "dto_composer_action_handler.h"
 
+#include "dto_composer_tasks.h"
+
 #include <sup/gui/core/sup_gui_core_exceptions.h>
 
 #include <mvvm/model/i_session_model.h>
@@ -68,6 +70,49 @@ void DtoComposerActionHandler::OnDuplicateContainer(std::size_t container_index)
                               container_to_copy->GetTagIndex().Next());
 }
 
+std::unique_ptr<DuplicateContainerTask> DtoComposerActionHandler::CreateDuplicateTask(
+    std::size_t container_index)
+{
+  ValidateModel();
+  auto container_to_copy =
+      m_model->GetRootItem()->GetItem(mvvm::TagIndex::Default(container_index));
+  if (!container_to_copy || !DuplicateContainerTask::CanDuplicate(*container_to_copy))
+  {
+    return {};
+  }
+
+  try
+  {
+    return std::make_unique<DuplicateContainerTask>(*container_to_copy);
+  }
+  catch (const std::exception &)
+  {
+    // content which can't be represented as AnyValue is copied by the model
+    return {};
+  }
+}
+
+void DtoComposerActionHandler::InsertDuplicatedContainer(DuplicateContainerTask &task)
+{
+  ValidateModel();
+  auto container = task.TakeContainer();
+  if (!container)
+  {
+    return;
+  }
+
+  auto tag_index = mvvm::TagIndex::Append();
+  for (auto item : m_model->GetRootItem()->GetAllItems())
+  {
+    if (item->GetIdentifier() == task.GetSourceIdentifier())
+    {
+      tag_index = item->GetTagIndex().Next();
+    }
+  }
+
+  (void)m_model->InsertItem(std::move(container), m_model->GetRootItem(), tag_index);
+}
+
 void DtoComposerActionHandler::ValidateModel()
 {
   if (!m_model)
@@ -22,6 +22,7 @@
 #define SUP_GUI_COMPONENTS_DTO_COMPOSER_ACTION_HANDLER_H_
 
 #include <QObject>
+#include <memory>
 
 namespace mvvm
 {
@@ -31,6 +32,8 @@ class ISessionModel;
 namespace sup::gui
 {
 
+class DuplicateContainerTask;
+
 /**
  * @brief The DtoComposerActionHandler class provides a logic to handle main actions of
  * DtoComposerView.
@@ -66,6 +69,21 @@ public:
    */
   void OnDuplicateContainer(std::size_t container_index);
 
+  /**
+   * @brief Creates a task to copy the container with the given index in a background thread.
+   *
+   * @return Task, or nullptr if the container can be copied only in the GUI thread.
+   */
+  std::unique_ptr<DuplicateContainerTask> CreateDuplicateTask(std::size_t container_index);
+
+  /**
+   * @brief Inserts the copy of the container built by the task right after its source container.
+   *
+   * The container with all its content is inserted as a single command. It is appended to the
+   * end, if the source container has been removed while the task was running.
+   */
+  void InsertDuplicatedContainer(DuplicateContainerTask& task);
+
 private:
   void ValidateModel();
 
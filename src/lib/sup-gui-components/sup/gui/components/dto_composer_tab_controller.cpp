@@ -27,6 +27,7 @@
 #include <mvvm/signals/model_listener.h>
 
 #include <QTabWidget>
+#include <QVBoxLayout>
 
 namespace sup::gui
 {
@@ -51,6 +52,9 @@ DtoComposerTabController::DtoComposerTabController(mvvm::ISessionModel *model,
       this, &DtoComposerTabController::OnAboutToRemoveItemEvent);
   m_listener->Connect<mvvm::ModelResetEvent>(this, &DtoComposerTabController::OnModelResetEvent);
 
+  connect(m_tab_widget, &QTabWidget::currentChanged, this,
+          &DtoComposerTabController::OnCurrentTabChanged);
+
   InitTabs();
 }
 
@@ -60,8 +64,19 @@ QWidget *DtoComposerTabController::GetWidgetForItem(const mvvm::SessionItem *con
   return iter == m_widget_map.end() ? nullptr : iter->second;
 }
 
+QWidget *DtoComposerTabController::GetEditorForItem(const mvvm::SessionItem *container)
+{
+  auto page = GetWidgetForItem(container);
+  if (!page || m_pending_editors.find(page) != m_pending_editors.end())
+  {
+    return nullptr;
+  }
+  return page->layout()->itemAt(0) ? page->layout()->itemAt(0)->widget() : nullptr;
+}
+
 void DtoComposerTabController::InitTabs()
 {
+  m_pending_editors.clear();
   m_tab_widget->clear();
   for (auto child : m_model->GetRootItem()->GetAllItems())
   {
@@ -92,6 +107,8 @@ void DtoComposerTabController::OnAboutToRemoveItemEvent(const mvvm::AboutToRemov
     auto container = parent->GetItem(tag_index);
     if (auto widget = GetWidgetForItem(container); widget)
     {
+      // neighbour tab might become current and get its editor on removal
+      (void)m_pending_editors.erase(widget);
       m_tab_widget->removeTab(tag_index.GetIndex());
       delete widget;
 
@@ -107,12 +124,15 @@ void DtoComposerTabController::OnAboutToRemoveItemEvent(const mvvm::AboutToRemov
 void DtoComposerTabController::InsertAnyValueItemContainerTab(mvvm::SessionItem *container,
                                                               std::size_t index)
 {
-  auto widget = m_create_widget_callback(container);
+  auto page = std::make_unique<QWidget>();
+  auto layout = new QVBoxLayout(page.get());
+  layout->setContentsMargins(0, 0, 0, 0);
 
-  (void)m_widget_map.insert({container, widget.get()});
+  (void)m_widget_map.insert({container, page.get()});
+  (void)m_pending_editors.insert({page.get(), container});
 
-  // ownership is taken by QTabWidget
-  (void)m_tab_widget->insertTab(static_cast<int>(index), widget.release(), "AnyValue");
+  // ownership is taken by QTabWidget, the first tab becomes current and gets its editor at once
+  (void)m_tab_widget->insertTab(static_cast<int>(index), page.release(), "AnyValue");
 }
 
 void DtoComposerTabController::OnModelResetEvent(const mvvm::ModelResetEvent &event)
@@ -126,6 +146,8 @@ void DtoComposerTabController::OnModelResetEvent(const mvvm::ModelResetEvent &ev
 
 void DtoComposerTabController::ClearWidgets()
 {
+  // containers might be gone already
+  m_pending_editors.clear();
   m_tab_widget->clear();
 
   for (auto [item, widget] : m_widget_map)
@@ -135,4 +157,18 @@ void DtoComposerTabController::ClearWidgets()
   m_widget_map.clear();
 }
 
+void DtoComposerTabController::OnCurrentTabChanged(int index)
+{
+  auto page = m_tab_widget->widget(index);
+  auto iter = m_pending_editors.find(page);
+  if (iter == m_pending_editors.end())
+  {
+    return;
+  }
+
+  auto container = iter->second;
+  (void)m_pending_editors.erase(iter);
+  page->layout()->addWidget(m_create_widget_callback(container).release());
+}
+
 }  // namespace sup::gui
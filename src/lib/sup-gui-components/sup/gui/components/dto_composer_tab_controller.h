@@ -47,6 +47,10 @@ namespace sup::gui
  *
  * It is expected that the model contains a number of top level container items. Adding a
  * new container will lead to appearance of a new tab. Container removal will trigger tab removal.
+ *
+ * Every tab gets an empty page at once, while the editor widget is created by the callback when
+ * the tab becomes current for the first time. Containers with large content don't cost an editor
+ * until the user looks at them.
  */
 class DtoComposerTabController : public QObject
 {
@@ -68,10 +72,15 @@ public:
   ~DtoComposerTabController() override;
 
   /**
-   * @brief Returns the widget serving given container.
+   * @brief Returns the tab page serving given container.
    */
   QWidget* GetWidgetForItem(const mvvm::SessionItem* container);
 
+  /**
+   * @brief Returns the editor widget of the given container, or nullptr if it wasn't created yet.
+   */
+  QWidget* GetEditorForItem(const mvvm::SessionItem* container);
+
   /**
    * @brief Create necessary tabs to reflect initial state of the model;
    */
@@ -107,13 +116,21 @@ private:
    */
   void ClearWidgets();
 
+  /**
+   * @brief Creates the editor on the page with the given index, if it wasn't created yet.
+   */
+  void OnCurrentTabChanged(int index);
+
   mvvm::ISessionModel* m_model{nullptr};
   create_widget_callback_t m_create_widget_callback;
   QTabWidget* m_tab_widget{nullptr};
   std::unique_ptr<mvvm::ModelListener> m_listener;
 
-  //!< correspondance of AnyValueItem container to AnyValueEditorWidget
+  //!< correspondance of AnyValueItem container to the tab page
   std::map<const mvvm::SessionItem*, QWidget*> m_widget_map;
+
+  //!< containers of pages, which don't have an editor yet
+  std::map<const QWidget*, mvvm::SessionItem*> m_pending_editors;
 };
 
 }  // namespace sup::gui
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "dto_composer_tasks.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_item_constants.h>
+#include <sup/gui/model/item_arena.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <mvvm/standarditems/container_item.h>
+
+#include <sup/dto/anyvalue.h>
+
+namespace sup::gui
+{
+
+DuplicateContainerTask::DuplicateContainerTask(const mvvm::SessionItem& container)
+    : m_source_identifier(container.GetIdentifier()), m_container_name(container.GetDisplayName())
+{
+  if (!CanDuplicate(container))
+  {
+    throw RuntimeException("DuplicateContainerTask: container has items of unsupported type");
+  }
+
+  for (auto child : container.GetAllItems())
+  {
+    auto anyvalue_item = static_cast<const AnyValueItem*>(child);
+    m_item_names.push_back(anyvalue_item->GetDisplayName());
+    m_item_values.push_back(std::make_unique<anyvalue_t>(CreateAnyValue(*anyvalue_item)));
+  }
+}
+
+DuplicateContainerTask::~DuplicateContainerTask() = default;
+
+bool DuplicateContainerTask::CanDuplicate(const mvvm::SessionItem& container)
+{
+  for (auto child : container.GetAllItems())
+  {
+    if (!dynamic_cast<const AnyValueItem*>(child))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DuplicateContainerTask::Run(TaskContext& context)
+{
+  auto result = std::make_unique<mvvm::ContainerItem>();
+  (void)result->SetDisplayName(m_container_name);
+
+  // items of the whole container go into one arena, a scope per item would mean an arena per item
+  const ItemArenaScope arena_scope;
+  for (std::size_t index = 0; index < m_item_values.size(); ++index)
+  {
+    if (context.IsCancelled())
+    {
+      return;
+    }
+
+    try
+    {
+      // large numeric arrays of the original are packed, and stay packed in the duplicate
+      auto item = CreatePackedAnyValueItem(*m_item_values[index],
+                                           constants::kPackedScalarArrayMinSize);
+      (void)item->SetDisplayName(m_item_names[index]);
+      (void)result->InsertItem(std::move(item), mvvm::TagIndex::Append());
+    }
+    catch (const std::exception& ex)
+    {
+      m_error_message = std::string("Can't duplicate container: ") + ex.what();
+      return;
+    }
+
+    // the snapshot is not needed anymore
+    m_item_values[index].reset();
+    context.ReportProgress(static_cast<int>((index + 1) * 100 / m_item_values.size()));
+  }
+
+  m_container = std::move(result);
+}
+
+std::string DuplicateContainerTask::GetSourceIdentifier() const
+{
+  return m_source_identifier;
+}
+
+std::string DuplicateContainerTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+std::unique_ptr<mvvm::ContainerItem> DuplicateContainerTask::TakeContainer()
+{
+  return std::move(m_container);
+}
+
+}  // namespace sup::gui
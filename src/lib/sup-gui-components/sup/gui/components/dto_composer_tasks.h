@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_COMPONENTS_DTO_COMPOSER_TASKS_H_
+#define SUP_GUI_COMPONENTS_DTO_COMPOSER_TASKS_H_
+
+//! @file
+//! Tasks to support DtoComposerView operations in a background thread.
+
+#include <sup/gui/core/dto_types_fwd.h>
+#include <sup/gui/tasks/i_task.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mvvm
+{
+class ContainerItem;
+class SessionItem;
+}  // namespace mvvm
+
+namespace sup::gui
+{
+
+/**
+ * @brief The DuplicateContainerTask class builds a copy of the container with AnyValueItems
+ * outside of any model.
+ *
+ * The content of the container is taken as a snapshot of AnyValues on construction, in the GUI
+ * thread. The snapshot is still a pass over all leaves of all items, but AnyValue is much lighter
+ * than the tree of items. Building items with their identifiers and properties is the main cost of
+ * the duplication, and it happens in the background, with items of the whole container in one
+ * arena. The container should be taken and inserted in the model in the GUI thread. Errors don't
+ * throw, they are reported by the error message.
+ */
+class DuplicateContainerTask : public ITask
+{
+public:
+  /**
+   * @brief Main constructor.
+   *
+   * @details Will throw if the container has children other than AnyValueItem, or if one of
+   * them can't be converted to AnyValue.
+   */
+  explicit DuplicateContainerTask(const mvvm::SessionItem& container);
+  ~DuplicateContainerTask() override;
+
+  /**
+   * @brief Checks if the content of the given container can be duplicated by the task.
+   */
+  static bool CanDuplicate(const mvvm::SessionItem& container);
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the identifier of the container being duplicated.
+   */
+  std::string GetSourceIdentifier() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+  /**
+   * @brief Takes the copy of the container, or nullptr if run has failed or was cancelled.
+   */
+  std::unique_ptr<mvvm::ContainerItem> TakeContainer();
+
+private:
+  std::string m_source_identifier;
+  std::string m_container_name;
+  std::vector<std::string> m_item_names;
+  std::vector<std::unique_ptr<anyvalue_t>> m_item_values;
+  std::string m_error_message;
+  std::unique_ptr<mvvm::ContainerItem> m_container;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_COMPONENTS_DTO_COMPOSER_TASKS_H_
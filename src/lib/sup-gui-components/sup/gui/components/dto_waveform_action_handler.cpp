@@ -20,16 +20,24 @@
 
 #include "dto_waveform_action_handler.h"
 
+#include "waveform_file_tasks.h"
+
 #include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/model/packed_waveform_item.h>
+#include <sup/gui/plotting/waveform_envelope_cache.h>
 #include <sup/gui/plotting/waveform_helper.h>
 
+#include <mvvm/commands/i_command_stack.h>
 #include <mvvm/model/i_session_model.h>
 #include <mvvm/model/item_utils.h>
+#include <mvvm/model/model_utils.h>
 #include <mvvm/model/session_item.h>
 #include <mvvm/standarditems/chart_viewport_item.h>
 #include <mvvm/standarditems/line_series_data_item.h>
 #include <mvvm/standarditems/line_series_item.h>
 
+#include <algorithm>
+
 namespace sup::gui
 {
 
@@ -53,6 +61,8 @@ DtoWaveformActionHandler::DtoWaveformActionHandler(DtoWaveformEditorContext cont
   }
 }
 
+DtoWaveformActionHandler::~DtoWaveformActionHandler() = default;
+
 bool DtoWaveformActionHandler::CanAddWaveform() const
 {
   return GetWaveformContainer() != nullptr && GetDataContainer() != nullptr;
@@ -88,13 +98,209 @@ void DtoWaveformActionHandler::RemoveWaveform()
       dynamic_cast<mvvm::LineSeriesItem *>(mvvm::utils::FindNextSiblingToSelect(selected_waveform));
 
   auto corresponding_data = selected_waveform->GetDataItem();
+  auto packed_data = FindPackedWaveform(*selected_waveform);
 
   GetModel()->RemoveItem(selected_waveform);
   GetModel()->RemoveItem(corresponding_data);
+  if (packed_data)
+  {
+    GetModel()->RemoveItem(packed_data);
+  }
 
   emit SelectWaveformRequest(next_to_select);
 }
 
+std::unique_ptr<ImportWaveformTask> DtoWaveformActionHandler::CreateImportTask(
+    const std::string &file_name, const WaveformFileOptions &options)
+{
+  if (!CanAddWaveform())
+  {
+    return {};
+  }
+
+  return std::make_unique<ImportWaveformTask>(file_name, options);
+}
+
+void DtoWaveformActionHandler::InsertImportedWaveform(const WaveformBuffer &waveform,
+                                                      const std::string &name)
+{
+  if (!CanAddWaveform())
+  {
+    return;
+  }
+
+  mvvm::utils::BeginMacro(*GetModel(), "Import waveform");
+
+  auto line_series = InsertWaveform(std::make_unique<mvvm::LineSeriesItem>());
+  InsertDataForWaveform(line_series);
+  line_series->GetDataItem()->SetWaveform(GetWaveformPoints(waveform));
+  if (!name.empty())
+  {
+    (void)line_series->SetDisplayName(name);
+  }
+
+  mvvm::utils::EndMacro(*GetModel());
+
+  emit SelectWaveformRequest(line_series);
+}
+
+bool DtoWaveformActionHandler::CanExportWaveform() const
+{
+  auto selected_waveform = GetSelectedWaveform();
+  return selected_waveform && selected_waveform->GetDataItem();
+}
+
+std::unique_ptr<ExportWaveformTask> DtoWaveformActionHandler::CreateExportTask(
+    const std::string &file_name, const WaveformFileOptions &options)
+{
+  if (!CanExportWaveform())
+  {
+    return {};
+  }
+
+  auto waveform = CreateWaveformBuffer(
+      ReadWaveformPoints(*GetSelectedWaveform(), CreatePackedWaveformIndex()));
+  return std::make_unique<ExportWaveformTask>(std::move(waveform), file_name, options);
+}
+
+bool DtoWaveformActionHandler::CanExportResampledWaveforms() const
+{
+  if (!GetWaveformContainer())
+  {
+    return false;
+  }
+
+  const auto packed_index = CreatePackedWaveformIndex();
+  auto line_series = GetWaveformContainer()->GetLineSeries();
+  return std::any_of(line_series.begin(), line_series.end(), [this, &packed_index](auto item)
+                     { return ReadWaveformPointCount(*item, packed_index) > 0; });
+}
+
+std::unique_ptr<ExportResampledWaveformsTask> DtoWaveformActionHandler::CreateResampledExportTask(
+    const std::string &file_name, const WaveformResamplingOptions &options)
+{
+  if (!CanExportResampledWaveforms())
+  {
+    return {};
+  }
+
+  const auto packed_index = CreatePackedWaveformIndex();
+  std::vector<WaveformBuffer> waveforms;
+  std::vector<std::string> names;
+  for (auto item : GetWaveformContainer()->GetLineSeries())
+  {
+    if (ReadWaveformPointCount(*item, packed_index) > 0)
+    {
+      waveforms.push_back(CreateWaveformBuffer(ReadWaveformPoints(*item, packed_index)));
+      names.push_back(item->GetDisplayName());
+    }
+  }
+
+  return std::make_unique<ExportResampledWaveformsTask>(std::move(waveforms), std::move(names),
+                                                        file_name, options);
+}
+
+bool DtoWaveformActionHandler::CanPackWaveforms() const
+{
+  if (!GetWaveformContainer() || !GetPackedDataContainer())
+  {
+    return false;
+  }
+
+  // packed data lives outside of the command history only when there is no history at all
+  return GetWaveformContainer()->GetModel()->GetCommandStack() == nullptr;
+}
+
+void DtoWaveformActionHandler::UpdatePackedWaveforms()
+{
+  if (!GetWaveformContainer())
+  {
+    return;
+  }
+
+  const bool can_pack = CanPackWaveforms();
+  const auto packed_index = CreatePackedWaveformIndex();
+  auto selected_waveform = GetSelectedWaveform();
+
+  std::vector<std::pair<mvvm::LineSeriesItem *, PackedWaveformItem *>> waveforms_to_unpack;
+  std::vector<mvvm::LineSeriesItem *> waveforms_to_pack;
+  for (auto waveform : GetWaveformContainer()->GetLineSeries())
+  {
+    auto packed_data = FindPackedWaveform(*waveform, packed_index);
+    if (!can_pack || waveform == selected_waveform || waveform->IsDisplayed())
+    {
+      if (packed_data)
+      {
+        waveforms_to_unpack.emplace_back(waveform, packed_data);
+      }
+      continue;
+    }
+
+    auto data_item = waveform->GetDataItem();
+    if (can_pack && data_item && data_item->GetPointCount() > 0)
+    {
+      waveforms_to_pack.push_back(waveform);
+    }
+  }
+
+  if ((waveforms_to_unpack.empty() && waveforms_to_pack.empty()) || !CanChangePackedData())
+  {
+    return;
+  }
+
+  for (auto [waveform, packed_data] : waveforms_to_unpack)
+  {
+    RestorePackedPoints(*waveform, packed_data);
+  }
+
+  for (auto waveform : waveforms_to_pack)
+  {
+    auto data_item = waveform->GetDataItem();
+    auto packed_data = FindPackedWaveform(*waveform, packed_index);
+    if (!packed_data)
+    {
+      packed_data = GetModel()->InsertItem<PackedWaveformItem>(GetPackedDataContainer(),
+                                                               mvvm::TagIndex::Append());
+      packed_data->SetDataItemIdentifier(data_item->GetIdentifier());
+    }
+    packed_data->SetWaveform(data_item->GetWaveform());
+    data_item->SetWaveform({});
+  }
+
+  ClearPagingHistory();
+}
+
+bool DtoWaveformActionHandler::IsWaveformPacked(const mvvm::LineSeriesItem *waveform) const
+{
+  return waveform && FindPackedWaveform(*waveform) != nullptr;
+}
+
+void DtoWaveformActionHandler::UnpackWaveform(mvvm::LineSeriesItem *waveform)
+{
+  auto packed_data = waveform ? FindPackedWaveform(*waveform) : nullptr;
+  if (!packed_data || !CanChangePackedData())
+  {
+    return;
+  }
+
+  RestorePackedPoints(*waveform, packed_data);
+  ClearPagingHistory();
+}
+
+WaveformStatistics DtoWaveformActionHandler::GetWaveformStatistics(
+    const mvvm::LineSeriesItem *waveform)
+{
+  auto envelope = waveform ? GetWaveformEnvelope(*waveform) : nullptr;
+  return envelope ? envelope->GetStatistics() : WaveformStatistics{};
+}
+
+std::vector<std::pair<double, double>> DtoWaveformActionHandler::CreateWaveformOverview(
+    const mvvm::LineSeriesItem *waveform, std::size_t bin_count)
+{
+  auto envelope = waveform ? GetWaveformEnvelope(*waveform) : nullptr;
+  return envelope ? envelope->CreateOverview(bin_count) : std::vector<std::pair<double, double>>{};
+}
+
 mvvm::LineSeriesItem *DtoWaveformActionHandler::GetSelectedWaveform() const
 {
   return m_context.selected_waveform();
@@ -110,6 +316,142 @@ mvvm::SessionItem *DtoWaveformActionHandler::GetDataContainer() const
   return m_context.data_container();
 }
 
+mvvm::SessionItem *DtoWaveformActionHandler::GetPackedDataContainer() const
+{
+  return m_context.packed_data_container ? m_context.packed_data_container() : nullptr;
+}
+
+DtoWaveformActionHandler::packed_index_t DtoWaveformActionHandler::CreatePackedWaveformIndex()
+    const
+{
+  packed_index_t result;
+  if (auto container = GetPackedDataContainer(); container)
+  {
+    for (auto child : container->GetAllItems())
+    {
+      if (auto packed_data = dynamic_cast<PackedWaveformItem *>(child); packed_data)
+      {
+        (void)result.emplace(packed_data->GetDataItemIdentifier(), packed_data);
+      }
+    }
+  }
+  return result;
+}
+
+PackedWaveformItem *DtoWaveformActionHandler::FindPackedWaveform(
+    const mvvm::LineSeriesItem &waveform) const
+{
+  auto data_item = waveform.GetDataItem();
+  auto container = GetPackedDataContainer();
+  if (!data_item || !container)
+  {
+    return nullptr;
+  }
+
+  for (auto child : container->GetAllItems())
+  {
+    auto packed_data = dynamic_cast<PackedWaveformItem *>(child);
+    if (packed_data && packed_data->GetDataItemIdentifier() == data_item->GetIdentifier())
+    {
+      return packed_data;
+    }
+  }
+  return nullptr;
+}
+
+PackedWaveformItem *DtoWaveformActionHandler::FindPackedWaveform(
+    const mvvm::LineSeriesItem &waveform, const packed_index_t &packed_index) const
+{
+  auto data_item = waveform.GetDataItem();
+  if (!data_item)
+  {
+    return nullptr;
+  }
+
+  auto iter = packed_index.find(data_item->GetIdentifier());
+  return iter == packed_index.end() ? nullptr : iter->second;
+}
+
+bool DtoWaveformActionHandler::CanChangePackedData() const
+{
+  auto command_stack = GetModel()->GetCommandStack();
+  return !command_stack || (command_stack->GetCommandCount() == 0 && !command_stack->CanRedo());
+}
+
+void DtoWaveformActionHandler::ClearPagingHistory()
+{
+  // the history was empty before paging, the user has nothing to undo here
+  if (auto command_stack = GetModel()->GetCommandStack(); command_stack)
+  {
+    command_stack->Clear();
+  }
+}
+
+void DtoWaveformActionHandler::RestorePackedPoints(mvvm::LineSeriesItem &waveform,
+                                                   PackedWaveformItem *packed_data)
+{
+  waveform.GetDataItem()->SetWaveform(packed_data->GetWaveform());
+  GetModel()->RemoveItem(packed_data);
+}
+
+std::vector<std::pair<double, double>> DtoWaveformActionHandler::ReadWaveformPoints(
+    const mvvm::LineSeriesItem &waveform, const packed_index_t &packed_index) const
+{
+  if (auto packed_data = FindPackedWaveform(waveform, packed_index); packed_data)
+  {
+    return packed_data->GetWaveform();
+  }
+  return waveform.GetDataItem() ? waveform.GetDataItem()->GetWaveform()
+                                : std::vector<std::pair<double, double>>{};
+}
+
+std::size_t DtoWaveformActionHandler::ReadWaveformPointCount(
+    const mvvm::LineSeriesItem &waveform, const packed_index_t &packed_index) const
+{
+  if (auto packed_data = FindPackedWaveform(waveform, packed_index); packed_data)
+  {
+    return packed_data->GetPointCount();
+  }
+  return waveform.GetDataItem()
+             ? static_cast<std::size_t>(waveform.GetDataItem()->GetPointCount())
+             : 0;
+}
+
+const WaveformEnvelope *DtoWaveformActionHandler::GetWaveformEnvelope(
+    const mvvm::LineSeriesItem &waveform)
+{
+  auto data_item = waveform.GetDataItem();
+  if (!data_item || !data_item->GetModel())
+  {
+    return nullptr;
+  }
+
+  if (!m_envelope_cache || m_envelope_cache->GetModel() != data_item->GetModel())
+  {
+    m_envelope_cache = std::make_unique<WaveformEnvelopeCache>(data_item->GetModel());
+  }
+
+  if (auto envelope = m_envelope_cache->FindEnvelope(data_item); envelope)
+  {
+    return envelope;
+  }
+
+  // packed points are not visible to the cache, their envelope is dropped on unpacking
+  if (auto packed_data = FindPackedWaveform(waveform); packed_data)
+  {
+    const auto points = packed_data->GetWaveform();
+    std::vector<double> y_values;
+    y_values.reserve(points.size());
+    for (const auto &[x, y] : points)
+    {
+      y_values.push_back(y);
+    }
+    return &m_envelope_cache->InsertEnvelope(data_item, WaveformEnvelope(std::move(y_values)));
+  }
+
+  return &m_envelope_cache->GetEnvelope(*data_item);
+}
+
 mvvm::ISessionModel *DtoWaveformActionHandler::GetModel()
 {
   // for the moment we assume that WaveformContainer and DataContainer are located in the same model
@@ -22,9 +22,16 @@
 #define SUP_GUI_COMPONENTS_DTO_WAVEFORM_ACTION_HANDLER_H_
 
 #include <sup/gui/components/dto_waveform_editor_context.h>
+#include <sup/gui/plotting/waveform_envelope.h>
+#include <sup/gui/plotting/waveform_file_utils.h>
+#include <sup/gui/plotting/waveform_resampling.h>
 
 #include <QObject>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace mvvm
 {
@@ -37,6 +44,12 @@ class ChartViewportItem;
 namespace sup::gui
 {
 
+class PackedWaveformItem;
+class WaveformEnvelopeCache;
+class ImportWaveformTask;
+class ExportWaveformTask;
+class ExportResampledWaveformsTask;
+
 /**
  * @brief The DtoWaveformActionHandler class provides a logic to handle main actions of
  * DtoWaveformView.
@@ -48,9 +61,12 @@ class DtoWaveformActionHandler : public QObject
 {
   Q_OBJECT
 
+  using packed_index_t = std::unordered_map<std::string, PackedWaveformItem*>;
+
 public:
   explicit DtoWaveformActionHandler(DtoWaveformEditorContext context,
                                     QObject* parent_object = nullptr);
+  ~DtoWaveformActionHandler() override;
 
   /**
    * @brief Checks if waveform can be added to the container.
@@ -72,6 +88,97 @@ public:
    */
   void RemoveWaveform();
 
+  /**
+   * @brief Creates a task to read waveform from CSV or binary file in a background thread.
+   *
+   * @return Task, or nullptr if the waveform can't be added.
+   */
+  std::unique_ptr<ImportWaveformTask> CreateImportTask(const std::string& file_name,
+                                                       const WaveformFileOptions& options);
+
+  /**
+   * @brief Adds new waveform with the given points after current selection.
+   *
+   * The waveform together with its data is inserted as a single undoable command.
+   */
+  void InsertImportedWaveform(const WaveformBuffer& waveform, const std::string& name);
+
+  /**
+   * @brief Checks if the selected waveform can be exported.
+   */
+  bool CanExportWaveform() const;
+
+  /**
+   * @brief Creates a task to write points of the selected waveform to CSV or binary file in a
+   * background thread.
+   *
+   * @return Task, or nullptr if there is nothing to export.
+   */
+  std::unique_ptr<ExportWaveformTask> CreateExportTask(const std::string& file_name,
+                                                       const WaveformFileOptions& options);
+
+  /**
+   * @brief Checks if there are waveforms with points to export on a common time base.
+   */
+  bool CanExportResampledWaveforms() const;
+
+  /**
+   * @brief Creates a task to resample all waveforms with points on a common time base and to
+   * write them to JSON file as a single AnyValue struct in a background thread.
+   *
+   * Display names of waveforms are used as names of struct fields.
+   *
+   * @return Task, or nullptr if there is nothing to export.
+   */
+  std::unique_ptr<ExportResampledWaveformsTask> CreateResampledExportTask(
+      const std::string& file_name, const WaveformResamplingOptions& options);
+
+  /**
+   * @brief Checks if points of hidden waveforms can be packed.
+   *
+   * Packing requires the container for packed data and a model without undo, so that paging
+   * never appears in the user's command history.
+   */
+  bool CanPackWaveforms() const;
+
+  /**
+   * @brief Moves points of all waveforms, which are neither displayed nor selected, into
+   * compact packed items, and restores points of displayed and selected waveforms.
+   *
+   * Data items of packed waveforms stay in place, but without points. When packing is not
+   * possible, all packed waveforms are unpacked. With undo enabled, this is done only while the
+   * command history is empty, and the history is cleared afterwards.
+   */
+  void UpdatePackedWaveforms();
+
+  /**
+   * @brief Checks if points of the given waveform are packed.
+   */
+  bool IsWaveformPacked(const mvvm::LineSeriesItem* waveform) const;
+
+  /**
+   * @brief Restores points of the given waveform from its packed item, if there is one.
+   *
+   * With undo enabled, points are restored only while the command history is empty.
+   */
+  void UnpackWaveform(mvvm::LineSeriesItem* waveform);
+
+  /**
+   * @brief Returns the number of points and minimum, maximum and mean of y values of the given
+   * waveform, packed points included.
+   */
+  WaveformStatistics GetWaveformStatistics(const mvvm::LineSeriesItem* waveform);
+
+  /**
+   * @brief Returns minimum and maximum of y values of the given waveform in the given number of
+   * bins of equal width, to draw the overview of the waveform.
+   *
+   * Envelopes of waveforms are cached and updated as points change, the cost doesn't depend on
+   * the number of points.
+   */
+  std::vector<std::pair<double, double>> CreateWaveformOverview(
+      const mvvm::LineSeriesItem* waveform, std::size_t bin_count);
+
 signals:
   void SelectWaveformRequest(mvvm::LineSeriesItem* item);
 
@@ -91,6 +198,61 @@ private:
    */
   mvvm::SessionItem* GetDataContainer() const;
 
+  /**
+   * @brief Returns container used to store PackedWaveformItem, if any.
+   */
+  mvvm::SessionItem* GetPackedDataContainer() const;
+
+  /**
+   * @brief Returns packed items of all waveforms, indexed by the identifier of their data item.
+   */
+  packed_index_t CreatePackedWaveformIndex() const;
+
+  /**
+   * @brief Finds the packed item holding points of the given waveform.
+   */
+  PackedWaveformItem* FindPackedWaveform(const mvvm::LineSeriesItem& waveform) const;
+
+  /**
+   * @brief Finds the packed item holding points of the given waveform in the given index.
+   */
+  PackedWaveformItem* FindPackedWaveform(const mvvm::LineSeriesItem& waveform,
+                                         const packed_index_t& packed_index) const;
+
+  /**
+   * @brief Checks if packed data can be changed without leaving a trace in the command history.
+   */
+  bool CanChangePackedData() const;
+
+  /**
+   * @brief Clears the command history, which was empty before the packed data was changed.
+   */
+  void ClearPagingHistory();
+
+  /**
+   * @brief Moves points from the packed item back to the data item of the waveform, and removes
+   * the packed item.
+   */
+  void RestorePackedPoints(mvvm::LineSeriesItem& waveform, PackedWaveformItem* packed_data);
+
+  /**
+   * @brief Returns points of the waveform, packed ones included.
+   */
+  std::vector<std::pair<double, double>> ReadWaveformPoints(
+      const mvvm::LineSeriesItem& waveform, const packed_index_t& packed_index) const;
+
+  /**
+   * @brief Returns the number of points of the waveform, packed ones included.
+   */
+  std::size_t ReadWaveformPointCount(const mvvm::LineSeriesItem& waveform,
+                                     const packed_index_t& packed_index) const;
+
+  /**
+   * @brief Returns the envelope of the waveform from the cache, or nullptr if the waveform has no
+   * data.
+   */
+  const WaveformEnvelope* GetWaveformEnvelope(const mvvm::LineSeriesItem& waveform);
+
   /**
    * @brief Returns the model.
    */
@@ -109,6 +271,7 @@ private:
   void InsertDataForWaveform(mvvm::LineSeriesItem* waveform);
 
   DtoWaveformEditorContext m_context;
+  std::unique_ptr<WaveformEnvelopeCache> m_envelope_cache;
 };
 
 }  // namespace sup::gui
@@ -47,6 +47,9 @@ struct DtoWaveformEditorContext
 
   //! callback to get currently selected waveform
   std::function<mvvm::LineSeriesItem*()> selected_waveform;
+
+  //! optional callback to get container with packed data of hidden waveforms
+  std::function<mvvm::SessionItem*()> packed_data_container;
 };
 
 }  // namespace sup::gui
@@ -32,7 +32,8 @@ WaveformDisplayController::WaveformDisplayController(mvvm::ChartViewportItem* ch
     , m_listener(std::make_unique<mvvm::ModelListener>(chart_viewport->GetModel()))
 {
   m_listener->Connect<mvvm::ItemInsertedEvent>(this, &WaveformDisplayController::OnModelEvent);
-  m_listener->Connect<mvvm::ItemRemovedEvent>(this, &WaveformDisplayController::OnModelEvent);
+  m_listener->Connect<mvvm::AboutToRemoveItemEvent>(this,
+                                                    &WaveformDisplayController::OnModelEvent);
   UpdateDisplayStatus();
 }
 
@@ -59,37 +60,47 @@ void WaveformDisplayController::UpdateDisplayStatus()
 {
   for (auto waveform : m_chart_viewport->GetLineSeries())
   {
-    if (m_current_display_mode == WaveformDisplayMode::kDisplayAll)
-    {
-      waveform->SetDisplayed(true);
-    }
-    if (m_current_display_mode == WaveformDisplayMode::kDisplaySelected)
-    {
-      waveform->SetDisplayed(waveform == m_selected_waveform);
-    }
+    UpdateDisplayStatus(*waveform);
+  }
+}
+
+void WaveformDisplayController::UpdateDisplayStatus(mvvm::LineSeriesItem& waveform)
+{
+  const bool is_displayed = m_current_display_mode == WaveformDisplayMode::kDisplayAll
+                            || &waveform == m_selected_waveform;
+
+  // setting the same value would still cost a chain of notifications
+  if (waveform.IsDisplayed() != is_displayed)
+  {
+    waveform.SetDisplayed(is_displayed);
   }
 }
 
 void WaveformDisplayController::OnModelEvent(const mvvm::ItemInsertedEvent& event)
 {
-  (void)event;
-  if (m_current_display_mode == WaveformDisplayMode::kDisplayAll)
+  auto [parent, tag_index] = event;
+
+  // points inserted into waveforms, and any other activity in the model, are not of interest
+  if (parent != m_chart_viewport || m_current_display_mode == WaveformDisplayMode::kDisplayAll)
   {
     return;
   }
 
-  UpdateDisplayStatus();
+  if (auto waveform = dynamic_cast<mvvm::LineSeriesItem*>(parent->GetItem(tag_index)); waveform)
+  {
+    UpdateDisplayStatus(*waveform);
+  }
 }
 
-void WaveformDisplayController::OnModelEvent(const mvvm::ItemRemovedEvent& event)
+void WaveformDisplayController::OnModelEvent(const mvvm::AboutToRemoveItemEvent& event)
 {
-  (void)event;
-  if (m_current_display_mode == WaveformDisplayMode::kDisplayAll)
+  auto [parent, tag_index] = event;
+
+  // removal of a waveform doesn't change the display status of others
+  if (parent == m_chart_viewport && parent->GetItem(tag_index) == m_selected_waveform)
   {
-    return;
+    m_selected_waveform = nullptr;
   }
-
-  UpdateDisplayStatus();
 }
 
 }  // namespace sup::gui
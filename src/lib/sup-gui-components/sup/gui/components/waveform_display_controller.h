@@ -50,6 +50,9 @@ namespace sup::gui
  *
  * Mode kDisplaySelected
  * Controller will set "displayed" flag for waveform which is currently selected by the user.
+ *
+ * Controller reacts only on insertion and removal of waveforms in its viewport, changes of points
+ * inside waveforms are ignored. The flag is set only for waveforms where it actually changes.
  */
 class WaveformDisplayController
 {
@@ -63,19 +66,24 @@ public:
 
 private:
   /**
-   * @brief Updates display status
+   * @brief Updates display status of all waveforms.
    */
   void UpdateDisplayStatus();
 
   /**
-   * @brief Upadte selection status of waveforms.
+   * @brief Updates display status of a single waveform, if it differs from the expected one.
+   */
+  void UpdateDisplayStatus(mvvm::LineSeriesItem& waveform);
+
+  /**
+   * @brief Updates display status of the waveform inserted into the viewport.
    */
   void OnModelEvent(const mvvm::ItemInsertedEvent& event);
 
   /**
-   * @brief Upadte selection status of waveforms.
+   * @brief Forgets the selected waveform when it is removed from the viewport.
    */
-  void OnModelEvent(const mvvm::ItemRemovedEvent& event);
+  void OnModelEvent(const mvvm::AboutToRemoveItemEvent& event);
 
   WaveformDisplayMode m_current_display_mode{WaveformDisplayMode::kDisplayAll};
   mvvm::ChartViewportItem* m_chart_viewport{nullptr};
@@ -0,0 +1,285 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_file_tasks.h"
+
+#include "anyvalue_file_tasks.h"
+
+#include <sup/gui/tasks/task_context.h>
+#include <sup/gui/tasks/thread_pool.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The number of bytes read from the file at once.
+ */
+const std::size_t kReadChunkSize = 4 * 1024 * 1024;
+
+/**
+ * @brief The number of points formatted and written at once.
+ */
+const std::size_t kWritePointCount = 64 * 1024;
+
+/**
+ * @brief Progress of the resampled export when all waveforms were evaluated.
+ */
+const int kResampledProgress = 50;
+
+/**
+ * @brief Progress of the resampled export when AnyValue was created, the rest is writing.
+ */
+const int kAnyValueCreatedProgress = 70;
+
+int GetPercentage(std::size_t processed, std::size_t total)
+{
+  return total == 0 ? 100 : static_cast<int>(static_cast<double>(processed) / total * 100);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// ImportWaveformTask
+// ----------------------------------------------------------------------------
+
+ImportWaveformTask::ImportWaveformTask(std::string file_name, const WaveformFileOptions& options)
+    : m_file_name(std::move(file_name)), m_options(options)
+{
+}
+
+ImportWaveformTask::~ImportWaveformTask() = default;
+
+void ImportWaveformTask::Run(TaskContext& context)
+{
+  std::ifstream input(m_file_name, std::ios::binary | std::ios::ate);
+  if (!input)
+  {
+    m_error_message = "Can't open file '" + m_file_name + "'";
+    return;
+  }
+
+  const auto file_size = static_cast<std::size_t>(input.tellg());
+  input.seekg(0);
+
+  // parsing each chunk right after reading, only one chunk is kept in memory
+  const bool is_binary = m_options.format == WaveformFileFormat::kBinary;
+  WaveformCsvParser csv_parser(m_options);
+  WaveformBinaryParser binary_parser;
+  if (is_binary)
+  {
+    binary_parser.Reserve(file_size);
+  }
+  std::string chunk(std::min(kReadChunkSize, file_size), '\0');
+  std::size_t bytes_read{0};
+  while (bytes_read < file_size)
+  {
+    if (context.IsCancelled())
+    {
+      return;
+    }
+
+    const auto chunk_size = std::min(kReadChunkSize, file_size - bytes_read);
+    if (!input.read(chunk.data(), static_cast<std::streamsize>(chunk_size)))
+    {
+      m_error_message = "Can't read file '" + m_file_name + "'";
+      return;
+    }
+
+    if (is_binary)
+    {
+      binary_parser.Feed(chunk.data(), chunk_size);
+    }
+    else if (!csv_parser.Feed(chunk.data(), chunk_size))
+    {
+      break;
+    }
+
+    bytes_read += chunk_size;
+    context.ReportProgress(GetPercentage(bytes_read, file_size));
+  }
+
+  const bool is_valid = is_binary ? binary_parser.Finish() : csv_parser.Finish();
+  if (!is_valid)
+  {
+    const auto details = is_binary ? binary_parser.GetErrorMessage() : csv_parser.GetErrorMessage();
+    m_error_message = "Can't parse waveform file '" + m_file_name + "': " + details;
+    return;
+  }
+
+  m_waveform = is_binary ? binary_parser.TakeBuffer() : csv_parser.TakeBuffer();
+  context.ReportProgress(100);
+}
+
+std::string ImportWaveformTask::GetFileName() const
+{
+  return m_file_name;
+}
+
+std::string ImportWaveformTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+WaveformBuffer ImportWaveformTask::TakeWaveform()
+{
+  return std::move(m_waveform);
+}
+
+// ----------------------------------------------------------------------------
+// ExportWaveformTask
+// ----------------------------------------------------------------------------
+
+ExportWaveformTask::ExportWaveformTask(WaveformBuffer waveform, std::string file_name,
+                                       const WaveformFileOptions& options)
+    : m_waveform(std::move(waveform)), m_file_name(std::move(file_name)), m_options(options)
+{
+}
+
+ExportWaveformTask::~ExportWaveformTask() = default;
+
+void ExportWaveformTask::Run(TaskContext& context)
+{
+  const std::string temp_file_name = m_file_name + ".part";
+  {
+    std::ofstream output(temp_file_name, std::ios::binary | std::ios::trunc);
+    std::string content;
+    std::size_t point_index{0};
+    while (output && point_index < m_waveform.GetSize() && !context.IsCancelled())
+    {
+      const auto end_index = std::min(point_index + kWritePointCount, m_waveform.GetSize());
+      content.clear();
+      AppendWaveformToFileContent(m_waveform, point_index, end_index, m_options, content);
+      (void)output.write(content.data(), static_cast<std::streamsize>(content.size()));
+      point_index = end_index;
+      context.ReportProgress(GetPercentage(point_index, m_waveform.GetSize()));
+    }
+    output.close();
+
+    if (!output)
+    {
+      m_error_message = "Can't write file '" + m_file_name + "'";
+    }
+  }
+
+  // replacing the target only with the complete content
+  if (!m_error_message.empty() || context.IsCancelled())
+  {
+    (void)std::remove(temp_file_name.c_str());
+    return;
+  }
+
+  if (std::rename(temp_file_name.c_str(), m_file_name.c_str()) != 0)
+  {
+    (void)std::remove(temp_file_name.c_str());
+    m_error_message = "Can't write file '" + m_file_name + "'";
+  }
+}
+
+std::string ExportWaveformTask::GetFileName() const
+{
+  return m_file_name;
+}
+
+std::string ExportWaveformTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+// ----------------------------------------------------------------------------
+// ExportResampledWaveformsTask
+// ----------------------------------------------------------------------------
+
+ExportResampledWaveformsTask::ExportResampledWaveformsTask(std::vector<WaveformBuffer> waveforms,
+                                                           std::vector<std::string> names,
+                                                           std::string file_name,
+                                                           const WaveformResamplingOptions& options)
+    : m_waveforms(std::move(waveforms))
+    , m_names(std::move(names))
+    , m_file_name(std::move(file_name))
+    , m_options(options)
+{
+}
+
+ExportResampledWaveformsTask::~ExportResampledWaveformsTask() = default;
+
+void ExportResampledWaveformsTask::Run(TaskContext& context)
+{
+  std::unique_ptr<ExportAnyValueTask> export_task;
+  try
+  {
+    const auto time_base = m_options.dt > 0.0 ? CreateUniformTimeBase(m_waveforms, m_options.dt)
+                                              : CreateMergedTimeBase(m_waveforms);
+    if (context.IsCancelled())
+    {
+      return;
+    }
+
+    ThreadPool thread_pool(m_options.thread_count);
+    const auto values =
+        ResampleWaveformsOnTimeBase(m_waveforms, time_base, m_options.mode, &thread_pool);
+    context.ReportProgress(kResampledProgress);
+    if (context.IsCancelled())
+    {
+      return;
+    }
+
+    export_task = std::make_unique<ExportAnyValueTask>(
+        CreateResampledAnyValue(time_base, m_names, values), m_file_name);
+    context.ReportProgress(kAnyValueCreatedProgress);
+  }
+  catch (const std::exception& ex)
+  {
+    m_error_message = std::string("Can't resample waveforms: ") + ex.what();
+    return;
+  }
+
+  // writing is reported in the remaining range of the progress
+  TaskContext write_context(context.GetCancellationToken(),
+                            [&context](int progress)
+                            {
+                              context.ReportProgress(kAnyValueCreatedProgress
+                                                     + progress * (100 - kAnyValueCreatedProgress)
+                                                           / 100);
+                            });
+  export_task->Run(write_context);
+  m_error_message = export_task->GetErrorMessage();
+}
+
+std::string ExportResampledWaveformsTask::GetFileName() const
+{
+  return m_file_name;
+}
+
+std::string ExportResampledWaveformsTask::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_COMPONENTS_WAVEFORM_FILE_TASKS_H_
+#define SUP_GUI_COMPONENTS_WAVEFORM_FILE_TASKS_H_
+
+//! @file
+//! Tasks to import and export waveforms from/to CSV and binary files in a background thread.
+
+#include <sup/gui/plotting/waveform_file_utils.h>
+#include <sup/gui/plotting/waveform_resampling.h>
+#include <sup/gui/tasks/i_task.h>
+
+#include <string>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ImportWaveformTask class reads CSV or binary file with waveform points.
+ *
+ * The file is read and parsed chunk by chunk, reading is reported as a progress by bytes read.
+ * The task doesn't touch any model, points should be taken and inserted in the model in the GUI
+ * thread. Errors don't throw, they are reported by the error message.
+ */
+class ImportWaveformTask : public ITask
+{
+public:
+  ImportWaveformTask(std::string file_name, const WaveformFileOptions& options);
+  ~ImportWaveformTask() override;
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the name of the file to import.
+   */
+  std::string GetFileName() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+  /**
+   * @brief Takes waveform points read from the file.
+   */
+  WaveformBuffer TakeWaveform();
+
+private:
+  std::string m_file_name;
+  WaveformFileOptions m_options;
+  std::string m_error_message;
+  WaveformBuffer m_waveform;
+};
+
+/**
+ * @brief The ExportWaveformTask class writes waveform points to CSV or binary file.
+ *
+ * Points are formatted and written chunk by chunk to a temporary file, which replaces the target
+ * file only when complete. A cancelled or failed run leaves the target file untouched.
+ */
+class ExportWaveformTask : public ITask
+{
+public:
+  ExportWaveformTask(WaveformBuffer waveform, std::string file_name,
+                     const WaveformFileOptions& options);
+  ~ExportWaveformTask() override;
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the name of the file to export.
+   */
+  std::string GetFileName() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+private:
+  WaveformBuffer m_waveform;
+  std::string m_file_name;
+  WaveformFileOptions m_options;
+  std::string m_error_message;
+};
+
+/**
+ * @brief The ExportResampledWaveformsTask class resamples waveforms on a common time base and
+ * writes them to JSON file as a single AnyValue struct of arrays.
+ *
+ * Waveforms are evaluated in parallel in a thread pool owned by the task. The struct has "time"
+ * field with the time base, and a field with values of each waveform named after it.
+ */
+class ExportResampledWaveformsTask : public ITask
+{
+public:
+  ExportResampledWaveformsTask(std::vector<WaveformBuffer> waveforms,
+                               std::vector<std::string> names, std::string file_name,
+                               const WaveformResamplingOptions& options);
+  ~ExportResampledWaveformsTask() override;
+
+  void Run(TaskContext& context) override;
+
+  /**
+   * @brief Returns the name of the file to export.
+   */
+  std::string GetFileName() const;
+
+  /**
+   * @brief Returns an error message, or empty string if the run was successful.
+   */
+  std::string GetErrorMessage() const;
+
+private:
+  std::vector<WaveformBuffer> m_waveforms;
+  std::vector<std::string> m_names;
+  std::string m_file_name;
+  WaveformResamplingOptions m_options;
+  std::string m_error_message;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_COMPONENTS_WAVEFORM_FILE_TASKS_H_
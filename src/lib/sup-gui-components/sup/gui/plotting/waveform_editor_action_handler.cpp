@@ -22,16 +22,78 @@
 
 #include "waveform_editor_context.h"
 #include "waveform_helper.h"
+#include "waveform_point_lookup.h"
 
 #include <mvvm/model/i_session_model.h>
 #include <mvvm/model/item_utils.h>
+#include <mvvm/model/model_utils.h>
+#include <mvvm/model/tagindex.h>
+#include <mvvm/signals/event_types.h>
+#include <mvvm/signals/model_listener.h>
 #include <mvvm/standarditems/line_series_data_item.h>
 #include <mvvm/standarditems/line_series_item.h>
 #include <mvvm/standarditems/point_item.h>
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Returns buffer with points ordered by x, points with equal x keep their order.
+ */
+WaveformBuffer SortByX(const WaveformBuffer &buffer)
+{
+  if (std::is_sorted(buffer.x.begin(), buffer.x.end()))
+  {
+    return buffer;
+  }
+
+  std::vector<std::size_t> order(buffer.GetSize());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&buffer](auto lhs, auto rhs) { return buffer.x[lhs] < buffer.x[rhs]; });
+
+  WaveformBuffer result;
+  result.x.reserve(order.size());
+  result.y.reserve(order.size());
+  for (auto index : order)
+  {
+    result.x.push_back(buffer.x[index]);
+    result.y.push_back(buffer.y[index]);
+  }
+  return result;
+}
+
+/**
+ * @brief Checks if x values of all points, except the given one, are in non-descending order.
+ */
+bool IsSortedByXExcept(const mvvm::LineSeriesDataItem &data_item, const mvvm::PointItem &point)
+{
+  const mvvm::PointItem *previous{nullptr};
+  for (int index = 0; index < data_item.GetPointCount(); ++index)
+  {
+    auto current = data_item.GetPoint(index);
+    if (current == &point)
+    {
+      continue;
+    }
+    if (previous && current->GetX() < previous->GetX())
+    {
+      return false;
+    }
+    previous = current;
+  }
+  return true;
+}
+
+}  // namespace
+
 WaveformEditorActionHandler::WaveformEditorActionHandler(WaveformEditorContext context,
                                                          QObject *parent_object)
     : QObject(parent_object), m_context(context)
@@ -47,7 +109,7 @@ void WaveformEditorActionHandler::OnAddColumnBeforeRequest()
     auto point_item = GetSelectedPoint();
     auto tag_index = point_item ? point_item->GetTagIndex() : mvvm::TagIndex::First();
     auto new_point_item = CreatePointToPrepend(*GetLineSeries()->GetDataItem(), point_item);
-    auto item = GetModel()->InsertItem(std::move(new_point_item), parent, tag_index);
+    auto item = InsertPointItem(std::move(new_point_item), tag_index);
     emit SelectItemRequest(item);
   }
 }
@@ -59,7 +121,7 @@ void WaveformEditorActionHandler::OnAddColumnAfterRequest()
     auto point_item = GetSelectedPoint();
     auto tag_index = point_item ? point_item->GetTagIndex().Next() : mvvm::TagIndex::Append();
     auto new_point_item = CreatePointToAppend(*GetLineSeries()->GetDataItem(), point_item);
-    auto item = GetModel()->InsertItem(std::move(new_point_item), parent, tag_index);
+    auto item = InsertPointItem(std::move(new_point_item), tag_index);
     emit SelectItemRequest(item);
   }
 }
@@ -74,6 +136,141 @@ void WaveformEditorActionHandler::OnRemoveColumnRequest()
   }
 }
 
+void WaveformEditorActionHandler::ApplyTransform(const waveform_transform_t &transform,
+                                                 const std::string &command_name)
+{
+  auto data_item = GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
+  if (!data_item || !transform)
+  {
+    return;
+  }
+
+  auto buffer = CreateWaveformBuffer(data_item->GetWaveform());
+  auto [begin, end] = GetSelectedRange(buffer.GetSize());
+  transform(buffer, begin, end);
+
+  mvvm::utils::BeginMacro(*GetModel(), command_name);
+  WriteWaveform(m_sorted_mode ? SortByX(buffer) : buffer);
+  mvvm::utils::EndMacro(*GetModel());
+}
+
+void WaveformEditorActionHandler::ReplaceWaveform(const WaveformBuffer &buffer,
+                                                  const std::string &command_name)
+{
+  if (!GetParent())
+  {
+    return;
+  }
+
+  mvvm::utils::BeginMacro(*GetModel(), command_name);
+  WriteWaveform(m_sorted_mode ? SortByX(buffer) : buffer);
+  mvvm::utils::EndMacro(*GetModel());
+}
+
+bool WaveformEditorActionHandler::IsSortedMode() const
+{
+  return m_sorted_mode;
+}
+
+void WaveformEditorActionHandler::SetSortedMode(bool value)
+{
+  m_sorted_mode = value;
+  m_sorted_data_item = nullptr;
+
+  auto data_item = GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
+  if (!m_sorted_mode || !data_item || IsSortedByX(*data_item))
+  {
+    return;
+  }
+
+  mvvm::utils::BeginMacro(*GetModel(), "Sort points");
+  WriteWaveform(SortByX(CreateWaveformBuffer(data_item->GetWaveform())));
+  mvvm::utils::EndMacro(*GetModel());
+}
+
+void WaveformEditorActionHandler::InsertPoint(double x, double y)
+{
+  if (GetParent())
+  {
+    auto new_point_item = std::make_unique<mvvm::PointItem>();
+    new_point_item->SetX(x);
+    new_point_item->SetY(y);
+    auto item = InsertPointItem(std::move(new_point_item), mvvm::TagIndex::Append());
+    emit SelectItemRequest(item);
+  }
+}
+
+mvvm::PointItem *WaveformEditorActionHandler::FindNearestPoint(double x)
+{
+  auto data_item = GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
+  if (!data_item || data_item->GetPointCount() == 0)
+  {
+    return nullptr;
+  }
+
+  if (HasSortedPoints(*data_item))
+  {
+    return data_item->GetPoint(FindNearestPointIndex(*data_item, x));
+  }
+
+  mvvm::PointItem *result{nullptr};
+  for (int index = 0; index < data_item->GetPointCount(); ++index)
+  {
+    auto point = data_item->GetPoint(index);
+    if (!result || std::abs(point->GetX() - x) < std::abs(result->GetX() - x))
+    {
+      result = point;
+    }
+  }
+  return result;
+}
+
+std::vector<mvvm::PointItem *> WaveformEditorActionHandler::FindPointsInRange(double x_min,
+                                                                              double x_max)
+{
+  std::vector<mvvm::PointItem *> result;
+  auto data_item = GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
+  if (!data_item)
+  {
+    return result;
+  }
+
+  auto [begin, end] = HasSortedPoints(*data_item) ? FindPointRangeByX(*data_item, x_min, x_max)
+                                                  : std::make_pair(0, data_item->GetPointCount());
+  for (int index = begin; index < end; ++index)
+  {
+    auto point = data_item->GetPoint(index);
+    if (point->GetX() >= x_min && point->GetX() <= x_max)
+    {
+      result.push_back(point);
+    }
+  }
+  return result;
+}
+
+void WaveformEditorActionHandler::RestoreSortedOrder(mvvm::PointItem &point)
+{
+  auto data_item = GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
+  if (!m_sorted_mode || !data_item || point.GetParent() != data_item)
+  {
+    return;
+  }
+
+  // other points are out of order too, e.g. after undo of the sorting, there is no place to find
+  if (!IsSortedByXExcept(*data_item, point))
+  {
+    return;
+  }
+
+  const auto tag_index = point.GetTagIndex();
+  const int position = FindSortedPosition(*data_item, point);
+  if (position != tag_index.GetIndex())
+  {
+    GetModel()->MoveItem(&point, data_item, {tag_index.GetTag(), position});
+    emit SelectItemRequest(&point);
+  }
+}
+
 mvvm::ISessionModel *WaveformEditorActionHandler::GetModel()
 {
   return GetLineSeries() ? GetLineSeries()->GetModel() : nullptr;
@@ -94,4 +291,143 @@ mvvm::SessionItem *WaveformEditorActionHandler::GetParent()
   return GetLineSeries() ? GetLineSeries()->GetDataItem() : nullptr;
 }
 
+std::pair<std::size_t, std::size_t> WaveformEditorActionHandler::GetSelectedRange(
+    std::size_t point_count)
+{
+  std::vector<mvvm::PointItem *> selected_points;
+  if (m_context.selected_points_callback)
+  {
+    selected_points = m_context.selected_points_callback();
+  }
+
+  // points of other waveforms are ignored
+  auto data_item = GetParent();
+  (void)selected_points.erase(
+      std::remove_if(selected_points.begin(), selected_points.end(),
+                     [data_item](auto point) { return !point || point->GetParent() != data_item; }),
+      selected_points.end());
+
+  if (selected_points.size() < 2)
+  {
+    return {0, point_count};
+  }
+
+  auto [min_point, max_point] = std::minmax_element(
+      selected_points.begin(), selected_points.end(), [](auto lhs, auto rhs)
+      { return lhs->GetTagIndex().GetIndex() < rhs->GetTagIndex().GetIndex(); });
+  const auto begin = static_cast<std::size_t>((*min_point)->GetTagIndex().GetIndex());
+  const auto end = static_cast<std::size_t>((*max_point)->GetTagIndex().GetIndex()) + 1;
+  return {std::min(begin, point_count), std::min(end, point_count)};
+}
+
+void WaveformEditorActionHandler::WriteWaveform(const WaveformBuffer &buffer)
+{
+  auto data_item = GetLineSeries()->GetDataItem();
+
+  if (static_cast<std::size_t>(data_item->GetPointCount()) != buffer.GetSize())
+  {
+    data_item->SetWaveform(GetWaveformPoints(buffer));
+    return;
+  }
+
+  // same number of points, only changed coordinates produce commands
+  for (std::size_t index = 0; index < buffer.GetSize(); ++index)
+  {
+    auto point = data_item->GetPoint(static_cast<int>(index));
+    if (point->GetX() != buffer.x[index])
+    {
+      point->SetX(buffer.x[index]);
+    }
+    if (point->GetY() != buffer.y[index])
+    {
+      point->SetY(buffer.y[index]);
+    }
+  }
+}
+
+void WaveformEditorActionHandler::ListenModel(mvvm::ISessionModel *model)
+{
+  if (!model || model == m_listened_model)
+  {
+    return;
+  }
+
+  m_listened_model = model;
+  m_listener = std::make_unique<mvvm::ModelListener>(model);
+  m_listener->Connect<mvvm::DataChangedEvent>(
+      [this](const auto &event)
+      {
+        // only x values define the order
+        auto point = event.item->GetParent();
+        if (point && point->GetParent() == m_sorted_data_item
+            && event.item == point->GetItem(mvvm::PointItem::kX))
+        {
+          m_sorted_data_item = nullptr;
+        }
+      });
+  m_listener->Connect<mvvm::ItemInsertedEvent>(
+      [this](const auto &event)
+      {
+        // points inserted by the handler itself are placed according to their x values
+        if (event.item == m_sorted_data_item && !m_is_sorted_insert)
+        {
+          m_sorted_data_item = nullptr;
+        }
+      });
+  m_listener->Connect<mvvm::AboutToRemoveItemEvent>(
+      [this](const auto &event)
+      {
+        // removal of points keeps the order, but the data item itself might be removed
+        auto removed = event.item->GetItem(event.tag_index);
+        if (removed == m_sorted_data_item
+            || mvvm::utils::IsItemAncestor(m_sorted_data_item, removed))
+        {
+          m_sorted_data_item = nullptr;
+        }
+      });
+  m_listener->Connect<mvvm::ModelAboutToBeResetEvent>([this](const auto &)
+                                                      { m_sorted_data_item = nullptr; });
+}
+
+mvvm::SessionItem *WaveformEditorActionHandler::InsertPointItem(
+    std::unique_ptr<mvvm::PointItem> new_point, const mvvm::TagIndex &default_tag_index)
+{
+  auto data_item = GetLineSeries()->GetDataItem();
+  if (!HasSortedPoints(*data_item))
+  {
+    return GetModel()->InsertItem(std::move(new_point), data_item, default_tag_index);
+  }
+
+  // points stay sorted, the knowledge about it is kept
+  const auto tag_index = mvvm::TagIndex::Default(FindInsertIndexByX(*data_item, new_point->GetX()));
+  m_is_sorted_insert = true;
+  auto result = GetModel()->InsertItem(std::move(new_point), data_item, tag_index);
+  m_is_sorted_insert = false;
+  return result;
+}
+
+bool WaveformEditorActionHandler::HasSortedPoints(const mvvm::LineSeriesDataItem &data_item)
+{
+  if (!m_sorted_mode)
+  {
+    return false;
+  }
+
+  if (m_sorted_data_item == &data_item)
+  {
+    return true;
+  }
+
+  if (!IsSortedByX(data_item))
+  {
+    return false;
+  }
+
+  // the result is remembered only while there is a model to report changes
+  auto model = data_item.GetModel();
+  ListenModel(model);
+  m_sorted_data_item = model ? &data_item : nullptr;
+  return true;
+}
+
 }  // namespace sup::gui
@@ -22,13 +22,22 @@
 #define SUP_GUI_PLOTTING_WAVEFORM_EDITOR_ACTION_HANDLER_H_
 
 #include <sup/gui/plotting/waveform_editor_context.h>
+#include <sup/gui/plotting/waveform_transforms.h>
 
 #include <QObject>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace mvvm
 {
 class ISessionModel;
+class LineSeriesDataItem;
+class ModelListener;
+class PointItem;
 class SessionItem;
+class TagIndex;
 }  // namespace mvvm
 
 namespace sup::gui
@@ -52,6 +61,61 @@ public:
   void OnAddColumnAfterRequest();
   void OnRemoveColumnRequest();
 
+  /**
+   * @brief Applies the transform to the selected waveform as a single undoable command.
+   *
+   * The transform is applied to the range between first and last selected points, if more than one
+   * point is selected, and to the whole waveform otherwise.
+   */
+  void ApplyTransform(const waveform_transform_t& transform, const std::string& command_name);
+
+  /**
+   * @brief Replaces points of the selected waveform with the given ones as a single undoable
+   * command.
+   */
+  void ReplaceWaveform(const WaveformBuffer& buffer, const std::string& command_name);
+
+  /**
+   * @brief Returns true if points of the waveform are kept sorted by x.
+   */
+  bool IsSortedMode() const;
+
+  /**
+   * @brief Sets the mode when points of the waveform are kept sorted by x.
+   *
+   * In this mode new points are inserted at the position matching their x value, and lookups by x
+   * are binary searches. Switching the mode on sorts points of the current waveform as a single
+   * undoable command, if they are not sorted yet. Waveforms selected later are not sorted
+   * implicitly, lookups fall back to linear search while their points are out of order.
+   */
+  void SetSortedMode(bool value);
+
+  /**
+   * @brief Inserts new point with the given coordinates and requests its selection.
+   *
+   * In sorted mode the point is placed according to its x value, otherwise it is appended.
+   */
+  void InsertPoint(double x, double y);
+
+  /**
+   * @brief Returns the point with x value closest to the given one, or nullptr if there are no
+   * points.
+   */
+  mvvm::PointItem* FindNearestPoint(double x);
+
+  /**
+   * @brief Returns points with x values inside [x_min, x_max] interval in the order of the
+   * waveform.
+   */
+  std::vector<mvvm::PointItem*> FindPointsInRange(double x_min, double x_max);
+
+  /**
+   * @brief Moves the point to restore the order of points after its x value was changed.
+   *
+   * Does nothing if the point is in place already, or the handler isn't in sorted mode.
+   */
+  void RestoreSortedOrder(mvvm::PointItem& point);
+
 signals:
   void SelectItemRequest(mvvm::SessionItem* item);
 
@@ -62,7 +126,48 @@ private:
 
   mvvm::SessionItem* GetParent();
 
+  /**
+   * @brief Returns the range of selected points [begin, end) in the waveform of given size.
+   */
+  std::pair<std::size_t, std::size_t> GetSelectedRange(std::size_t point_count);
+
+  /**
+   * @brief Checks if points can be looked up by binary search, i.e. sorted mode is on and points
+   * are actually sorted.
+   *
+   * @details Points might be out of order in sorted mode after undo of the sorting. The check walks
+   * over all points, its result is kept until x value of a point changes, or a point is inserted
+   * by other means than the handler itself.
+   */
+  bool HasSortedPoints(const mvvm::LineSeriesDataItem& data_item);
+
+  /**
+   * @brief Writes buffer to the waveform, unchanged points are kept untouched.
+   */
+  void WriteWaveform(const WaveformBuffer& buffer);
+
+  /**
+   * @brief Inserts the new point into the current waveform and returns it.
+   *
+   * When points are sorted, the point is placed according to its x value, otherwise at the
+   * given tag index.
+   */
+  mvvm::SessionItem* InsertPointItem(std::unique_ptr<mvvm::PointItem> new_point,
+                                     const mvvm::TagIndex& default_tag_index);
+
+  /**
+   * @brief Creates the listener to track changes of the given model, if not created yet.
+   */
+  void ListenModel(mvvm::ISessionModel* model);
+
   WaveformEditorContext m_context;
+  bool m_sorted_mode{false};
+
+  //!< data item known to have sorted points, reset on changes which might break the order
+  const mvvm::LineSeriesDataItem* m_sorted_data_item{nullptr};
+  bool m_is_sorted_insert{false};  //!< the handler inserts a point at its sorted place
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  mvvm::ISessionModel* m_listened_model{nullptr};
 };
 
 }  // namespace sup::gui
@@ -22,6 +22,7 @@
 #define SUP_GUI_PLOTTING_WAVEFORM_EDITOR_CONTEXT_H_
 
 #include <functional>
+#include <vector>
 
 namespace mvvm
 {
@@ -42,6 +43,9 @@ struct WaveformEditorContext
 
   //!< callback to retrieve currently selected AnyValueItem representing a point
   std::function<mvvm::PointItem*()> selected_point_callback;
+
+  //!< optional callback to retrieve all selected points, defines the range of bulk transforms
+  std::function<std::vector<mvvm::PointItem*>()> selected_points_callback;
 };
 
 }  // namespace sup::gui
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_envelope.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+std::pair<double, double> Merge(const std::pair<double, double>& lhs,
+                                const std::pair<double, double>& rhs)
+{
+  return {std::min(lhs.first, rhs.first), std::max(lhs.second, rhs.second)};
+}
+
+}  // namespace
+
+WaveformEnvelope::WaveformEnvelope(std::vector<double> y_values)
+    : m_values(std::move(y_values)), m_sum(std::accumulate(m_values.begin(), m_values.end(), 0.0))
+{
+  if (m_values.size() < 2)
+  {
+    return;
+  }
+
+  // the first level is built from points directly
+  std::vector<std::pair<double, double>> level;
+  level.reserve((m_values.size() + 1) / 2);
+  for (std::size_t index = 0; index < m_values.size(); index += 2)
+  {
+    const double value = m_values[index];
+    const double next = index + 1 < m_values.size() ? m_values[index + 1] : value;
+    level.emplace_back(std::min(value, next), std::max(value, next));
+  }
+  m_levels.push_back(std::move(level));
+
+  while (m_levels.back().size() > 1)
+  {
+    const auto& previous = m_levels.back();
+    std::vector<std::pair<double, double>> next_level;
+    next_level.reserve((previous.size() + 1) / 2);
+    for (std::size_t index = 0; index < previous.size(); index += 2)
+    {
+      next_level.push_back(index + 1 < previous.size() ? Merge(previous[index], previous[index + 1])
+                                                       : previous[index]);
+    }
+    m_levels.push_back(std::move(next_level));
+  }
+}
+
+std::size_t WaveformEnvelope::GetSize() const
+{
+  return m_values.size();
+}
+
+std::size_t WaveformEnvelope::GetLevelCount() const
+{
+  return m_values.empty() ? 0 : m_levels.size() + 1;
+}
+
+WaveformStatistics WaveformEnvelope::GetStatistics() const
+{
+  if (m_values.empty())
+  {
+    return {};
+  }
+
+  const auto [min_y, max_y] = GetMinMax(0, m_values.size());
+  return {m_values.size(), min_y, max_y, m_sum / static_cast<double>(m_values.size())};
+}
+
+std::pair<double, double> WaveformEnvelope::GetMinMax(std::size_t begin, std::size_t end) const
+{
+  if (begin >= end || end > m_values.size())
+  {
+    throw RuntimeException("Invalid range of waveform points");
+  }
+
+  std::pair<double, double> result{m_values[begin], m_values[begin]};
+
+  // odd boundaries at the level of points are taken as they are
+  if (begin % 2 == 1)
+  {
+    result = Merge(result, {m_values[begin], m_values[begin]});
+    ++begin;
+  }
+  if (end % 2 == 1 && begin < end)
+  {
+    --end;
+    result = Merge(result, {m_values[end], m_values[end]});
+  }
+
+  // every level above covers pairs of nodes of the level below
+  begin /= 2;
+  end /= 2;
+  for (std::size_t level = 0; begin < end; ++level)
+  {
+    const auto& nodes = m_levels[level];
+    if (begin % 2 == 1)
+    {
+      result = Merge(result, nodes[begin++]);
+    }
+    if (end % 2 == 1)
+    {
+      result = Merge(result, nodes[--end]);
+    }
+    begin /= 2;
+    end /= 2;
+  }
+  return result;
+}
+
+std::vector<std::pair<double, double>> WaveformEnvelope::CreateOverview(
+    std::size_t bin_count) const
+{
+  bin_count = std::min(bin_count, m_values.size());
+
+  std::vector<std::pair<double, double>> result;
+  result.reserve(bin_count);
+  for (std::size_t bin = 0; bin < bin_count; ++bin)
+  {
+    const std::size_t begin = bin * m_values.size() / bin_count;
+    const std::size_t end = (bin + 1) * m_values.size() / bin_count;
+    result.push_back(GetMinMax(begin, end));
+  }
+  return result;
+}
+
+void WaveformEnvelope::SetValue(std::size_t index, double value)
+{
+  if (index >= m_values.size())
+  {
+    throw RuntimeException("Index of waveform point is out of range");
+  }
+
+  m_sum += value - m_values[index];
+  m_values[index] = value;
+
+  // nodes are recalculated from their children up to the top
+  std::size_t node = index / 2;
+  for (std::size_t level = 0; level < m_levels.size(); ++level)
+  {
+    auto& nodes = m_levels[level];
+    std::pair<double, double> updated;
+    if (level == 0)
+    {
+      const std::size_t first = node * 2;
+      const double next = first + 1 < m_values.size() ? m_values[first + 1] : m_values[first];
+      updated = {std::min(m_values[first], next), std::max(m_values[first], next)};
+    }
+    else
+    {
+      const auto& children = m_levels[level - 1];
+      const std::size_t first = node * 2;
+      updated = first + 1 < children.size() ? Merge(children[first], children[first + 1])
+                                            : children[first];
+    }
+
+    if (nodes[node] == updated)
+    {
+      return;
+    }
+    nodes[node] = updated;
+    node /= 2;
+  }
+}
+
+}  // namespace sup::gui
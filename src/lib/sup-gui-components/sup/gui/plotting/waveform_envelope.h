@@ -0,0 +1,100 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformStatistics struct holds summary of waveform y values.
+ */
+struct WaveformStatistics
+{
+  std::size_t count{0};
+  double min_y{0.0};
+  double max_y{0.0};
+  double mean_y{0.0};
+};
+
+/**
+ * @brief The WaveformEnvelope class is a multi-resolution min/max pyramid of waveform y values.
+ *
+ * Level zero holds y values themselves, every next level holds min/max of pairs of nodes of the
+ * previous one. Minimum and maximum of any range of points is found in O(log N), an overview of
+ * the whole waveform with K bins costs O(K log N) regardless of the number of points.
+ *
+ * A change of a single value is propagated in O(log N), insertion or removal of points requires
+ * a new envelope.
+ */
+class WaveformEnvelope
+{
+public:
+  WaveformEnvelope() = default;
+
+  explicit WaveformEnvelope(std::vector<double> y_values);
+
+  /**
+   * @brief Returns the number of points.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Returns the number of pyramid levels, including the level of points.
+   */
+  std::size_t GetLevelCount() const;
+
+  WaveformStatistics GetStatistics() const;
+
+  /**
+   * @brief Returns minimum and maximum of y values of points [begin, end).
+   *
+   * @details Will throw if the range is empty or exceeds the number of points.
+   */
+  std::pair<double, double> GetMinMax(std::size_t begin, std::size_t end) const;
+
+  /**
+   * @brief Splits points into the given number of bins of equal width and returns minimum and
+   * maximum of every bin.
+   *
+   * The number of bins is limited by the number of points.
+   */
+  std::vector<std::pair<double, double>> CreateOverview(std::size_t bin_count) const;
+
+  /**
+   * @brief Sets y value of the point with the given index.
+   */
+  void SetValue(std::size_t index, double value);
+
+private:
+  //! minimum and maximum of the nodes of every level above the level of points
+  std::vector<std::vector<std::pair<double, double>>> m_levels;
+  std::vector<double> m_values;
+  double m_sum{0.0};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_H_
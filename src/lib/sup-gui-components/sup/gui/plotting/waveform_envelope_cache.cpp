@@ -0,0 +1,166 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_envelope_cache.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/model/tagindex.h>
+#include <mvvm/signals/model_listener.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+namespace sup::gui
+{
+
+WaveformEnvelopeCache::WaveformEnvelopeCache(mvvm::ISessionModel* model, QObject* parent_object)
+    : QObject(parent_object), m_model(model)
+{
+  if (!m_model)
+  {
+    throw NullArgumentException("WaveformEnvelopeCache: model is not initialised");
+  }
+
+  m_listener = std::make_unique<mvvm::ModelListener>(m_model);
+  m_listener->Connect<mvvm::ItemInsertedEvent>(this, &WaveformEnvelopeCache::OnModelEvent);
+  m_listener->Connect<mvvm::AboutToRemoveItemEvent>(this, &WaveformEnvelopeCache::OnModelEvent);
+  m_listener->Connect<mvvm::ItemRemovedEvent>(this, &WaveformEnvelopeCache::OnModelEvent);
+  m_listener->Connect<mvvm::DataChangedEvent>(this, &WaveformEnvelopeCache::OnModelEvent);
+  m_listener->Connect<mvvm::ModelAboutToBeResetEvent>(this, &WaveformEnvelopeCache::OnModelEvent);
+}
+
+WaveformEnvelopeCache::~WaveformEnvelopeCache() = default;
+
+mvvm::ISessionModel* WaveformEnvelopeCache::GetModel() const
+{
+  return m_model;
+}
+
+const WaveformEnvelope* WaveformEnvelopeCache::FindEnvelope(
+    const mvvm::SessionItem* data_item) const
+{
+  auto iter = m_envelopes.find(data_item);
+  return iter == m_envelopes.end() ? nullptr : &iter->second.envelope;
+}
+
+const WaveformEnvelope& WaveformEnvelopeCache::GetEnvelope(
+    const mvvm::LineSeriesDataItem& data_item)
+{
+  if (auto envelope = FindEnvelope(&data_item); envelope)
+  {
+    return *envelope;
+  }
+
+  const auto points = data_item.GetWaveform();
+  std::vector<double> y_values;
+  y_values.reserve(points.size());
+  for (const auto& [x, y] : points)
+  {
+    y_values.push_back(y);
+  }
+  return InsertEnvelope(&data_item, WaveformEnvelope(std::move(y_values)));
+}
+
+const WaveformEnvelope& WaveformEnvelopeCache::InsertEnvelope(const mvvm::SessionItem* data_item,
+                                                              WaveformEnvelope envelope)
+{
+  auto& result = m_envelopes[data_item];
+  result = CacheEntry{std::move(envelope), {}};
+  return result.envelope;
+}
+
+std::size_t WaveformEnvelopeCache::GetSize() const
+{
+  return m_envelopes.size();
+}
+
+void WaveformEnvelopeCache::Clear()
+{
+  m_envelopes.clear();
+}
+
+void WaveformEnvelopeCache::OnModelEvent(const mvvm::ItemInsertedEvent& event)
+{
+  // new point shifts indices of all points after it
+  (void)m_envelopes.erase(event.item);
+}
+
+void WaveformEnvelopeCache::OnModelEvent(const mvvm::AboutToRemoveItemEvent& event)
+{
+  // data item itself, or one of its parents is about to be removed
+  auto removed_item = event.item->GetItem(event.tag_index);
+  for (auto iter = m_envelopes.begin(); iter != m_envelopes.end();)
+  {
+    const bool is_removed =
+        iter->first == removed_item || mvvm::utils::IsItemAncestor(iter->first, removed_item);
+    iter = is_removed ? m_envelopes.erase(iter) : ++iter;
+  }
+}
+
+void WaveformEnvelopeCache::OnModelEvent(const mvvm::ItemRemovedEvent& event)
+{
+  (void)m_envelopes.erase(event.item);
+}
+
+void WaveformEnvelopeCache::OnModelEvent(const mvvm::DataChangedEvent& event)
+{
+  // x and y values are properties of the point, only y matters
+  auto point = dynamic_cast<mvvm::PointItem*>(event.item->GetParent());
+  if (!point || !point->GetParent() || event.item != point->GetItem(mvvm::PointItem::kY))
+  {
+    return;
+  }
+
+  auto iter = m_envelopes.find(point->GetParent());
+  if (iter == m_envelopes.end())
+  {
+    return;
+  }
+
+  auto& [envelope, point_indices] = iter->second;
+  if (point_indices.empty())
+  {
+    // single pass over points, instead of a linear search of the point index on every change
+    const auto points = point->GetParent()->GetAllItems();
+    point_indices.reserve(points.size());
+    for (std::size_t index = 0; index < points.size(); ++index)
+    {
+      point_indices.emplace(points[index], index);
+    }
+  }
+
+  auto index_iter = point_indices.find(point);
+  if (index_iter == point_indices.end() || index_iter->second >= envelope.GetSize())
+  {
+    // values of the data item are kept outside of its points
+    return;
+  }
+  envelope.SetValue(index_iter->second, point->GetY());
+}
+
+void WaveformEnvelopeCache::OnModelEvent(const mvvm::ModelAboutToBeResetEvent& event)
+{
+  (void)event;
+  Clear();
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_CACHE_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_CACHE_H_
+
+#include <sup/gui/plotting/waveform_envelope.h>
+
+#include <mvvm/signals/event_types.h>
+
+#include <QObject>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace mvvm
+{
+class ISessionModel;
+class LineSeriesDataItem;
+class ModelListener;
+class SessionItem;
+}  // namespace mvvm
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformEnvelopeCache class keeps WaveformEnvelope of data items of the model.
+ *
+ * @details Envelopes are created on first request. The cache listens for the model: the change of
+ * y value of a point updates the envelope in place, insertion or removal of points drop the
+ * envelope of the data item, to be created again on the next request.
+ *
+ * Indices of points are resolved on the first change of y value of the data item, in a single pass
+ * over its points. Every following change costs O(log N), so bulk writes and interactive edits
+ * never rebuild the envelope during the repaint of the overview.
+ */
+class WaveformEnvelopeCache : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit WaveformEnvelopeCache(mvvm::ISessionModel* model, QObject* parent_object = nullptr);
+  ~WaveformEnvelopeCache() override;
+
+  mvvm::ISessionModel* GetModel() const;
+
+  /**
+   * @brief Returns the envelope of the given data item, if it is in the cache.
+   */
+  const WaveformEnvelope* FindEnvelope(const mvvm::SessionItem* data_item) const;
+
+  /**
+   * @brief Returns the envelope of y values of points of the given data item.
+   *
+   * The envelope is created, if it is not in the cache yet.
+   */
+  const WaveformEnvelope& GetEnvelope(const mvvm::LineSeriesDataItem& data_item);
+
+  /**
+   * @brief Stores the envelope for the given data item.
+   *
+   * Used when values of the data item are kept outside of its points. The envelope is dropped
+   * as usual, when points are inserted into the data item.
+   */
+  const WaveformEnvelope& InsertEnvelope(const mvvm::SessionItem* data_item,
+                                         WaveformEnvelope envelope);
+
+  /**
+   * @brief Returns the number of cached envelopes.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Removes all envelopes from the cache.
+   */
+  void Clear();
+
+private:
+  void OnModelEvent(const mvvm::ItemInsertedEvent& event);
+  void OnModelEvent(const mvvm::AboutToRemoveItemEvent& event);
+  void OnModelEvent(const mvvm::ItemRemovedEvent& event);
+  void OnModelEvent(const mvvm::DataChangedEvent& event);
+  void OnModelEvent(const mvvm::ModelAboutToBeResetEvent& event);
+
+  /**
+   * @brief The CacheEntry struct holds the envelope of a data item together with indices of its
+   * points.
+   */
+  struct CacheEntry
+  {
+    WaveformEnvelope envelope;
+    //! indices of points in the data item, filled on the first change of y value
+    std::unordered_map<const mvvm::SessionItem*, std::size_t> point_indices;
+  };
+
+  mvvm::ISessionModel* m_model{nullptr};
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  std::map<const mvvm::SessionItem*, CacheEntry> m_envelopes;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_ENVELOPE_CACHE_H_
@@ -0,0 +1,429 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_file_utils.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The size of one binary point, two float64 values.
+ */
+const std::size_t kBinaryPointSize = 2 * sizeof(double);
+
+/**
+ * @brief Maximum length of the line fragment shown in the error message.
+ */
+const std::size_t kMaxLineExcerptLength = 64;
+
+bool IsLittleEndianHost()
+{
+  const std::uint16_t value{1};
+  unsigned char first_byte{0};
+  std::memcpy(&first_byte, &value, 1);
+  return first_byte == 1;
+}
+
+const bool kIsLittleEndianHost = IsLittleEndianHost();
+
+double ReadLittleEndianDouble(const char* bytes)
+{
+  std::array<char, sizeof(double)> value_bytes{};
+  std::memcpy(value_bytes.data(), bytes, sizeof(double));
+  if (!kIsLittleEndianHost)
+  {
+    std::reverse(value_bytes.begin(), value_bytes.end());
+  }
+  double result{0.0};
+  std::memcpy(&result, value_bytes.data(), sizeof(double));
+  return result;
+}
+
+void AppendLittleEndianDouble(double value, std::string& output)
+{
+  std::array<char, sizeof(double)> value_bytes{};
+  std::memcpy(value_bytes.data(), &value, sizeof(double));
+  if (!kIsLittleEndianHost)
+  {
+    std::reverse(value_bytes.begin(), value_bytes.end());
+  }
+  (void)output.append(value_bytes.data(), value_bytes.size());
+}
+
+bool IsBlank(char ch)
+{
+  return ch == ' ' || ch == '\t';
+}
+
+/**
+ * @brief Parses the whole field into the value, surrounding blanks are allowed.
+ */
+bool ParseField(const char* begin, const char* end, double& value)
+{
+  while (begin < end && IsBlank(*begin))
+  {
+    ++begin;
+  }
+  while (end > begin && IsBlank(*(end - 1)))
+  {
+    --end;
+  }
+
+  // from_chars doesn't accept leading plus sign
+  if (begin < end && *begin == '+')
+  {
+    ++begin;
+  }
+
+  if (begin == end)
+  {
+    return false;
+  }
+
+  auto [ptr, error_code] = std::from_chars(begin, end, value);
+  return error_code == std::errc() && ptr == end;
+}
+
+std::string GetLineExcerpt(const char* begin, const char* end)
+{
+  const auto length = static_cast<std::size_t>(end - begin);
+  std::string result(begin, std::min(length, kMaxLineExcerptLength));
+  return length > kMaxLineExcerptLength ? result + "..." : result;
+}
+
+std::string GetLowerCaseExtension(const std::string& file_name)
+{
+  const auto pos = file_name.find_last_of("./\\");
+  if (pos == std::string::npos || file_name[pos] != '.')
+  {
+    return {};
+  }
+
+  auto result = file_name.substr(pos);
+  std::transform(result.begin(), result.end(), result.begin(),
+                 [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+  return result;
+}
+
+}  // namespace
+
+WaveformFileOptions GetWaveformFileOptions(const std::string& file_name)
+{
+  WaveformFileOptions result;
+
+  const auto extension = GetLowerCaseExtension(file_name);
+  if (extension == ".bin" || extension == ".raw" || extension == ".f64")
+  {
+    result.format = WaveformFileFormat::kBinary;
+  }
+  else if (extension == ".tsv")
+  {
+    result.delimiter = '\t';
+  }
+
+  return result;
+}
+
+// ----------------------------------------------------------------------------
+// WaveformCsvParser
+// ----------------------------------------------------------------------------
+
+WaveformCsvParser::WaveformCsvParser(const WaveformFileOptions& options) : m_options(options) {}
+
+bool WaveformCsvParser::Feed(const char* data, std::size_t size)
+{
+  if (!m_error_message.empty())
+  {
+    return false;
+  }
+
+  const char* pos = data;
+  const char* data_end = data + size;
+
+  // completing the line started in the previous chunk
+  if (!m_incomplete_line.empty())
+  {
+    auto line_end = static_cast<const char*>(std::memchr(pos, '\n', size));
+    if (!line_end)
+    {
+      (void)m_incomplete_line.append(pos, size);
+      return true;
+    }
+    (void)m_incomplete_line.append(pos, line_end);
+    if (!ParseLine(m_incomplete_line.data(), m_incomplete_line.data() + m_incomplete_line.size()))
+    {
+      return false;
+    }
+    m_incomplete_line.clear();
+    pos = line_end + 1;
+  }
+
+  while (pos < data_end)
+  {
+    auto line_end =
+        static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(data_end - pos)));
+    if (!line_end)
+    {
+      m_incomplete_line.assign(pos, data_end);
+      break;
+    }
+    if (!ParseLine(pos, line_end))
+    {
+      return false;
+    }
+    pos = line_end + 1;
+  }
+
+  return true;
+}
+
+bool WaveformCsvParser::Finish()
+{
+  if (!m_error_message.empty())
+  {
+    return false;
+  }
+
+  if (!m_incomplete_line.empty())
+  {
+    const std::string line = std::move(m_incomplete_line);
+    m_incomplete_line.clear();
+    return ParseLine(line.data(), line.data() + line.size());
+  }
+
+  return true;
+}
+
+std::string WaveformCsvParser::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+WaveformBuffer WaveformCsvParser::TakeBuffer()
+{
+  return std::move(m_buffer);
+}
+
+bool WaveformCsvParser::ParseLine(const char* begin, const char* end)
+{
+  ++m_line_number;
+
+  if (end > begin && *(end - 1) == '\r')
+  {
+    --end;
+  }
+
+  const char* pos = begin;
+  while (pos < end && IsBlank(*pos))
+  {
+    ++pos;
+  }
+  if (pos == end || *pos == '#')
+  {
+    return true;
+  }
+
+  // walking through fields, only x and y columns are parsed
+  const bool merge_delimiters = IsBlank(m_options.delimiter);
+  const std::size_t last_column = std::max(m_options.x_column, m_options.y_column);
+  double x{0.0};
+  double y{0.0};
+  std::size_t found_count{0};
+  std::size_t column{0};
+  const char* field_begin = merge_delimiters ? pos : begin;
+  while (column <= last_column)
+  {
+    auto field_end = merge_delimiters ? std::find_if(field_begin, end, IsBlank)
+                                      : std::find(field_begin, end, m_options.delimiter);
+
+    if (column == m_options.x_column)
+    {
+      found_count += ParseField(field_begin, field_end, x) ? 1 : 0;
+    }
+    if (column == m_options.y_column)
+    {
+      found_count += ParseField(field_begin, field_end, y) ? 1 : 0;
+    }
+
+    if (field_end == end)
+    {
+      break;
+    }
+    field_begin = field_end + 1;
+    if (merge_delimiters)
+    {
+      field_begin = std::find_if_not(field_begin, end, IsBlank);
+    }
+    ++column;
+  }
+
+  const std::size_t expected_count = m_options.x_column == m_options.y_column ? 1 : 2;
+  if (found_count != expected_count)
+  {
+    if (m_header_allowed)
+    {
+      m_header_allowed = false;
+      return true;
+    }
+    m_error_message = "line " + std::to_string(m_line_number) + ": can't read x and y from '"
+                      + GetLineExcerpt(begin, end) + "'";
+    return false;
+  }
+
+  m_header_allowed = false;
+  m_buffer.x.push_back(x);
+  m_buffer.y.push_back(y);
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+// WaveformBinaryParser
+// ----------------------------------------------------------------------------
+
+void WaveformBinaryParser::Reserve(std::size_t total_size)
+{
+  m_buffer.x.reserve(total_size / kBinaryPointSize);
+  m_buffer.y.reserve(total_size / kBinaryPointSize);
+}
+
+void WaveformBinaryParser::Feed(const char* data, std::size_t size)
+{
+  // completing the point started in the previous chunk
+  if (!m_incomplete_point.empty())
+  {
+    const auto missing = std::min(kBinaryPointSize - m_incomplete_point.size(), size);
+    (void)m_incomplete_point.append(data, missing);
+    data += missing;
+    size -= missing;
+    if (m_incomplete_point.size() < kBinaryPointSize)
+    {
+      return;
+    }
+    AppendPoint(m_incomplete_point.data());
+    m_incomplete_point.clear();
+  }
+
+  const std::size_t point_count = size / kBinaryPointSize;
+  for (std::size_t index = 0; index < point_count; ++index)
+  {
+    AppendPoint(data + index * kBinaryPointSize);
+  }
+  m_incomplete_point.assign(data + point_count * kBinaryPointSize, size % kBinaryPointSize);
+}
+
+bool WaveformBinaryParser::Finish()
+{
+  if (!m_incomplete_point.empty())
+  {
+    m_error_message = "file size is not a multiple of " + std::to_string(kBinaryPointSize)
+                      + " bytes, the last point is incomplete";
+    return false;
+  }
+  return true;
+}
+
+std::string WaveformBinaryParser::GetErrorMessage() const
+{
+  return m_error_message;
+}
+
+WaveformBuffer WaveformBinaryParser::TakeBuffer()
+{
+  return std::move(m_buffer);
+}
+
+void WaveformBinaryParser::AppendPoint(const char* bytes)
+{
+  m_buffer.x.push_back(ReadLittleEndianDouble(bytes));
+  m_buffer.y.push_back(ReadLittleEndianDouble(bytes + sizeof(double)));
+}
+
+// ----------------------------------------------------------------------------
+// Free functions
+// ----------------------------------------------------------------------------
+
+void AppendWaveformToFileContent(const WaveformBuffer& buffer, std::size_t begin, std::size_t end,
+                                 const WaveformFileOptions& options, std::string& output)
+{
+  end = std::min(end, buffer.GetSize());
+  if (begin >= end)
+  {
+    return;
+  }
+
+  if (options.format == WaveformFileFormat::kBinary)
+  {
+    output.reserve(output.size() + (end - begin) * kBinaryPointSize);
+    for (std::size_t index = begin; index < end; ++index)
+    {
+      AppendLittleEndianDouble(buffer.x[index], output);
+      AppendLittleEndianDouble(buffer.y[index], output);
+    }
+    return;
+  }
+
+  // the longest shortest representation of double is 24 characters
+  std::array<char, 64> line{};
+  char* line_end = line.data() + line.size();
+  for (std::size_t index = begin; index < end; ++index)
+  {
+    auto pos = std::to_chars(line.data(), line_end, buffer.x[index]).ptr;
+    *pos++ = options.delimiter;
+    pos = std::to_chars(pos, line_end, buffer.y[index]).ptr;
+    *pos++ = '\n';
+    (void)output.append(line.data(), pos);
+  }
+}
+
+WaveformBuffer ParseWaveformFileContent(const std::string& content,
+                                        const WaveformFileOptions& options)
+{
+  if (options.format == WaveformFileFormat::kBinary)
+  {
+    WaveformBinaryParser parser;
+    parser.Feed(content.data(), content.size());
+    if (!parser.Finish())
+    {
+      throw RuntimeException("Can't parse binary waveform: " + parser.GetErrorMessage());
+    }
+    return parser.TakeBuffer();
+  }
+
+  WaveformCsvParser parser(options);
+  if (!parser.Feed(content.data(), content.size()) || !parser.Finish())
+  {
+    throw RuntimeException("Can't parse CSV waveform: " + parser.GetErrorMessage());
+  }
+  return parser.TakeBuffer();
+}
+
+}  // namespace sup::gui
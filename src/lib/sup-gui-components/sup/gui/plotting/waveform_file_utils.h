@@ -0,0 +1,175 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_FILE_UTILS_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_FILE_UTILS_H_
+
+//! @file
+//! Streaming parsers and writers of waveforms stored in CSV and raw binary files.
+
+#include <sup/gui/plotting/waveform_transforms.h>
+
+#include <cstddef>
+#include <string>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformFileFormat enum lists supported formats of waveform files.
+ */
+enum class WaveformFileFormat
+{
+  kCsv,    //!< text file, one point per line, values separated by delimiter
+  kBinary  //!< little-endian float64 values, interleaved as x0 y0 x1 y1 ...
+};
+
+/**
+ * @brief The WaveformFileOptions struct describes the layout of the waveform file.
+ */
+struct WaveformFileOptions
+{
+  WaveformFileFormat format{WaveformFileFormat::kCsv};
+
+  //!< separator of values in CSV line, consecutive whitespace separators are merged
+  char delimiter{','};
+
+  //!< zero-based index of CSV column with x values
+  std::size_t x_column{0};
+
+  //!< zero-based index of CSV column with y values
+  std::size_t y_column{1};
+};
+
+/**
+ * @brief Returns options with the format deduced from the file extension.
+ *
+ * Files with ".bin", ".raw" or ".f64" extension are binary, all others are CSV. Tab separated
+ * values are expected in ".tsv" files.
+ */
+WaveformFileOptions GetWaveformFileOptions(const std::string& file_name);
+
+/**
+ * @brief The WaveformCsvParser class parses CSV text with waveform points fed in chunks of
+ * arbitrary size.
+ *
+ * Empty lines and lines starting with '#' are skipped. The first line which can't be parsed is
+ * taken as a header, any other broken line stops the parsing with the error.
+ */
+class WaveformCsvParser
+{
+public:
+  explicit WaveformCsvParser(const WaveformFileOptions& options = {});
+
+  /**
+   * @brief Parses the next chunk of text.
+   *
+   * @return False if the error was found, parsing of further chunks is meaningless.
+   */
+  bool Feed(const char* data, std::size_t size);
+
+  /**
+   * @brief Parses the remaining incomplete line, should be called after the last chunk.
+   */
+  bool Finish();
+
+  /**
+   * @brief Returns an error message with the line number, or empty string if there is no error.
+   */
+  std::string GetErrorMessage() const;
+
+  /**
+   * @brief Takes parsed points.
+   */
+  WaveformBuffer TakeBuffer();
+
+private:
+  bool ParseLine(const char* begin, const char* end);
+
+  WaveformFileOptions m_options;
+  WaveformBuffer m_buffer;
+  std::string m_incomplete_line;  //!< the tail of the previous chunk without line end
+  std::size_t m_line_number{0};
+  bool m_header_allowed{true};
+  std::string m_error_message;
+};
+
+/**
+ * @brief The WaveformBinaryParser class parses raw binary waveform fed in chunks of arbitrary
+ * size.
+ */
+class WaveformBinaryParser
+{
+public:
+  /**
+   * @brief Reserves space for points of the waveform with the given total size in bytes.
+   *
+   * @details Should be called once before feeding, when the size of the whole input is known.
+   */
+  void Reserve(std::size_t total_size);
+
+  /**
+   * @brief Parses the next chunk of bytes.
+   */
+  void Feed(const char* data, std::size_t size);
+
+  /**
+   * @brief Checks that no incomplete point left, should be called after the last chunk.
+   */
+  bool Finish();
+
+  /**
+   * @brief Returns an error message, or empty string if there is no error.
+   */
+  std::string GetErrorMessage() const;
+
+  /**
+   * @brief Takes parsed points.
+   */
+  WaveformBuffer TakeBuffer();
+
+private:
+  void AppendPoint(const char* bytes);
+
+  WaveformBuffer m_buffer;
+  std::string m_incomplete_point;  //!< bytes of the point split between chunks
+  std::string m_error_message;
+};
+
+/**
+ * @brief Appends points [begin, end) of the buffer to the output in the format given by options.
+ *
+ * CSV values are written in the shortest form which is read back without loss, x and y are
+ * written in first two columns.
+ */
+void AppendWaveformToFileContent(const WaveformBuffer& buffer, std::size_t begin, std::size_t end,
+                                 const WaveformFileOptions& options, std::string& output);
+
+/**
+ * @brief Returns waveform parsed from the whole file content.
+ *
+ * @throws RuntimeException if the content can't be parsed.
+ */
+WaveformBuffer ParseWaveformFileContent(const std::string& content,
+                                        const WaveformFileOptions& options);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_FILE_UTILS_H_
@@ -93,14 +93,14 @@ std::unique_ptr<AnyValueItem> CreateFromPoint(double x, double y)
 
 std::pair<double, double> GetPoint(const AnyValueItem& item)
 {
-  auto children = item.GetChildren();
-  if (!item.IsStruct() || children.size() != 2)
+  const auto children = item.GetChildRange();
+  if (!item.IsStruct() || children.GetSize() != 2)
   {
     throw std::runtime_error("Error in GetXY: this item can't represent a point");
   }
 
-  auto x = children.at(0)->Data();
-  auto y = children.at(1)->Data();
+  auto x = children[0]->Data();
+  auto y = children[1]->Data();
 
   if (std::holds_alternative<double>(x) && std::holds_alternative<double>(y))
   {
@@ -135,7 +135,8 @@ std::vector<std::pair<double, double>> GetWaveform(const AnyValueArrayItem* arra
     return {};
   }
   std::vector<std::pair<double, double>> result;
-  auto points = array_item->GetChildren();
+  const auto points = array_item->GetChildRange();
+  result.reserve(static_cast<std::size_t>(points.GetSize()));
   auto on_point = [](auto item) { return GetPoint(*item); };
   (void) std::transform(std::begin(points), std::end(points), std::back_inserter(result), on_point);
   return result;
@@ -0,0 +1,138 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_point_lookup.h"
+
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+double GetX(const mvvm::LineSeriesDataItem& data_item, int index)
+{
+  return data_item.GetPoint(index)->GetX();
+}
+
+/**
+ * @brief Returns the first index in [begin, end) range for which the predicate is false.
+ *
+ * The predicate should be true for all points before the returned index, and false after it.
+ */
+template <typename Predicate>
+int PartitionPoint(const mvvm::LineSeriesDataItem& data_item, int begin, int end,
+                   Predicate is_before)
+{
+  while (begin < end)
+  {
+    const int middle = begin + (end - begin) / 2;
+    if (is_before(GetX(data_item, middle)))
+    {
+      begin = middle + 1;
+    }
+    else
+    {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+}  // namespace
+
+bool IsSortedByX(const mvvm::LineSeriesDataItem& data_item)
+{
+  const int point_count = data_item.GetPointCount();
+  for (int index = 1; index < point_count; ++index)
+  {
+    if (GetX(data_item, index) < GetX(data_item, index - 1))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int FindInsertIndexByX(const mvvm::LineSeriesDataItem& data_item, double x)
+{
+  return PartitionPoint(data_item, 0, data_item.GetPointCount(),
+                        [x](double value) { return value <= x; });
+}
+
+int FindNearestPointIndex(const mvvm::LineSeriesDataItem& data_item, double x)
+{
+  const int point_count = data_item.GetPointCount();
+  if (point_count == 0)
+  {
+    return -1;
+  }
+
+  const int index =
+      PartitionPoint(data_item, 0, point_count, [x](double value) { return value < x; });
+  if (index == 0)
+  {
+    return 0;
+  }
+  if (index == point_count)
+  {
+    return point_count - 1;
+  }
+
+  // on equal distance the left point wins
+  return x - GetX(data_item, index - 1) <= GetX(data_item, index) - x ? index - 1 : index;
+}
+
+std::pair<int, int> FindPointRangeByX(const mvvm::LineSeriesDataItem& data_item, double x_min,
+                                      double x_max)
+{
+  const int point_count = data_item.GetPointCount();
+  const int begin =
+      PartitionPoint(data_item, 0, point_count, [x_min](double value) { return value < x_min; });
+  const int end = PartitionPoint(data_item, begin, point_count,
+                                 [x_max](double value) { return value <= x_max; });
+  return {begin, end};
+}
+
+int FindSortedPosition(const mvvm::LineSeriesDataItem& data_item, const mvvm::PointItem& point)
+{
+  const int index = point.GetTagIndex().GetIndex();
+  const int point_count = data_item.GetPointCount();
+  const double x = point.GetX();
+
+  if (index > 0 && x < GetX(data_item, index - 1))
+  {
+    // points before are not affected by the removal of the point
+    return PartitionPoint(data_item, 0, index, [x](double value) { return value <= x; });
+  }
+
+  if (index + 1 < point_count && x > GetX(data_item, index + 1))
+  {
+    const int position = PartitionPoint(data_item, index + 1, point_count,
+                                        [x](double value) { return value <= x; });
+    return position - 1;
+  }
+
+  return index;
+}
+
+}  // namespace sup::gui
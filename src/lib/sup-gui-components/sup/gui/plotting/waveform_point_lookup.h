@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_POINT_LOOKUP_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_POINT_LOOKUP_H_
+
+//! @file
+//! Collection of functions to find points of waveforms with x values sorted in ascending order.
+//!
+//! Points of such a waveform are their own index: all lookups are binary searches over point
+//! positions, no additional storage has to be kept in sync with the model.
+
+#include <utility>
+
+namespace mvvm
+{
+class LineSeriesDataItem;
+class PointItem;
+}  // namespace mvvm
+
+namespace sup::gui
+{
+
+/**
+ * @brief Checks if x values of all points are in non-descending order.
+ */
+bool IsSortedByX(const mvvm::LineSeriesDataItem& data_item);
+
+/**
+ * @brief Returns the index where the point with the given x value should be inserted.
+ *
+ * The point will be placed after all points with the same x value. Points must be sorted by x.
+ */
+int FindInsertIndexByX(const mvvm::LineSeriesDataItem& data_item, double x);
+
+/**
+ * @brief Returns the index of the point with x value closest to the given one, or -1 if there are
+ * no points.
+ *
+ * Points must be sorted by x.
+ */
+int FindNearestPointIndex(const mvvm::LineSeriesDataItem& data_item, double x);
+
+/**
+ * @brief Returns the range [begin, end) of points with x values inside [x_min, x_max] interval.
+ *
+ * The range is empty if there are no such points. Points must be sorted by x.
+ */
+std::pair<int, int> FindPointRangeByX(const mvvm::LineSeriesDataItem& data_item, double x_min,
+                                      double x_max);
+
+/**
+ * @brief Returns the index where the given point should be moved to restore the order, after its
+ * x value was changed.
+ *
+ * All points, except the given one, must be sorted by x. The index is valid for MoveItem
+ * operation, i.e. it is counted as if the point was already removed from its place.
+ */
+int FindSortedPosition(const mvvm::LineSeriesDataItem& data_item, const mvvm::PointItem& point);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_POINT_LOOKUP_H_
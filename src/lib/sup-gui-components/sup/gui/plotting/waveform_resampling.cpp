@@ -0,0 +1,399 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_resampling.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/tasks/thread_pool.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <set>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The number of time base values evaluated by one job.
+ */
+const std::size_t kResampleChunkSize = 64 * 1024;
+
+/**
+ * @brief Maximum number of values in the uniform time base.
+ */
+const double kMaxTimeBaseSize = 1.0e8;
+
+const std::string kTimeFieldName = "time";
+
+void ValidateWaveform(const WaveformBuffer& waveform)
+{
+  if (waveform.GetSize() == 0 || waveform.x.size() != waveform.y.size())
+  {
+    throw RuntimeException("Can't resample empty waveform");
+  }
+}
+
+/**
+ * @brief Returns the waveform with points sorted by x.
+ *
+ * Sorted waveform is returned as it is. Otherwise points are sorted into the given storage, points
+ * with equal x keep their order.
+ */
+const WaveformBuffer& GetSortedWaveform(const WaveformBuffer& waveform, WaveformBuffer& storage)
+{
+  if (std::is_sorted(waveform.x.begin(), waveform.x.end()))
+  {
+    return waveform;
+  }
+
+  std::vector<std::size_t> order(waveform.GetSize());
+  for (std::size_t index = 0; index < order.size(); ++index)
+  {
+    order[index] = index;
+  }
+  std::stable_sort(order.begin(), order.end(), [&waveform](auto lhs, auto rhs)
+                   { return waveform.x[lhs] < waveform.x[rhs]; });
+
+  storage.x.resize(order.size());
+  storage.y.resize(order.size());
+  for (std::size_t index = 0; index < order.size(); ++index)
+  {
+    storage.x[index] = waveform.x[order[index]];
+    storage.y[index] = waveform.y[order[index]];
+  }
+  return storage;
+}
+
+/**
+ * @brief Evaluates validated waveform at given sorted times.
+ */
+void EvaluateWaveform(const WaveformBuffer& waveform, const double* times, std::size_t count,
+                      InterpolationMode mode, double* output)
+{
+  if (count == 0)
+  {
+    return;
+  }
+
+  const double* x = waveform.x.data();
+  const double* y = waveform.y.data();
+  const std::size_t last = waveform.GetSize() - 1;
+
+  // index of the last point at or before the first time, chunks start in the middle of a waveform
+  auto upper = std::upper_bound(x, x + last + 1, times[0]);
+  std::size_t index = upper == x ? 0 : static_cast<std::size_t>(upper - x) - 1;
+
+  for (std::size_t pos = 0; pos < count; ++pos)
+  {
+    const double t = times[pos];
+    while (index < last && x[index + 1] <= t)
+    {
+      ++index;
+    }
+
+    if (t <= x[0])
+    {
+      output[pos] = y[0];
+    }
+    else if (index == last)
+    {
+      output[pos] = y[last];
+    }
+    else if (mode == InterpolationMode::kZeroOrderHold)
+    {
+      output[pos] = y[index];
+    }
+    else if (mode == InterpolationMode::kNearest)
+    {
+      output[pos] = (t - x[index]) <= (x[index + 1] - t) ? y[index] : y[index + 1];
+    }
+    else
+    {
+      // x[index] <= t < x[index + 1], so the segment has non-zero length
+      const double fraction = (t - x[index]) / (x[index + 1] - x[index]);
+      output[pos] = y[index] + (y[index + 1] - y[index]) * fraction;
+    }
+  }
+}
+
+/**
+ * @brief Runs jobs in the thread pool and waits for their completion.
+ *
+ * The first exception thrown by any of jobs is rethrown.
+ */
+void RunAndWait(std::vector<std::function<void()>>& jobs, ThreadPool& thread_pool)
+{
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t remaining = jobs.size();
+  std::exception_ptr exception;
+
+  for (auto& job : jobs)
+  {
+    thread_pool.Submit(
+        [&job, &mutex, &done, &remaining, &exception]()
+        {
+          std::exception_ptr job_exception;
+          try
+          {
+            job();
+          }
+          catch (...)
+          {
+            job_exception = std::current_exception();
+          }
+
+          const std::lock_guard<std::mutex> lock(mutex);
+          if (job_exception && !exception)
+          {
+            exception = job_exception;
+          }
+          if (--remaining == 0)
+          {
+            done.notify_one();
+          }
+        });
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  done.wait(lock, [&remaining]() { return remaining == 0; });
+
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+/**
+ * @brief Returns a name which can be used as a struct field name.
+ */
+std::string CreateFieldName(const std::string& name, std::size_t index,
+                            const std::set<std::string>& used_names)
+{
+  std::string result(name);
+  std::replace_if(
+      result.begin(), result.end(),
+      [](char ch) { return ch == '.' || ch == '[' || ch == ']' || ch == ' '; }, '_');
+
+  if (result.empty())
+  {
+    result = "waveform" + std::to_string(index);
+  }
+
+  while (used_names.count(result) > 0)
+  {
+    result += "_" + std::to_string(index);
+  }
+  return result;
+}
+
+anyvalue_t CreateFloat64Array(const std::vector<double>& values)
+{
+  anyvalue_t result(values.size(), sup::dto::Float64Type);
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    result[index].ConvertFrom(values[index]);
+  }
+  return result;
+}
+
+}  // namespace
+
+std::vector<double> CreateMergedTimeBase(const std::vector<WaveformBuffer>& waveforms)
+{
+  std::vector<double> result;
+  std::vector<double> merged;
+  std::vector<double> sorted_x;
+  for (const auto& waveform : waveforms)
+  {
+    // usually waveforms are sorted already, merging is cheaper than sorting everything
+    const auto* x_values = &waveform.x;
+    if (!std::is_sorted(waveform.x.begin(), waveform.x.end()))
+    {
+      sorted_x = waveform.x;
+      std::sort(sorted_x.begin(), sorted_x.end());
+      x_values = &sorted_x;
+    }
+
+    // union drops values that are already present, so waveforms sharing the same x grid keep the
+    // result small
+    merged.clear();
+    merged.reserve(result.size() + x_values->size());
+    (void)std::set_union(result.begin(), result.end(), x_values->begin(), x_values->end(),
+                         std::back_inserter(merged));
+    result.swap(merged);
+  }
+
+  (void)result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+std::vector<double> CreateUniformTimeBase(const std::vector<WaveformBuffer>& waveforms, double dt)
+{
+  if (!(dt > 0.0))
+  {
+    throw RuntimeException("Time base step should be positive");
+  }
+
+  bool has_points{false};
+  double x_min{0.0};
+  double x_max{0.0};
+  for (const auto& waveform : waveforms)
+  {
+    if (waveform.GetSize() == 0)
+    {
+      continue;
+    }
+    auto [min_iter, max_iter] = std::minmax_element(waveform.x.begin(), waveform.x.end());
+    x_min = has_points ? std::min(x_min, *min_iter) : *min_iter;
+    x_max = has_points ? std::max(x_max, *max_iter) : *max_iter;
+    has_points = true;
+  }
+
+  if (!has_points)
+  {
+    return {};
+  }
+
+  const double interval_count = std::floor((x_max - x_min) / dt);
+  if (interval_count + 1 > kMaxTimeBaseSize)
+  {
+    throw RuntimeException("Time base step is too small for the waveform range");
+  }
+
+  const auto count = static_cast<std::size_t>(interval_count) + 1;
+  std::vector<double> result(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    result[index] = x_min + static_cast<double>(index) * dt;
+  }
+  if (result.back() < x_max)
+  {
+    result.push_back(x_max);
+  }
+  return result;
+}
+
+std::vector<double> ResampleOnTimeBase(const WaveformBuffer& waveform,
+                                       const std::vector<double>& time_base,
+                                       InterpolationMode mode)
+{
+  ValidateWaveform(waveform);
+
+  WaveformBuffer sorted_storage;
+  const auto& sorted_waveform = GetSortedWaveform(waveform, sorted_storage);
+
+  std::vector<double> result(time_base.size());
+  EvaluateWaveform(sorted_waveform, time_base.data(), time_base.size(), mode, result.data());
+  return result;
+}
+
+std::vector<std::vector<double>> ResampleWaveformsOnTimeBase(
+    const std::vector<WaveformBuffer>& waveforms, const std::vector<double>& time_base,
+    InterpolationMode mode, ThreadPool* thread_pool)
+{
+  if (!std::is_sorted(time_base.begin(), time_base.end()))
+  {
+    throw RuntimeException("Time base should be sorted");
+  }
+
+  // unsorted waveforms are sorted into their own storage, sorted ones are used as they are
+  std::vector<WaveformBuffer> sorted_storage(waveforms.size());
+  std::vector<const WaveformBuffer*> sorted_waveforms;
+  sorted_waveforms.reserve(waveforms.size());
+  for (std::size_t index = 0; index < waveforms.size(); ++index)
+  {
+    ValidateWaveform(waveforms[index]);
+    sorted_waveforms.push_back(&GetSortedWaveform(waveforms[index], sorted_storage[index]));
+  }
+
+  // results are allocated upfront, every job writes into its own part of them
+  std::vector<std::vector<double>> result(waveforms.size(),
+                                          std::vector<double>(time_base.size()));
+  std::vector<std::function<void()>> jobs;
+  for (std::size_t waveform_index = 0; waveform_index < waveforms.size(); ++waveform_index)
+  {
+    for (std::size_t begin = 0; begin < time_base.size(); begin += kResampleChunkSize)
+    {
+      const auto count = std::min(kResampleChunkSize, time_base.size() - begin);
+      const auto& waveform = *sorted_waveforms[waveform_index];
+      double* output = result[waveform_index].data() + begin;
+      const double* times = time_base.data() + begin;
+      jobs.emplace_back([&waveform, times, count, mode, output]()
+                        { EvaluateWaveform(waveform, times, count, mode, output); });
+    }
+  }
+
+  if (thread_pool && jobs.size() > 1)
+  {
+    RunAndWait(jobs, *thread_pool);
+  }
+  else
+  {
+    for (auto& job : jobs)
+    {
+      job();
+    }
+  }
+
+  return result;
+}
+
+anyvalue_t CreateResampledAnyValue(const std::vector<double>& time_base,
+                                   const std::vector<std::string>& names,
+                                   const std::vector<std::vector<double>>& values,
+                                   const std::string& type_name)
+{
+  if (names.size() != values.size())
+  {
+    throw RuntimeException("Number of waveform names doesn't match the number of waveforms");
+  }
+
+  anyvalue_t result = sup::dto::EmptyStruct(type_name);
+  result.AddMember(kTimeFieldName, CreateFloat64Array(time_base));
+
+  std::set<std::string> used_names({kTimeFieldName});
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    if (values[index].size() != time_base.size())
+    {
+      throw RuntimeException("Number of waveform values doesn't match the time base");
+    }
+
+    auto name = CreateFieldName(names[index], index, used_names);
+    result.AddMember(name, CreateFloat64Array(values[index]));
+    (void)used_names.insert(name);
+  }
+
+  return result;
+}
+
+}  // namespace sup::gui
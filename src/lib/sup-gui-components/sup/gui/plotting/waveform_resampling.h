@@ -0,0 +1,116 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_RESAMPLING_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_RESAMPLING_H_
+
+//! @file
+//! Resampling of several waveforms onto a common time base.
+
+#include <sup/gui/core/dto_types_fwd.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+
+#include <string>
+#include <vector>
+
+namespace sup::gui
+{
+
+class ThreadPool;
+
+/**
+ * @brief The InterpolationMode enum lists methods to evaluate a waveform between its points.
+ */
+enum class InterpolationMode
+{
+  kLinear,         //!< linear interpolation between neighbouring points
+  kZeroOrderHold,  //!< value of the last point at or before the given time
+  kNearest         //!< value of the nearest point, the earlier one on a tie
+};
+
+/**
+ * @brief The WaveformResamplingOptions struct defines how waveforms are resampled on a common time
+ * base.
+ */
+struct WaveformResamplingOptions
+{
+  InterpolationMode mode{InterpolationMode::kLinear};
+
+  //!< step of the uniform time base, zero means that x values of all waveforms are merged
+  double dt{0.0};
+
+  //!< the number of threads to evaluate waveforms, zero means the number of hardware threads
+  std::size_t thread_count{0};
+};
+
+/**
+ * @brief Returns sorted unique x values of all given waveforms.
+ */
+std::vector<double> CreateMergedTimeBase(const std::vector<WaveformBuffer>& waveforms);
+
+/**
+ * @brief Returns time base with the fixed step, covering x range of all given waveforms.
+ *
+ * The last value is the maximum x of all waveforms.
+ */
+std::vector<double> CreateUniformTimeBase(const std::vector<WaveformBuffer>& waveforms, double dt);
+
+/**
+ * @brief Evaluates the waveform at the given sorted times.
+ *
+ * Points of the waveform don't need to be sorted, unsorted waveform is evaluated on a copy sorted
+ * by x. Points with equal x keep their order. Times outside of the waveform range get the value of
+ * the closest edge point.
+ *
+ * @throws RuntimeException if the waveform is empty.
+ */
+std::vector<double> ResampleOnTimeBase(const WaveformBuffer& waveform,
+                                       const std::vector<double>& time_base,
+                                       InterpolationMode mode);
+
+/**
+ * @brief Evaluates all waveforms at the given sorted times.
+ *
+ * Each waveform is split into chunks of time base, chunks of all waveforms are evaluated in
+ * parallel in the given thread pool. Without the pool, evaluation runs in the calling thread. The
+ * function blocks until all chunks are done, so it shouldn't be called from a thread of the same
+ * pool.
+ *
+ * @return Values of each waveform on the time base.
+ */
+std::vector<std::vector<double>> ResampleWaveformsOnTimeBase(
+    const std::vector<WaveformBuffer>& waveforms, const std::vector<double>& time_base,
+    InterpolationMode mode, ThreadPool* thread_pool = nullptr);
+
+/**
+ * @brief Returns a struct with float64 array of times in "time" field, and float64 array of
+ * values of each waveform.
+ *
+ * Field names are made from given names: characters not allowed in field names are replaced, and
+ * empty and repeated names get a suffix with the waveform index.
+ */
+anyvalue_t CreateResampledAnyValue(const std::vector<double>& time_base,
+                                   const std::vector<std::string>& names,
+                                   const std::vector<std::vector<double>>& values,
+                                   const std::string& type_name = {});
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_RESAMPLING_H_
@@ -0,0 +1,254 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_table_model.h"
+
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/signals/model_listener.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <array>
+#include <charconv>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns the shortest text which reads back as the same double.
+ */
+QString ToEditText(double value)
+{
+  std::array<char, 32> text{};
+  auto result = std::to_chars(text.data(), text.data() + text.size(), value);
+  return QString::fromLatin1(text.data(), static_cast<int>(result.ptr - text.data()));
+}
+
+}  // namespace
+
+WaveformTableModel::WaveformTableModel(QObject* parent_object) : QAbstractTableModel(parent_object)
+{
+}
+
+WaveformTableModel::~WaveformTableModel() = default;
+
+mvvm::LineSeriesDataItem* WaveformTableModel::GetDataItem() const
+{
+  return m_data_item;
+}
+
+void WaveformTableModel::SetDataItem(mvvm::LineSeriesDataItem* data_item)
+{
+  beginResetModel();
+  m_listener.reset();
+  m_data_item = data_item;
+  if (m_data_item && m_data_item->GetModel())
+  {
+    m_listener = std::make_unique<mvvm::ModelListener>(m_data_item->GetModel());
+    m_listener->Connect<mvvm::AboutToInsertItemEvent>(this, &WaveformTableModel::OnModelEvent);
+    m_listener->Connect<mvvm::ItemInsertedEvent>(this, &WaveformTableModel::OnModelEvent);
+    m_listener->Connect<mvvm::AboutToRemoveItemEvent>(this, &WaveformTableModel::OnModelEvent);
+    m_listener->Connect<mvvm::ItemRemovedEvent>(this, &WaveformTableModel::OnModelEvent);
+    m_listener->Connect<mvvm::DataChangedEvent>(this, &WaveformTableModel::OnModelEvent);
+    m_listener->Connect<mvvm::ModelAboutToBeResetEvent>(this, &WaveformTableModel::OnModelEvent);
+  }
+  endResetModel();
+}
+
+mvvm::PointItem* WaveformTableModel::GetPoint(const QModelIndex& index) const
+{
+  if (!m_data_item || !index.isValid() || index.row() >= m_data_item->GetPointCount())
+  {
+    return nullptr;
+  }
+  return m_data_item->GetPoint(index.row());
+}
+
+int WaveformTableModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() || !m_data_item ? 0 : m_data_item->GetPointCount();
+}
+
+int WaveformTableModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : kColumnCount;
+}
+
+QVariant WaveformTableModel::data(const QModelIndex& index, int role) const
+{
+  if (role != Qt::DisplayRole && role != Qt::EditRole)
+  {
+    return {};
+  }
+
+  auto point = GetPoint(index);
+  if (!point)
+  {
+    return {};
+  }
+
+  const double value = index.column() == kXColumn ? point->GetX() : point->GetY();
+
+  // text editor keeps full precision, unlike default spin box with two decimals
+  return role == Qt::EditRole ? QVariant(ToEditText(value)) : QVariant(value);
+}
+
+bool WaveformTableModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+  auto point = GetPoint(index);
+  bool is_double{false};
+  const double new_value = value.toDouble(&is_double);
+  if (!point || role != Qt::EditRole || !is_double)
+  {
+    return false;
+  }
+
+  const double old_value = index.column() == kXColumn ? point->GetX() : point->GetY();
+  if (old_value == new_value)
+  {
+    return false;
+  }
+
+  // the cell is known, no need to refresh the whole table
+  m_is_editing = true;
+  if (index.column() == kXColumn)
+  {
+    point->SetX(new_value);
+  }
+  else
+  {
+    point->SetY(new_value);
+  }
+  m_is_editing = false;
+
+  emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+  if (index.column() == kXColumn)
+  {
+    emit PointXEdited(point);
+  }
+  return true;
+}
+
+Qt::ItemFlags WaveformTableModel::flags(const QModelIndex& index) const
+{
+  auto result = QAbstractTableModel::flags(index);
+  if (index.isValid())
+  {
+    result |= Qt::ItemIsEditable;
+  }
+  return result;
+}
+
+QVariant WaveformTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+  {
+    return section == kXColumn ? QString("x") : QString("y");
+  }
+  return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::AboutToInsertItemEvent& event)
+{
+  if (event.item == m_data_item)
+  {
+    const int row = event.tag_index.GetIndex() < 0 ? rowCount() : event.tag_index.GetIndex();
+    beginInsertRows(QModelIndex(), row, row);
+  }
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::ItemInsertedEvent& event)
+{
+  if (event.item == m_data_item)
+  {
+    endInsertRows();
+  }
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::AboutToRemoveItemEvent& event)
+{
+  if (event.item == m_data_item)
+  {
+    const int row = event.tag_index.GetIndex();
+    beginRemoveRows(QModelIndex(), row, row);
+    return;
+  }
+
+  // data item itself, or one of its parents is about to be removed
+  auto removed_item = event.item->GetItem(event.tag_index);
+  if (removed_item == m_data_item || mvvm::utils::IsItemAncestor(m_data_item, removed_item))
+  {
+    ClearDataItem();
+  }
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::ItemRemovedEvent& event)
+{
+  if (event.item == m_data_item)
+  {
+    endRemoveRows();
+  }
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::DataChangedEvent& event)
+{
+  if (!m_data_item || m_is_editing || m_data_change_pending)
+  {
+    return;
+  }
+
+  // x and y values are properties of the point
+  auto point = event.item->GetParent();
+  if (point && point->GetParent() == m_data_item)
+  {
+    m_data_change_pending = true;
+    QMetaObject::invokeMethod(this, &WaveformTableModel::NotifyDataChanged, Qt::QueuedConnection);
+  }
+}
+
+void WaveformTableModel::OnModelEvent(const mvvm::ModelAboutToBeResetEvent& event)
+{
+  (void)event;
+  ClearDataItem();
+}
+
+void WaveformTableModel::ClearDataItem()
+{
+  // the listener is kept, since it is the one which is notifying us now
+  beginResetModel();
+  m_data_item = nullptr;
+  endResetModel();
+}
+
+void WaveformTableModel::NotifyDataChanged()
+{
+  m_data_change_pending = false;
+  if (rowCount() > 0)
+  {
+    emit dataChanged(index(0, kXColumn), index(rowCount() - 1, kYColumn),
+                     {Qt::DisplayRole, Qt::EditRole});
+  }
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,123 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_TABLE_MODEL_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_TABLE_MODEL_H_
+
+#include <mvvm/signals/event_types.h>
+
+#include <QAbstractTableModel>
+#include <memory>
+
+namespace mvvm
+{
+class LineSeriesDataItem;
+class PointItem;
+class ModelListener;
+}  // namespace mvvm
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformTableModel class shows LineSeriesDataItem as two-column table of (x,y) values.
+ *
+ * @details Unlike WaveformTwoColumnViewModel, it doesn't create view items for points. Values are
+ * read from points on demand in data(), and edits are written back through PointItem setters, so
+ * they go through the command stack of the model. Opening a table with millions of points costs
+ * nothing until rows become visible.
+ *
+ * The model listens for insertion and removal of points in the data item. Changes of point
+ * coordinates made outside of the table are collected and reported as a single dataChanged signal
+ * on the next event loop iteration, views repaint only visible cells anyway.
+ */
+class WaveformTableModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  enum Column
+  {
+    kXColumn,
+    kYColumn,
+    kColumnCount
+  };
+
+  explicit WaveformTableModel(QObject* parent_object = nullptr);
+  ~WaveformTableModel() override;
+
+  /**
+   * @brief Returns data item shown in the table.
+   */
+  mvvm::LineSeriesDataItem* GetDataItem() const;
+
+  /**
+   * @brief Sets data item to show in the table, nullptr clears the table.
+   */
+  void SetDataItem(mvvm::LineSeriesDataItem* data_item);
+
+  /**
+   * @brief Returns the point for the given index, or nullptr if index is invalid.
+   */
+  mvvm::PointItem* GetPoint(const QModelIndex& index) const;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+  bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+  Qt::ItemFlags flags(const QModelIndex& index) const override;
+  QVariant headerData(int section, Qt::Orientation orientation,
+                      int role = Qt::DisplayRole) const override;
+
+signals:
+  /**
+   * @brief Reports that x value of the point was edited in the table.
+   *
+   * @details Changes coming from the model, e.g. undo/redo, are not reported.
+   */
+  void PointXEdited(mvvm::PointItem* point);
+
+private:
+  void OnModelEvent(const mvvm::AboutToInsertItemEvent& event);
+  void OnModelEvent(const mvvm::ItemInsertedEvent& event);
+  void OnModelEvent(const mvvm::AboutToRemoveItemEvent& event);
+  void OnModelEvent(const mvvm::ItemRemovedEvent& event);
+  void OnModelEvent(const mvvm::DataChangedEvent& event);
+  void OnModelEvent(const mvvm::ModelAboutToBeResetEvent& event);
+
+  /**
+   * @brief Forgets the data item, when it is about to be removed from the model.
+   */
+  void ClearDataItem();
+
+  /**
+   * @brief Reports change of all cells, called once after a series of coordinate changes.
+   */
+  void NotifyDataChanged();
+
+  mvvm::LineSeriesDataItem* m_data_item{nullptr};
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  bool m_data_change_pending{false};  //! dataChanged signal is scheduled already
+  bool m_is_editing{false};           //! data is set from the table itself
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_TABLE_MODEL_H_
@@ -0,0 +1,327 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_transforms.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Maximum number of points which resampling or generation can produce.
+ */
+const double kMaxGeneratedPointCount = 1.0e8;
+
+const double kTwoPi = 2.0 * 3.14159265358979323846;
+
+void ValidateStep(double dt)
+{
+  if (!(dt > 0.0))
+  {
+    throw RuntimeException("Waveform step should be positive");
+  }
+}
+
+void ValidateRange(const WaveformBuffer& buffer, std::size_t begin, std::size_t end)
+{
+  if (buffer.x.size() != buffer.y.size())
+  {
+    throw RuntimeException("Waveform buffer has different number of x and y values");
+  }
+
+  if (begin > end || end > buffer.GetSize())
+  {
+    throw RuntimeException("Waveform range is out of bounds");
+  }
+}
+
+/**
+ * @brief Returns buffer with x values starting from x_start with the given step.
+ */
+WaveformBuffer CreateEquidistantBuffer(double x_start, double dt, std::size_t count)
+{
+  ValidateStep(dt);
+  if (static_cast<double>(count) > kMaxGeneratedPointCount)
+  {
+    throw RuntimeException("Too many waveform points requested");
+  }
+
+  WaveformBuffer result;
+  result.x.resize(count);
+  result.y.resize(count);
+  double* x = result.x.data();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    x[index] = x_start + static_cast<double>(index) * dt;
+  }
+  return result;
+}
+
+/**
+ * @brief Returns transform applying the kernel to y values in the range.
+ */
+template <typename Kernel>
+waveform_transform_t CreateYTransform(Kernel kernel)
+{
+  return [kernel](WaveformBuffer& buffer, std::size_t begin, std::size_t end)
+  {
+    ValidateRange(buffer, begin, end);
+    kernel(buffer.y.data() + begin, end - begin);
+  };
+}
+
+}  // namespace
+
+WaveformBuffer CreateWaveformBuffer(const std::vector<std::pair<double, double>>& points)
+{
+  WaveformBuffer result;
+  result.x.resize(points.size());
+  result.y.resize(points.size());
+  for (std::size_t index = 0; index < points.size(); ++index)
+  {
+    result.x[index] = points[index].first;
+    result.y[index] = points[index].second;
+  }
+  return result;
+}
+
+std::vector<std::pair<double, double>> GetWaveformPoints(const WaveformBuffer& buffer)
+{
+  std::vector<std::pair<double, double>> result(buffer.GetSize());
+  for (std::size_t index = 0; index < result.size(); ++index)
+  {
+    result[index] = {buffer.x[index], buffer.y[index]};
+  }
+  return result;
+}
+
+void ScaleValues(double* values, std::size_t count, double factor)
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    values[index] *= factor;
+  }
+}
+
+void OffsetValues(double* values, std::size_t count, double offset)
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    values[index] += offset;
+  }
+}
+
+void ClampValues(double* values, std::size_t count, double min_value, double max_value)
+{
+  if (min_value > max_value)
+  {
+    throw RuntimeException("Lower clamp limit is greater than the upper one");
+  }
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    // branchless form, which compilers turn into min/max instructions
+    const double value = values[index] < min_value ? min_value : values[index];
+    values[index] = value > max_value ? max_value : value;
+  }
+}
+
+void SmoothValues(double* values, std::size_t count, std::size_t window)
+{
+  if (window < 2 || count == 0)
+  {
+    return;
+  }
+
+  // prefix sums of the original values, prefix[i] is the sum of first i values
+  std::vector<double> prefix(count + 1, 0.0);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    prefix[index + 1] = prefix[index] + values[index];
+  }
+
+  const std::size_t half_window = window / 2;
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const std::size_t first = index > half_window ? index - half_window : 0;
+    const std::size_t last = std::min(count, index + half_window + 1);
+    values[index] = (prefix[last] - prefix[first]) / static_cast<double>(last - first);
+  }
+}
+
+WaveformBuffer ResampleWaveform(const WaveformBuffer& buffer, double dt)
+{
+  ValidateStep(dt);
+  ValidateRange(buffer, 0, buffer.GetSize());
+
+  if (!std::is_sorted(buffer.x.begin(), buffer.x.end()))
+  {
+    throw RuntimeException("Waveform points should be sorted by x to be resampled");
+  }
+
+  if (buffer.GetSize() < 2)
+  {
+    return buffer;
+  }
+
+  const double x_first = buffer.x.front();
+  const double x_last = buffer.x.back();
+  const double interval_count = std::floor((x_last - x_first) / dt);
+  if (interval_count + 1 > kMaxGeneratedPointCount)
+  {
+    throw RuntimeException("Resampling step is too small for the waveform");
+  }
+
+  // equidistant points, the last point of the original waveform is always included
+  auto count = static_cast<std::size_t>(interval_count) + 1;
+  auto result = CreateEquidistantBuffer(x_first, dt, count);
+  if (result.x.back() < x_last)
+  {
+    result.x.push_back(x_last);
+    result.y.push_back(0.0);
+  }
+
+  // single pass over both sorted sequences
+  std::size_t segment = 0;
+  const std::size_t last_segment = buffer.GetSize() - 2;
+  for (std::size_t index = 0; index < result.GetSize(); ++index)
+  {
+    const double x = result.x[index];
+    while (segment < last_segment && buffer.x[segment + 1] < x)
+    {
+      ++segment;
+    }
+
+    const double x0 = buffer.x[segment];
+    const double x1 = buffer.x[segment + 1];
+    const double y0 = buffer.y[segment];
+    const double y1 = buffer.y[segment + 1];
+    result.y[index] = x1 > x0 ? y0 + (y1 - y0) * (x - x0) / (x1 - x0) : y1;
+  }
+
+  return result;
+}
+
+WaveformBuffer GenerateRamp(double x_start, double dt, std::size_t count, double y_start,
+                            double y_end)
+{
+  auto result = CreateEquidistantBuffer(x_start, dt, count);
+  const double slope = count > 1 ? (y_end - y_start) / static_cast<double>(count - 1) : 0.0;
+  double* y = result.y.data();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    y[index] = y_start + slope * static_cast<double>(index);
+  }
+  return result;
+}
+
+WaveformBuffer GenerateSine(double x_start, double dt, std::size_t count, double amplitude,
+                            double frequency, double phase, double offset)
+{
+  auto result = CreateEquidistantBuffer(x_start, dt, count);
+  const double* x = result.x.data();
+  double* y = result.y.data();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    y[index] = offset + amplitude * std::sin(kTwoPi * frequency * x[index] + phase);
+  }
+  return result;
+}
+
+WaveformBuffer GenerateStep(double x_start, double dt, std::size_t count, double step_x,
+                            double low, double high)
+{
+  auto result = CreateEquidistantBuffer(x_start, dt, count);
+  const double* x = result.x.data();
+  double* y = result.y.data();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    y[index] = x[index] < step_x ? low : high;
+  }
+  return result;
+}
+
+waveform_transform_t CreateScaleTransform(double factor)
+{
+  return CreateYTransform([factor](double* values, std::size_t count)
+                          { ScaleValues(values, count, factor); });
+}
+
+waveform_transform_t CreateOffsetTransform(double offset)
+{
+  return CreateYTransform([offset](double* values, std::size_t count)
+                          { OffsetValues(values, count, offset); });
+}
+
+waveform_transform_t CreateTimeShiftTransform(double shift)
+{
+  return [shift](WaveformBuffer& buffer, std::size_t begin, std::size_t end)
+  {
+    ValidateRange(buffer, begin, end);
+    OffsetValues(buffer.x.data() + begin, end - begin, shift);
+  };
+}
+
+waveform_transform_t CreateClampTransform(double min_value, double max_value)
+{
+  if (min_value > max_value)
+  {
+    throw RuntimeException("Lower clamp limit is greater than the upper one");
+  }
+
+  return CreateYTransform([min_value, max_value](double* values, std::size_t count)
+                          { ClampValues(values, count, min_value, max_value); });
+}
+
+waveform_transform_t CreateSmoothTransform(std::size_t window)
+{
+  return CreateYTransform([window](double* values, std::size_t count)
+                          { SmoothValues(values, count, window); });
+}
+
+waveform_transform_t CreateResampleTransform(double dt)
+{
+  ValidateStep(dt);
+
+  return [dt](WaveformBuffer& buffer, std::size_t begin, std::size_t end)
+  {
+    ValidateRange(buffer, begin, end);
+
+    WaveformBuffer range;
+    range.x.assign(buffer.x.begin() + begin, buffer.x.begin() + end);
+    range.y.assign(buffer.y.begin() + begin, buffer.y.begin() + end);
+    auto resampled = ResampleWaveform(range, dt);
+
+    // points outside of the range stay in place
+    (void)buffer.x.erase(buffer.x.begin() + begin, buffer.x.begin() + end);
+    (void)buffer.y.erase(buffer.y.begin() + begin, buffer.y.begin() + end);
+    (void)buffer.x.insert(buffer.x.begin() + begin, resampled.x.begin(), resampled.x.end());
+    (void)buffer.y.insert(buffer.y.begin() + begin, resampled.y.begin(), resampled.y.end());
+  };
+}
+
+}  // namespace sup::gui
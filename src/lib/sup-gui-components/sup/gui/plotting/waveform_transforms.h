@@ -0,0 +1,147 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_PLOTTING_WAVEFORM_TRANSFORMS_H_
+#define SUP_GUI_PLOTTING_WAVEFORM_TRANSFORMS_H_
+
+//! @file
+//! Numeric kernels to transform and generate waveforms stored in contiguous buffers.
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformBuffer struct holds waveform points as two contiguous arrays of coordinates.
+ *
+ * Transformations run over plain arrays of doubles, so the compiler can vectorize them.
+ */
+struct WaveformBuffer
+{
+  std::vector<double> x;
+  std::vector<double> y;
+
+  std::size_t GetSize() const { return x.size(); }
+};
+
+/**
+ * @brief Returns buffer with coordinates of given points.
+ */
+WaveformBuffer CreateWaveformBuffer(const std::vector<std::pair<double, double>>& points);
+
+/**
+ * @brief Returns points with coordinates from the given buffer.
+ */
+std::vector<std::pair<double, double>> GetWaveformPoints(const WaveformBuffer& buffer);
+
+/**
+ * @brief Multiplies values by the factor.
+ */
+void ScaleValues(double* values, std::size_t count, double factor);
+
+/**
+ * @brief Adds the offset to values.
+ */
+void OffsetValues(double* values, std::size_t count, double offset);
+
+/**
+ * @brief Limits values to the given range.
+ */
+void ClampValues(double* values, std::size_t count, double min_value, double max_value);
+
+/**
+ * @brief Replaces values with the centered moving average over the window of given size.
+ *
+ * Even window is extended by one point to stay centered, and it is shrunk near the edges. Window
+ * of size 0 or 1 leaves values unchanged.
+ */
+void SmoothValues(double* values, std::size_t count, std::size_t window);
+
+/**
+ * @brief Returns the waveform resampled with the fixed step using linear interpolation.
+ *
+ * Points of the given waveform should be sorted by x. The result spans from the first to the last
+ * point of the given waveform, the last point is always included.
+ */
+WaveformBuffer ResampleWaveform(const WaveformBuffer& buffer, double dt);
+
+/**
+ * @brief Returns the linear ramp from y_start to y_end with the given number of points.
+ */
+WaveformBuffer GenerateRamp(double x_start, double dt, std::size_t count, double y_start,
+                            double y_end);
+
+/**
+ * @brief Returns the sine wave: offset + amplitude * sin(2 * pi * frequency * x + phase).
+ */
+WaveformBuffer GenerateSine(double x_start, double dt, std::size_t count, double amplitude,
+                            double frequency, double phase = 0.0, double offset = 0.0);
+
+/**
+ * @brief Returns the step from low to high value, which happens at x = step_x.
+ */
+WaveformBuffer GenerateStep(double x_start, double dt, std::size_t count, double step_x,
+                            double low, double high);
+
+/**
+ * @brief The transform of waveform points in the range [begin, end).
+ *
+ * Transforms changing the number of points have to keep points outside of the range.
+ */
+using waveform_transform_t =
+    std::function<void(WaveformBuffer& buffer, std::size_t begin, std::size_t end)>;
+
+/**
+ * @brief Returns transform multiplying y values by the factor.
+ */
+waveform_transform_t CreateScaleTransform(double factor);
+
+/**
+ * @brief Returns transform adding the offset to y values.
+ */
+waveform_transform_t CreateOffsetTransform(double offset);
+
+/**
+ * @brief Returns transform adding the shift to x values.
+ */
+waveform_transform_t CreateTimeShiftTransform(double shift);
+
+/**
+ * @brief Returns transform limiting y values to the given range.
+ */
+waveform_transform_t CreateClampTransform(double min_value, double max_value);
+
+/**
+ * @brief Returns transform smoothing y values with the moving average.
+ */
+waveform_transform_t CreateSmoothTransform(std::size_t window);
+
+/**
+ * @brief Returns transform replacing points in the range with points resampled with fixed step.
+ */
+waveform_transform_t CreateResampleTransform(double dt);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_PLOTTING_WAVEFORM_TRANSFORMS_H_
@@ -0,0 +1,158 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "colored_icon_cache.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <algorithm>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Maximum total size of cached pixmaps in kilobytes.
+ */
+const int kMaxPixmapCacheCostKb = 10240;
+
+/**
+ * @brief Returns approximate memory footprint of the pixmap in kilobytes.
+ */
+int GetPixmapCost(const QPixmap& pixmap)
+{
+  const qint64 bytes = static_cast<qint64>(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+  return std::max(1, static_cast<int>(bytes / 1024));
+}
+
+}  // namespace
+
+ColoredIconCache::ColoredIconCache() : m_pixmaps(kMaxPixmapCacheCostKb) {}
+
+ColoredIconCache::~ColoredIconCache() = default;
+
+ColoredIconCache& ColoredIconCache::Instance()
+{
+  static ColoredIconCache instance;
+  return instance;
+}
+
+QString ColoredIconCache::CreatePixmapKey(const QString& icon_path, const QSize& size,
+                                          qreal device_pixel_ratio, QIcon::Mode mode,
+                                          QIcon::State state, const QColor& color)
+{
+  return QString("%1|%2x%3|%4|%5|%6|%7")
+      .arg(icon_path)
+      .arg(size.width())
+      .arg(size.height())
+      .arg(device_pixel_ratio)
+      .arg(static_cast<int>(mode))
+      .arg(static_cast<int>(state))
+      .arg(color.rgba());
+}
+
+QString ColoredIconCache::CreateIconKey(const QString& resource_name, const QColor& color)
+{
+  return QString("%1|%2").arg(resource_name).arg(color.rgba());
+}
+
+bool ColoredIconCache::FindPixmap(const QString& key, QPixmap& pixmap) const
+{
+  if (auto cached = m_pixmaps.object(key); cached)
+  {
+    pixmap = *cached;
+    return true;
+  }
+  return false;
+}
+
+void ColoredIconCache::InsertPixmap(const QString& key, const QPixmap& pixmap)
+{
+  if (UpdateApplicationConnection())
+  {
+    (void)m_pixmaps.insert(key, new QPixmap(pixmap), GetPixmapCost(pixmap));
+  }
+}
+
+QIcon ColoredIconCache::FindIcon(const QString& key) const
+{
+  return m_icons.value(key);
+}
+
+void ColoredIconCache::InsertIcon(const QString& key, const QIcon& icon)
+{
+  if (UpdateApplicationConnection())
+  {
+    (void)m_icons.insert(key, icon);
+  }
+}
+
+void ColoredIconCache::Clear()
+{
+  m_pixmaps.clear();
+  m_icons.clear();
+}
+
+int ColoredIconCache::GetPixmapCount() const
+{
+  return m_pixmaps.count();
+}
+
+int ColoredIconCache::GetIconCount() const
+{
+  return m_icons.count();
+}
+
+bool ColoredIconCache::eventFilter(QObject* object, QEvent* event)
+{
+  if (object == m_application
+      && (event->type() == QEvent::ApplicationPaletteChange || event->type() == QEvent::ThemeChange
+          || event->type() == QEvent::StyleChange))
+  {
+    Clear();
+  }
+
+  return QObject::eventFilter(object, event);
+}
+
+bool ColoredIconCache::UpdateApplicationConnection()
+{
+  auto application = QCoreApplication::instance();
+  if (!application)
+  {
+    return false;
+  }
+
+  if (application != m_application)
+  {
+    // Pixmaps can't outlive the application that created them, and new application might have
+    // different palette.
+    Clear();
+    m_application = application;
+    m_application->installEventFilter(this);
+    connect(m_application, &QObject::destroyed, this, &ColoredIconCache::Clear);
+  }
+
+  return true;
+}
+
+}  // namespace sup::gui
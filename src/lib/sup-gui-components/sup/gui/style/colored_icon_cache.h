@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_STYLE_COLORED_ICON_CACHE_H_
+#define SUP_GUI_STYLE_COLORED_ICON_CACHE_H_
+
+#include <QCache>
+#include <QHash>
+#include <QIcon>
+#include <QObject>
+#include <QPixmap>
+#include <QPointer>
+
+class QCoreApplication;
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ColoredIconCache class is a process-wide storage of colored icons and of pixmaps
+ * rendered by ColoredIconEngine.
+ *
+ * Pixmaps are keyed by icon path, size, device pixel ratio, mode, state and color. Icons are
+ * registered by their resource name and base color, so all toolbars and menus asking for the same
+ * icon share a single engine and its pixmaps.
+ *
+ * The cache is cleared when the application palette or theme changes. Nothing is cached while
+ * there is no application instance.
+ */
+class ColoredIconCache : public QObject
+{
+  Q_OBJECT
+
+public:
+  ColoredIconCache(const ColoredIconCache&) = delete;
+  ColoredIconCache& operator=(const ColoredIconCache&) = delete;
+  ColoredIconCache(ColoredIconCache&&) = delete;
+  ColoredIconCache& operator=(ColoredIconCache&&) = delete;
+
+  /**
+   * @brief Returns the global instance of the cache.
+   */
+  static ColoredIconCache& Instance();
+
+  /**
+   * @brief Creates a key to store the pixmap rendered for the given icon, size and color.
+   */
+  static QString CreatePixmapKey(const QString& icon_path, const QSize& size,
+                                 qreal device_pixel_ratio, QIcon::Mode mode, QIcon::State state,
+                                 const QColor& color);
+
+  /**
+   * @brief Creates a key to register an icon with the given resource name and base color.
+   */
+  static QString CreateIconKey(const QString& resource_name, const QColor& color);
+
+  /**
+   * @brief Finds the pixmap with the given key.
+   *
+   * @return True if the pixmap was found.
+   */
+  bool FindPixmap(const QString& key, QPixmap& pixmap) const;
+
+  /**
+   * @brief Inserts the pixmap with the given key.
+   */
+  void InsertPixmap(const QString& key, const QPixmap& pixmap);
+
+  /**
+   * @brief Finds the icon with the given key, returns null icon if there is no such icon.
+   */
+  QIcon FindIcon(const QString& key) const;
+
+  /**
+   * @brief Registers the icon with the given key.
+   */
+  void InsertIcon(const QString& key, const QIcon& icon);
+
+  /**
+   * @brief Removes all pixmaps and icons from the cache.
+   */
+  void Clear();
+
+  /**
+   * @brief Returns the number of cached pixmaps.
+   */
+  int GetPixmapCount() const;
+
+  /**
+   * @brief Returns the number of registered icons.
+   */
+  int GetIconCount() const;
+
+protected:
+  bool eventFilter(QObject* object, QEvent* event) override;
+
+private:
+  ColoredIconCache();
+  ~ColoredIconCache() override;
+
+  /**
+   * @brief Makes sure that the cache listens for palette changes of the current application.
+   *
+   * @return False if there is no application instance.
+   */
+  bool UpdateApplicationConnection();
+
+  QPointer<QCoreApplication> m_application;
+  QCache<QString, QPixmap> m_pixmaps;
+  QHash<QString, QIcon> m_icons;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_STYLE_COLORED_ICON_CACHE_H_
@@ -20,6 +20,8 @@
 
 #include "colored_icon_engine.h"
 
+#include "colored_icon_cache.h"
+
 #include <QApplication>
 #include <QIcon>
 #include <QPainter>
@@ -30,7 +32,7 @@ namespace sup::gui
 
 ColoredIconEngine::ColoredIconEngine(const QIcon& icon, const QColor& color_on,
                                      const QColor& color_off, const QColor& color_disabled)
-    : m_icon{icon}
+    : m_icon{icon}, m_icon_path{QString("#%1").arg(icon.cacheKey())}
 {
   AddMappings(color_disabled, {QIcon::Disabled});
 
@@ -60,7 +62,10 @@ ColoredIconEngine::ColoredIconEngine(const QIcon& icon)
 }
 
 ColoredIconEngine::ColoredIconEngine(const ColoredIconEngine& other)
-    : QIconEngine(other), m_icon{other.m_icon}, m_color_map{other.m_color_map}
+    : QIconEngine(other)
+    , m_icon{other.m_icon}
+    , m_icon_path{other.m_icon_path}
+    , m_color_map{other.m_color_map}
 {
 }
 
@@ -80,24 +85,26 @@ void ColoredIconEngine::paint(QPainter* painter, const QRect& rect, QIcon::Mode
 
 QPixmap ColoredIconEngine::pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state)
 {
-  // TODO: Implement QPixmap caching to mitigate the performance impact
-
   if (m_icon.isNull())
   {
     return QPixmap();
   }
 
-  QPixmap pix{size};
-  pix.fill(Qt::transparent);
+  const auto color = m_color_map.value({mode, state});
+  const qreal device_pixel_ratio = qApp ? qApp->devicePixelRatio() : 1.0;
+  const auto key = ColoredIconCache::CreatePixmapKey(m_icon_path, size, device_pixel_ratio, mode,
+                                                     state, color);
 
-  QRect rect{{}, size};
-  QPainter painter(&pix);
-  painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-  painter.drawPixmap(rect, m_icon.pixmap(size, mode, state));
-  painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-  painter.fillRect(rect, m_color_map.value({mode, state}));
+  auto& cache = ColoredIconCache::Instance();
+  QPixmap result;
+  if (cache.FindPixmap(key, result))
+  {
+    return result;
+  }
 
-  return pix;
+  result = CreatePixmap(size, mode, state, color);
+  cache.InsertPixmap(key, result);
+  return result;
 }
 
 QSize ColoredIconEngine::actualSize(const QSize& size, QIcon::Mode mode, QIcon::State state)
@@ -115,6 +122,32 @@ QIconEngine* ColoredIconEngine::clone() const
   return new ColoredIconEngine(*this);
 }
 
+void ColoredIconEngine::SetIconPath(const QString& icon_path)
+{
+  m_icon_path = icon_path;
+}
+
+QString ColoredIconEngine::GetIconPath() const
+{
+  return m_icon_path;
+}
+
+QPixmap ColoredIconEngine::CreatePixmap(const QSize& size, QIcon::Mode mode, QIcon::State state,
+                                        const QColor& color) const
+{
+  QPixmap pix{size};
+  pix.fill(Qt::transparent);
+
+  QRect rect{{}, size};
+  QPainter painter(&pix);
+  painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+  painter.drawPixmap(rect, m_icon.pixmap(size, mode, state));
+  painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+  painter.fillRect(rect, color);
+
+  return pix;
+}
+
 void ColoredIconEngine::AddMapping(const QColor& color, QIcon::Mode mode, QIcon::State state)
 {
   (void) m_color_map.insert({mode, state}, color);
@@ -33,6 +33,9 @@ namespace sup::gui
 /**
  * @brief The ColoredIconEngine class is intended to render monochrome svg-based icons using
  * user-provided colors.
+ *
+ * Rendered pixmaps are stored in the process-wide ColoredIconCache. Engines created for the same
+ * icon path share cached pixmaps.
  */
 class ColoredIconEngine : public QIconEngine
 {
@@ -55,12 +58,28 @@ public:
 
   QIconEngine* clone() const override;
 
+  /**
+   * @brief Sets the path to the icon resource, which will be used as a key in the pixmap cache.
+   *
+   * If the path is not set, the pixmap cache will be used only by this engine and its clones.
+   */
+  void SetIconPath(const QString& icon_path);
+
+  QString GetIconPath() const;
+
 private:
+  /**
+   * @brief Renders the icon of the given size using the given color.
+   */
+  QPixmap CreatePixmap(const QSize& size, QIcon::Mode mode, QIcon::State state,
+                       const QColor& color) const;
+
   void AddMapping(const QColor& color, QIcon::Mode mode, QIcon::State state);
   void AddMappings(const QColor& color, const QList<QIcon::Mode>& modes,
                    const QList<QIcon::State>& states = {QIcon::On, QIcon::Off});
 
   QIcon m_icon;
+  QString m_icon_path;
   QHash<QPair<QIcon::Mode, QIcon::State>, QColor> m_color_map;
 };
 
@@ -20,6 +20,7 @@
 
 #include "style_helper.h"
 
+#include "colored_icon_cache.h"
 #include "colored_icon_engine.h"
 
 #include <mvvm/core/mvvm_exceptions.h>
@@ -80,17 +81,34 @@ QString CreatePopertyTreeStyleString()
 /**
  * @brief Creates color engine necessary to render given icon.
  */
-std::unique_ptr<QIconEngine> CreateColorEngine(const QIcon &icon, IconColorFlavor icon_flavor)
+std::unique_ptr<QIconEngine> CreateColorEngine(const QString &resource_name, const QColor &color)
 {
-  return std::make_unique<ColoredIconEngine>(icon, GetIconBaseColor(icon_flavor));
+  auto result = std::make_unique<ColoredIconEngine>(QIcon(resource_name), color);
+  result->SetIconPath(resource_name);
+  return result;
 }
 
 /**
- * @brief Creates icon colored in given flavor.
+ * @brief Returns icon colored in given flavor.
+ *
+ * Icons are shared via the registry, so the engine is created only once for every resource name
+ * and color.
  */
-QIcon CreateColoredIcon(const QIcon &icon, IconColorFlavor icon_flavor)
+QIcon GetColoredIcon(const QString &resource_name, IconColorFlavor icon_flavor)
 {
-  return QIcon(CreateColorEngine(icon, icon_flavor).release());  // icon takes ownership over engine
+  const auto color = GetIconBaseColor(icon_flavor);
+  const auto key = ColoredIconCache::CreateIconKey(resource_name, color);
+
+  auto &cache = ColoredIconCache::Instance();
+  if (auto result = cache.FindIcon(key); !result.isNull())
+  {
+    return result;
+  }
+
+  // icon takes ownership over engine
+  QIcon result(CreateColorEngine(resource_name, color).release());
+  cache.InsertIcon(key, result);
+  return result;
 }
 
 }  // namespace
@@ -143,8 +161,7 @@ QSize NarrowToolBarIconSize()
 
 QIcon GetIcon(const QString &resource_name, IconColorFlavor icon_flavor)
 {
-  const QIcon icon(resource_name);
-  return kUseColorEngine ? CreateColoredIcon(icon, icon_flavor) : icon;
+  return kUseColorEngine ? GetColoredIcon(resource_name, icon_flavor) : QIcon(resource_name);
 }
 
 QIcon FindIcon(const QString &icon_name, IconColorFlavor icon_flavor)
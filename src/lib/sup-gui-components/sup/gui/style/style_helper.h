@@ -56,6 +56,9 @@ QColor GetIconBaseColor(IconColorFlavor icon_flavor);
  * rendered according to the current theme's dark/light flavor. Icons for the dark theme will be
  * rendered as almost white, icons for the light theme will be rendered as almost black. User can
  * still specify the desired icon_flavor thus overriding the current theme's dark/light style.
+ *
+ * Colored icons are registered in the process-wide ColoredIconCache, repeated calls with the same
+ * arguments return the same shared icon until the application palette changes.
  */
 QIcon GetIcon(const QString& resource_name,
               IconColorFlavor icon_flavor = IconColorFlavor::kUnspecified);
@@ -0,0 +1,40 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "cancellation_token.h"
+
+namespace sup::gui
+{
+
+CancellationToken::CancellationToken() : m_is_cancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void CancellationToken::Cancel()
+{
+  m_is_cancelled->store(true);
+}
+
+bool CancellationToken::IsCancelled() const
+{
+  return m_is_cancelled->load();
+}
+
+}  // namespace sup::gui
@@ -18,43 +18,41 @@
  * of the distribution package.
  *****************************************************************************/
 
-#ifndef SUP_GUI_EXPERIMENTAL_WORKER_MANAGER_H_
-#define SUP_GUI_EXPERIMENTAL_WORKER_MANAGER_H_
+#ifndef SUP_GUI_TASKS_CANCELLATION_TOKEN_H_
+#define SUP_GUI_TASKS_CANCELLATION_TOKEN_H_
 
-#include <QObject>
-#include <cstddef>
+#include <atomic>
 #include <memory>
 
-class Worker;
-class ITask;
+namespace sup::gui
+{
 
 /**
- * @brief The WorkerManager class manages the running of tasks.
+ * @brief The CancellationToken class is a thread-safe flag to request a cooperative cancellation of
+ * a task.
  *
- * @note Internally it creates a collection of workers
+ * Copies of the token share the same flag, so the token can be cancelled from the GUI thread and
+ * checked from the thread running the task. Cancellation can't be undone.
  */
-
-class WorkerManager : public QObject
+class CancellationToken
 {
-  Q_OBJECT
-
 public:
-  ~WorkerManager() override;
-
-  Worker* Start(std::unique_ptr<ITask> task);
-
-  std::size_t GetWorkerCount() const;
+  CancellationToken();
 
   /**
-   * @brief Takes the result corresponding to a given worker. Removes worker from a queue.
+   * @brief Requests the cancellation.
    */
-  std::unique_ptr<ITask> TakeResult(Worker* worker);
+  void Cancel();
 
-signals:
-  void WorkerStatusChanged(Worker*, std::size_t status);
+  /**
+   * @brief Checks if the cancellation was requested.
+   */
+  bool IsCancelled() const;
 
 private:
-  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::shared_ptr<std::atomic<bool>> m_is_cancelled;
 };
 
-#endif  // SUP_GUI_EXPERIMENTAL_WORKER_MANAGER_H_
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_CANCELLATION_TOKEN_H_
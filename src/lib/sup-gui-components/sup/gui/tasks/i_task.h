@@ -18,36 +18,41 @@
  * of the distribution package.
  *****************************************************************************/
 
-#ifndef SUP_GUI_EXPERIMENTAL_TASK_H_
-#define SUP_GUI_EXPERIMENTAL_TASK_H_
+#ifndef SUP_GUI_TASKS_I_TASK_H_
+#define SUP_GUI_TASKS_I_TASK_H_
+
+namespace sup::gui
+{
+
+class TaskContext;
 
 /**
- * @brief The ITask class represents a task to do.
- *
- * @note It is expected that the task is self-contained, that it can run safely in a thread and that
- * it stores the result of the calculation on board.
+ * @brief The ITask class represents a task to run by TaskExecutor.
  *
- * @note The task is intended to be executed via the Worker class, which will prohibit an access to
- * the task during its execution.
- *
- * @note No inheritance on Qt classes.
+ * The task is expected to be self-contained, to run safely in a non-GUI thread and to store the
+ * result of the calculation on board. No inheritance on Qt classes.
  */
-
 class ITask
 {
 public:
   virtual ~ITask() = default;
 
   /**
-   * @brief Runs main calculations. Expected to be called from non-GUI thread.
+   * @brief Runs main calculations. Called from a non-GUI thread.
+   *
+   * The task should regularly check the context for cancellation. Exception thrown marks the task
+   * as failed.
    */
-  virtual void Run() = 0;
+  virtual void Run(TaskContext& context) = 0;
 
   /**
-   * @brief Convenience method that can be called in a GUI thread to finalize the task.
+   * @brief Finalizes the task in the GUI thread after successful run.
+   *
    * For example, it can perform updates of GUI model with the data obtained on previous step.
    */
-  virtual void Finalize() {};
+  virtual void Finalize() {}
 };
 
-#endif  // SUP_GUI_EXPERIMENTAL_TASK_H_
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_I_TASK_H_
@@ -18,47 +18,34 @@
  * of the distribution package.
  *****************************************************************************/
 
-#include "worker.h"
+#include "task_context.h"
 
-#include "task.h"
+#include <algorithm>
 
-Worker::Worker(std::unique_ptr<ITask> task) : m_task(std::move(task)), m_status(kIdle) {}
-
-Worker::~Worker() = default;
-
-void Worker::Run()
+namespace sup::gui
 {
-  auto worker_func = [this]()
-  {
-    try
-    {
-      SetStatus(kStarted);
-      m_task->Run();
-      SetStatus(kCompleted);
-    }
-    catch (...)
-    {
-      SetStatus(kFailed);
-    }
-  };
 
-  m_future = std::async(std::launch::async, worker_func);
+TaskContext::TaskContext(CancellationToken token, progress_callback_t progress_callback)
+    : m_token(std::move(token)), m_progress_callback(std::move(progress_callback))
+{
 }
 
-std::unique_ptr<ITask> Worker::WaitForResult()
+bool TaskContext::IsCancelled() const
 {
-  m_future.wait();
-  return std::move(m_task);
+  return m_token.IsCancelled();
 }
 
-Worker::Status Worker::GetStatus() const
+CancellationToken TaskContext::GetCancellationToken() const
 {
-  return m_status.load();
+  return m_token;
 }
 
-void Worker::SetStatus(Status value)
+void TaskContext::ReportProgress(int percentage)
 {
-  // atomic might not be enough, lock may be?
-  m_status.store(value);
-  emit StatusChanged(value);
+  if (m_progress_callback)
+  {
+    m_progress_callback(std::clamp(percentage, 0, 100));
+  }
 }
+
+}  // namespace sup::gui
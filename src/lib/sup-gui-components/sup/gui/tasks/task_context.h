@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_TASKS_TASK_CONTEXT_H_
+#define SUP_GUI_TASKS_TASK_CONTEXT_H_
+
+#include <sup/gui/tasks/cancellation_token.h>
+
+#include <functional>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The TaskContext class is given to the running task to check for cancellation and to
+ * report the progress.
+ */
+class TaskContext
+{
+public:
+  using progress_callback_t = std::function<void(int)>;
+
+  explicit TaskContext(CancellationToken token, progress_callback_t progress_callback = {});
+
+  /**
+   * @brief Checks if the cancellation was requested. Long tasks should check it regularly and
+   * return as soon as possible.
+   */
+  bool IsCancelled() const;
+
+  /**
+   * @brief Returns the cancellation token of the task.
+   */
+  CancellationToken GetCancellationToken() const;
+
+  /**
+   * @brief Reports the progress of the task in percents.
+   *
+   * Values are clamped to [0, 100] range. Consequent reports might be merged when the GUI thread
+   * is busy.
+   */
+  void ReportProgress(int percentage);
+
+private:
+  CancellationToken m_token;
+  progress_callback_t m_progress_callback;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_TASK_CONTEXT_H_
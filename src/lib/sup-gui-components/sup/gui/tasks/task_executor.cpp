@@ -0,0 +1,243 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "task_executor.h"
+
+#include "cancellation_token.h"
+#include "i_task.h"
+#include "task_context.h"
+#include "thread_pool.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <atomic>
+#include <string>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The TaskRecord struct holds the task with its state.
+ *
+ * Atomic fields are shared with the pool thread running the task, the rest is accessed from the
+ * GUI thread only. The task itself is accessed from the GUI thread only after its completion was
+ * delivered.
+ */
+struct TaskExecutor::TaskRecord
+{
+  std::unique_ptr<ITask> task;
+  CancellationToken token;
+  std::atomic<TaskStatus> status{TaskStatus::kQueued};
+  std::atomic<int> progress{0};
+  std::atomic<bool> is_progress_pending{false};
+  bool is_finished{false};
+};
+
+TaskExecutor::TaskExecutor(std::size_t thread_count, QObject *parent_object)
+    : QObject(parent_object), m_thread_pool(std::make_unique<ThreadPool>(thread_count))
+{
+}
+
+TaskExecutor::~TaskExecutor()
+{
+  CancelAll();
+  // queued tasks are cancelled and finish at once, events they have posted will be discarded
+  m_thread_pool.reset();
+}
+
+TaskExecutor::task_id_t TaskExecutor::Submit(std::unique_ptr<ITask> task, TaskPriority priority)
+{
+  if (!task)
+  {
+    throw NullArgumentException("TaskExecutor: task is not initialised");
+  }
+
+  const auto task_id = m_next_task_id++;
+  auto record = std::make_shared<TaskRecord>();
+  record->task = std::move(task);
+  (void)m_records.emplace(task_id, record);
+  ++m_active_task_count;
+
+  // the job shares the record, so it stays valid even if the task was taken from the executor
+  m_thread_pool->Submit([this, task_id, record]() { RunTask(task_id, *record); }, priority);
+
+  return task_id;
+}
+
+bool TaskExecutor::Cancel(task_id_t task_id)
+{
+  auto record = FindRecord(task_id);
+  if (!record || record->is_finished)
+  {
+    return false;
+  }
+
+  record->token.Cancel();
+  return true;
+}
+
+void TaskExecutor::CancelAll()
+{
+  for (auto &[task_id, record] : m_records)
+  {
+    record->token.Cancel();
+  }
+}
+
+TaskStatus TaskExecutor::GetStatus(task_id_t task_id) const
+{
+  if (auto record = FindRecord(task_id); record)
+  {
+    return record->status.load();
+  }
+  throw RuntimeException("TaskExecutor: unknown task id " + std::to_string(task_id));
+}
+
+int TaskExecutor::GetProgress(task_id_t task_id) const
+{
+  if (auto record = FindRecord(task_id); record)
+  {
+    return record->progress.load();
+  }
+  throw RuntimeException("TaskExecutor: unknown task id " + std::to_string(task_id));
+}
+
+bool TaskExecutor::IsFinished(task_id_t task_id) const
+{
+  auto record = FindRecord(task_id);
+  return record && record->is_finished;
+}
+
+std::unique_ptr<ITask> TaskExecutor::TakeResult(task_id_t task_id)
+{
+  auto iter = m_records.find(task_id);
+  if (iter == m_records.end() || !iter->second->is_finished)
+  {
+    return {};
+  }
+
+  auto result = std::move(iter->second->task);
+  (void)m_records.erase(iter);
+  return result;
+}
+
+std::size_t TaskExecutor::GetTaskCount() const
+{
+  return m_records.size();
+}
+
+std::size_t TaskExecutor::GetActiveTaskCount() const
+{
+  return m_active_task_count;
+}
+
+std::size_t TaskExecutor::GetThreadCount() const
+{
+  return m_thread_pool->GetThreadCount();
+}
+
+void TaskExecutor::RunTask(task_id_t task_id, TaskRecord &record)
+{
+  auto status = TaskStatus::kCancelled;
+
+  if (!record.token.IsCancelled())
+  {
+    record.status.store(TaskStatus::kRunning);
+    QMetaObject::invokeMethod(
+        this, [this, task_id]() { ProcessStatusChanged(task_id); }, Qt::QueuedConnection);
+
+    TaskContext context(record.token, [this, task_id, &record](int progress)
+                        { OnProgressReported(task_id, record, progress); });
+    try
+    {
+      record.task->Run(context);
+      status = context.IsCancelled() ? TaskStatus::kCancelled : TaskStatus::kCompleted;
+    }
+    catch (...)
+    {
+      status = TaskStatus::kFailed;
+    }
+  }
+
+  record.status.store(status);
+  QMetaObject::invokeMethod(
+      this, [this, task_id]() { ProcessTaskFinished(task_id); }, Qt::QueuedConnection);
+}
+
+void TaskExecutor::OnProgressReported(task_id_t task_id, TaskRecord &record, int progress)
+{
+  if (record.progress.exchange(progress) == progress)
+  {
+    return;
+  }
+
+  // only one notification is on the way, it will pick up the latest value
+  if (!record.is_progress_pending.exchange(true))
+  {
+    QMetaObject::invokeMethod(
+        this, [this, task_id]() { ProcessProgressChanged(task_id); }, Qt::QueuedConnection);
+  }
+}
+
+void TaskExecutor::ProcessStatusChanged(task_id_t task_id)
+{
+  if (auto record = FindRecord(task_id); record && !record->is_finished)
+  {
+    emit TaskStatusChanged(task_id, static_cast<int>(TaskStatus::kRunning));
+  }
+}
+
+void TaskExecutor::ProcessProgressChanged(task_id_t task_id)
+{
+  if (auto record = FindRecord(task_id); record && !record->is_finished)
+  {
+    record->is_progress_pending.store(false);
+    emit TaskProgressChanged(task_id, record->progress.load());
+  }
+}
+
+void TaskExecutor::ProcessTaskFinished(task_id_t task_id)
+{
+  auto record = FindRecord(task_id);
+  if (!record)
+  {
+    return;
+  }
+
+  record->is_finished = true;
+  --m_active_task_count;
+
+  const auto status = record->status.load();
+  if (status == TaskStatus::kCompleted)
+  {
+    record->task->Finalize();
+  }
+
+  emit TaskStatusChanged(task_id, static_cast<int>(status));
+  emit TaskFinished(task_id, static_cast<int>(status));
+}
+
+TaskExecutor::TaskRecord *TaskExecutor::FindRecord(task_id_t task_id) const
+{
+  auto iter = m_records.find(task_id);
+  return iter == m_records.end() ? nullptr : iter->second.get();
+}
+
+}  // namespace sup::gui
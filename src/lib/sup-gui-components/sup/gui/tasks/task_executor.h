@@ -0,0 +1,160 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_TASKS_TASK_EXECUTOR_H_
+#define SUP_GUI_TASKS_TASK_EXECUTOR_H_
+
+#include <sup/gui/tasks/task_priority.h>
+#include <sup/gui/tasks/task_status.h>
+
+#include <QObject>
+#include <cstddef>
+#include <map>
+#include <memory>
+
+namespace sup::gui
+{
+
+class ITask;
+class ThreadPool;
+
+/**
+ * @brief The TaskExecutor class runs tasks in a fixed-size thread pool and reports their status
+ * to the GUI thread.
+ *
+ * Every submitted task gets an id and a cancellation token. Status, progress and completion are
+ * delivered through signals emitted in the thread the executor lives in, so the receivers don't
+ * need any locking. Successfully completed tasks are finalized in that thread too, right before
+ * TaskFinished. The finished task stays in the executor until taken back with TakeResult.
+ *
+ * All methods are expected to be called from the thread the executor lives in. On destruction,
+ * all tasks are cancelled and running tasks are waited for.
+ */
+class TaskExecutor : public QObject
+{
+  Q_OBJECT
+
+public:
+  using task_id_t = quint64;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param thread_count The number of threads, zero means the number of hardware threads.
+   * @param parent_object The parent object.
+   */
+  explicit TaskExecutor(std::size_t thread_count = 0, QObject* parent_object = nullptr);
+  ~TaskExecutor() override;
+
+  /**
+   * @brief Queues the task for execution.
+   *
+   * @return The id of the task.
+   */
+  task_id_t Submit(std::unique_ptr<ITask> task, TaskPriority priority = TaskPriority::kNormal);
+
+  /**
+   * @brief Requests the cancellation of the task with the given id.
+   *
+   * A queued task will not run. A running task should notice the cancellation via its context.
+   *
+   * @return True if the task is known and not finished yet.
+   */
+  bool Cancel(task_id_t task_id);
+
+  /**
+   * @brief Requests the cancellation of all tasks.
+   */
+  void CancelAll();
+
+  /**
+   * @brief Returns the status of the task with the given id.
+   *
+   * @throw RuntimeException if there is no such task.
+   */
+  TaskStatus GetStatus(task_id_t task_id) const;
+
+  /**
+   * @brief Returns the last reported progress of the task with the given id.
+   *
+   * @throw RuntimeException if there is no such task.
+   */
+  int GetProgress(task_id_t task_id) const;
+
+  /**
+   * @brief Checks if the task with the given id has finished and its result was delivered.
+   */
+  bool IsFinished(task_id_t task_id) const;
+
+  /**
+   * @brief Takes the finished task back and forgets about it.
+   *
+   * @return The task, or nullptr if there is no such task or it hasn't finished yet.
+   */
+  std::unique_ptr<ITask> TakeResult(task_id_t task_id);
+
+  /**
+   * @brief Returns the number of tasks in the executor, including finished tasks not taken yet.
+   */
+  std::size_t GetTaskCount() const;
+
+  /**
+   * @brief Returns the number of tasks which are queued or running.
+   */
+  std::size_t GetActiveTaskCount() const;
+
+  /**
+   * @brief Returns the number of threads.
+   */
+  std::size_t GetThreadCount() const;
+
+signals:
+  void TaskStatusChanged(quint64 task_id, int status);
+  void TaskProgressChanged(quint64 task_id, int progress);
+  void TaskFinished(quint64 task_id, int status);
+
+private:
+  struct TaskRecord;
+
+  /**
+   * @brief Runs the task in a pool thread.
+   */
+  void RunTask(task_id_t task_id, TaskRecord& record);
+
+  /**
+   * @brief Handles progress reported from a pool thread.
+   */
+  void OnProgressReported(task_id_t task_id, TaskRecord& record, int progress);
+
+  void ProcessStatusChanged(task_id_t task_id);
+  void ProcessProgressChanged(task_id_t task_id);
+  void ProcessTaskFinished(task_id_t task_id);
+
+  TaskRecord* FindRecord(task_id_t task_id) const;
+
+  std::map<task_id_t, std::shared_ptr<TaskRecord>> m_records;
+  std::unique_ptr<ThreadPool> m_thread_pool;
+  task_id_t m_next_task_id{1};
+  std::size_t m_active_task_count{0};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_TASK_EXECUTOR_H_
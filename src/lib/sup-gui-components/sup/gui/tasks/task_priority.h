@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_TASKS_TASK_PRIORITY_H_
+#define SUP_GUI_TASKS_TASK_PRIORITY_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The TaskPriority enum defines the order in which queued tasks are picked up by threads.
+ */
+enum class TaskPriority : std::uint8_t
+{
+  kHigh = 0,
+  kNormal,
+  kLow
+};
+
+/**
+ * @brief The number of priority levels.
+ */
+const std::size_t kTaskPriorityCount = 3;
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_TASK_PRIORITY_H_
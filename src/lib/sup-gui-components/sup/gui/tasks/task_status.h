@@ -0,0 +1,43 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_TASKS_TASK_STATUS_H_
+#define SUP_GUI_TASKS_TASK_STATUS_H_
+
+#include <cstdint>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The TaskStatus enum represents the status of a task submitted to TaskExecutor.
+ */
+enum class TaskStatus : std::uint8_t
+{
+  kQueued = 0,  //!< waiting for a free thread
+  kRunning,     //!< running in a thread
+  kCompleted,   //!< run till the end
+  kCancelled,   //!< cancelled before or during the run
+  kFailed       //!< run has thrown an exception
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_TASK_STATUS_H_
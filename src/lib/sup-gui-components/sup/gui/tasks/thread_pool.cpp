@@ -0,0 +1,224 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The pool owning the current thread, if any.
+ */
+thread_local const ThreadPool* current_pool = nullptr;
+
+/**
+ * @brief The index of the current thread in the pool.
+ */
+thread_local std::size_t current_worker_index = 0;
+
+}  // namespace
+
+/**
+ * @brief The WorkerQueue struct holds jobs of a single thread, one deque per priority.
+ */
+struct ThreadPool::WorkerQueue
+{
+  std::mutex mutex;
+  std::array<std::deque<job_t>, kTaskPriorityCount> jobs;
+};
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+{
+  if (thread_count == 0)
+  {
+    thread_count = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  for (std::size_t index = 0; index < thread_count; ++index)
+  {
+    (void)m_queues.emplace_back(std::make_unique<WorkerQueue>());
+  }
+
+  m_threads.reserve(thread_count);
+  for (std::size_t index = 0; index < thread_count; ++index)
+  {
+    (void)m_threads.emplace_back([this, index]() { RunWorker(index); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_job_available.notify_all();
+
+  // threads leave only when all queues are empty
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void ThreadPool::Submit(job_t job, TaskPriority priority)
+{
+  // jobs submitted from pool threads stay on the same thread, unless stolen
+  const auto queue_index = current_pool == this
+                               ? current_worker_index
+                               : m_next_queue.fetch_add(1) % m_queues.size();
+
+  ++m_pending_count;
+  {
+    auto& queue = *m_queues[queue_index];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs[static_cast<std::size_t>(priority)].push_back(std::move(job));
+  }
+  ++m_queued_count;
+
+  WakeUpThread();
+}
+
+std::size_t ThreadPool::GetThreadCount() const
+{
+  return m_threads.size();
+}
+
+std::size_t ThreadPool::GetPendingCount() const
+{
+  return m_pending_count.load();
+}
+
+void ThreadPool::WaitForIdle()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idle.wait(lock, [this]() { return m_pending_count.load() == 0; });
+}
+
+void ThreadPool::RunWorker(std::size_t worker_index)
+{
+  current_pool = this;
+  current_worker_index = worker_index;
+
+  while (true)
+  {
+    job_t job;
+    if (TakeJob(worker_index, job))
+    {
+      --m_queued_count;
+      try
+      {
+        job();
+      }
+      catch (...)
+      {
+        // jobs are expected to handle their own errors, the thread should survive anyway
+      }
+      job = nullptr;  // captured state is released before the job is reported as done
+      OnJobDone();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_queued_count.load() > 0)
+    {
+      continue;  // the job is being pushed, or was just taken by another thread
+    }
+    if (m_stop)
+    {
+      return;
+    }
+
+    // the counter is increased before the check, so that the submitter either sees the sleeping
+    // thread, or the thread sees the new job
+    ++m_sleeping_count;
+    m_job_available.wait(lock, [this]() { return m_stop || m_queued_count.load() > 0; });
+    --m_sleeping_count;
+  }
+}
+
+void ThreadPool::WakeUpThread()
+{
+  if (m_sleeping_count.load() == 0)
+  {
+    return;
+  }
+
+  {
+    // the thread is either waiting already, or will see the job before it starts to wait
+    const std::lock_guard<std::mutex> lock(m_mutex);
+  }
+  m_job_available.notify_one();
+}
+
+void ThreadPool::OnJobDone()
+{
+  if (--m_pending_count == 0)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+    }
+    m_idle.notify_all();
+  }
+}
+
+bool ThreadPool::TakeJob(std::size_t worker_index, job_t& job)
+{
+  const auto queue_count = m_queues.size();
+
+  for (std::size_t priority = 0; priority < kTaskPriorityCount; ++priority)
+  {
+    // oldest job from own queue
+    {
+      auto& queue = *m_queues[worker_index];
+      const std::lock_guard<std::mutex> lock(queue.mutex);
+      if (auto& jobs = queue.jobs[priority]; !jobs.empty())
+      {
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        return true;
+      }
+    }
+
+    // newest job from other queues
+    for (std::size_t offset = 1; offset < queue_count; ++offset)
+    {
+      auto& queue = *m_queues[(worker_index + offset) % queue_count];
+      const std::lock_guard<std::mutex> lock(queue.mutex);
+      if (auto& jobs = queue.jobs[priority]; !jobs.empty())
+      {
+        job = std::move(jobs.back());
+        jobs.pop_back();
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+}  // namespace sup::gui
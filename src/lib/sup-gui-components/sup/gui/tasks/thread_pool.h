@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_TASKS_THREAD_POOL_H_
+#define SUP_GUI_TASKS_THREAD_POOL_H_
+
+#include <sup/gui/tasks/task_priority.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ThreadPool class runs jobs in a fixed number of threads.
+ *
+ * Every thread has its own queue for each priority, protected by its own mutex. Jobs submitted
+ * from outside are distributed among queues in a round-robin manner, jobs submitted from a pool
+ * thread go to its own queue. A thread takes the oldest job of the highest priority from its own
+ * queue, and if there is none, steals the newest job of the same priority from other threads,
+ * before looking at lower priorities.
+ *
+ * Submitting and taking jobs touch only the queue mutexes and atomic counters. The common mutex is
+ * locked only to put idle threads to sleep and to wake them up.
+ *
+ * The destructor runs all jobs which are still queued, including jobs they submit, and then joins
+ * the threads. Owners which don't want queued jobs to do their work should make them cheap to run,
+ * e.g. by cancelling them beforehand.
+ */
+class ThreadPool
+{
+public:
+  using job_t = std::function<void()>;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param thread_count The number of threads, zero means the number of hardware threads.
+   */
+  explicit ThreadPool(std::size_t thread_count = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  /**
+   * @brief Adds the job to the queue.
+   */
+  void Submit(job_t job, TaskPriority priority = TaskPriority::kNormal);
+
+  /**
+   * @brief Returns the number of threads.
+   */
+  std::size_t GetThreadCount() const;
+
+  /**
+   * @brief Returns the number of jobs which are queued or running.
+   */
+  std::size_t GetPendingCount() const;
+
+  /**
+   * @brief Blocks until all queued and running jobs are done.
+   */
+  void WaitForIdle();
+
+private:
+  struct WorkerQueue;
+
+  void RunWorker(std::size_t worker_index);
+
+  /**
+   * @brief Takes the next job for the worker with the given index.
+   *
+   * @return False if there are no jobs in any of the queues.
+   */
+  bool TakeJob(std::size_t worker_index, job_t& job);
+
+  /**
+   * @brief Wakes up one of the sleeping threads, if any.
+   */
+  void WakeUpThread();
+
+  /**
+   * @brief Finishes the job taken by a thread, notifies waiters when the pool becomes idle.
+   */
+  void OnJobDone();
+
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_threads;
+  std::atomic<std::size_t> m_next_queue{0};
+
+  //!< jobs pushed into queues and not taken yet, can be negative for a moment while a job is taken
+  //!< before the submitter has counted it
+  std::atomic<std::ptrdiff_t> m_queued_count{0};
+  std::atomic<std::size_t> m_pending_count{0};   //!< jobs which are queued or running
+  std::atomic<std::size_t> m_sleeping_count{0};  //!< threads waiting for jobs
+
+  std::mutex m_mutex;  //!< used by condition variables and protects the stop flag
+  std::condition_variable m_job_available;
+  std::condition_variable m_idle;
+  bool m_stop{false};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_TASKS_THREAD_POOL_H_
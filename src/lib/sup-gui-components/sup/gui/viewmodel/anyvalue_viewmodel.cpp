@@ -21,11 +21,18 @@
 #include "anyvalue_viewmodel.h"
 
 #include "custom_row_strategies.h"
+#include "paged_children_strategy.h"
 
+#include <sup/gui/model/anyvalue_item.h>
 #include <sup/gui/model/anyvalue_item_utils.h>
 
+#include <mvvm/model/session_item.h>
+#include <mvvm/signals/event_types.h>
 #include <mvvm/viewmodel/standard_children_strategies.h>
-#include <mvvm/viewmodel/viewmodel_controller_factory.h>
+#include <mvvm/viewmodel/viewmodel_controller.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace sup::gui
 {
@@ -36,11 +43,219 @@ public:
   AnyValueChildrenStrategy() : mvvm::FixedItemTypeStrategy(GetAnyValueItemTypes()) {}
 };
 
+/**
+ * @brief The AnyValuePagedChildrenStrategy class counts children of AnyValueItem without
+ * collecting them, so checks done on every repaint stay cheap for huge arrays.
+ */
+class AnyValuePagedChildrenStrategy : public PagedChildrenStrategy
+{
+public:
+  explicit AnyValuePagedChildrenStrategy(int page_size)
+      : PagedChildrenStrategy(std::make_unique<AnyValueChildrenStrategy>(), page_size)
+  {
+  }
+
+protected:
+  int GetChildrenCount(const mvvm::SessionItem *parent) const override
+  {
+    if (auto anyvalue_item = dynamic_cast<const AnyValueItem *>(parent); anyvalue_item)
+    {
+      return anyvalue_item->GetChildrenCount();
+    }
+    return PagedChildrenStrategy::GetChildrenCount(parent);
+  }
+
+  std::vector<mvvm::SessionItem *> GetChildrenSlice(const mvvm::SessionItem *parent, int first,
+                                                    int last) const override
+  {
+    if (auto anyvalue_item = dynamic_cast<const AnyValueItem *>(parent); anyvalue_item)
+    {
+      const auto range = anyvalue_item->GetChildRange();
+      std::vector<mvvm::SessionItem *> result;
+      result.reserve(static_cast<std::size_t>(std::max(0, last - first)));
+      for (int index = first; index < last; ++index)
+      {
+        result.push_back(range[index]);
+      }
+      return result;
+    }
+    return PagedChildrenStrategy::GetChildrenSlice(parent, first, last);
+  }
+};
+
+/**
+ * @brief The AnyValueViewModelController class reports insertions and removals of children to the
+ * paged children strategy, before it processes them itself.
+ *
+ * The controller follows whatever model its root item belongs to, so does the strategy.
+ */
+class AnyValueViewModelController : public mvvm::ViewModelController
+{
+public:
+  AnyValueViewModelController(mvvm::ISessionModel *model, mvvm::ViewModel *view_model,
+                              PagedChildrenStrategy *children_strategy)
+      : mvvm::ViewModelController(model, view_model), m_children_strategy(children_strategy)
+  {
+  }
+
+  using mvvm::ViewModelController::OnModelEvent;
+
+  void OnModelEvent(const mvvm::ItemInsertedEvent &event) override
+  {
+    m_children_strategy->OnChildInserted(event.item, event.tag_index.GetIndex());
+    mvvm::ViewModelController::OnModelEvent(event);
+  }
+
+  void OnModelEvent(const mvvm::AboutToRemoveItemEvent &event) override
+  {
+    m_children_strategy->OnAboutToRemoveItem(event.item->GetItem(event.tag_index));
+    mvvm::ViewModelController::OnModelEvent(event);
+  }
+
+  void OnModelEvent(const mvvm::ItemRemovedEvent &event) override
+  {
+    m_children_strategy->OnChildRemoved(event.item, event.tag_index.GetIndex());
+    mvvm::ViewModelController::OnModelEvent(event);
+  }
+
+private:
+  PagedChildrenStrategy *m_children_strategy{nullptr};
+};
+
 AnyValueViewModel::AnyValueViewModel(mvvm::ISessionModel *model, QObject *parent_object)
+    : AnyValueViewModel(model, kDefaultFetchPageSize, parent_object)
+{
+}
+
+AnyValueViewModel::AnyValueViewModel(mvvm::ISessionModel *model, int fetch_page_size,
+                                     QObject *parent_object)
     : ViewModel(parent_object)
 {
-  SetController(
-      mvvm::factory::CreateController<AnyValueChildrenStrategy, AnyValueRowStrategy>(model, this));
+  // the strategy remembers parents it has seen, they might be gone after the reset
+  connect(this, &QAbstractItemModel::modelAboutToBeReset, this,
+          [this]() { m_children_strategy->Reset(); });
+
+  auto children_strategy = std::make_unique<AnyValuePagedChildrenStrategy>(fetch_page_size);
+  m_children_strategy = children_strategy.get();
+
+  // same as mvvm::factory::CreateController, we need to keep access to the children strategy,
+  // which learns about insertions and removals from the controller, the model can be set later
+  auto controller =
+      std::make_unique<AnyValueViewModelController>(model, this, m_children_strategy);
+  controller->SetChildrenStrategy(std::move(children_strategy));
+  controller->SetRowStrategy(std::make_unique<AnyValueRowStrategy>());
+  m_controller = controller.get();
+  SetController(std::move(controller));
+}
+
+AnyValueViewModel::~AnyValueViewModel() = default;
+
+bool AnyValueViewModel::hasChildren(const QModelIndex &parent) const
+{
+  // parent with rows not yet fetched should still show expand decoration
+  if (parent.column() <= 0)
+  {
+    if (auto item = GetParentItem(parent); item && m_children_strategy->CanFetchMore(item))
+    {
+      return true;
+    }
+  }
+  return ViewModel::hasChildren(parent);
+}
+
+bool AnyValueViewModel::canFetchMore(const QModelIndex &parent) const
+{
+  if (parent.column() > 0)
+  {
+    return false;
+  }
+  auto item = GetParentItem(parent);
+  return item && m_children_strategy->CanFetchMore(item);
+}
+
+void AnyValueViewModel::fetchMore(const QModelIndex &parent)
+{
+  if (parent.column() > 0)
+  {
+    return;
+  }
+  if (auto item = GetParentItem(parent); item)
+  {
+    FetchMore(item);
+  }
+}
+
+int AnyValueViewModel::GetFetchPageSize() const
+{
+  return m_children_strategy->GetPageSize();
+}
+
+void AnyValueViewModel::FetchItem(const mvvm::SessionItem *item)
+{
+  auto root_item = GetRootSessionItem();
+  if (!item || !root_item)
+  {
+    return;
+  }
+
+  // ancestors of the item till the root inclusive
+  std::vector<mvvm::SessionItem *> parents;
+  for (auto parent = item->GetParent(); parent; parent = parent->GetParent())
+  {
+    parents.push_back(parent);
+    if (parent == root_item)
+    {
+      break;
+    }
+  }
+
+  if (parents.empty() || parents.back() != root_item)
+  {
+    return;  // item doesn't belong to the root
+  }
+
+  // going from the root down, every next parent gets its row only after previous fetches
+  for (auto index = parents.size(); index > 0; --index)
+  {
+    auto parent = parents[index - 1];
+    const mvvm::SessionItem *child = index > 1 ? parents[index - 2] : item;
+    const int child_index = child->GetTagIndex().GetIndex();
+    while (!m_children_strategy->IsExposed(parent, child_index)
+           && m_children_strategy->CanFetchMore(parent))
+    {
+      FetchMore(parent);
+    }
+  }
+}
+
+mvvm::SessionItem *AnyValueViewModel::GetParentItem(const QModelIndex &parent) const
+{
+  return parent.isValid() ? GetSessionItemFromIndex(parent) : GetRootSessionItem();
+}
+
+void AnyValueViewModel::FetchMore(mvvm::SessionItem *parent)
+{
+  const auto children = m_children_strategy->FetchMore(parent);
+  if (children.empty())
+  {
+    return;
+  }
+
+  // children of AnyValueItem are consecutive in one tag, no need to look for every one of them
+  const bool is_anyvalue_parent = dynamic_cast<const AnyValueItem *>(parent) != nullptr;
+  auto tag_index = children.front()->GetTagIndex();
+
+  // the controller inserts rows of newly exposed children as if they were just inserted
+  for (auto child : children)
+  {
+    if (!is_anyvalue_parent)
+    {
+      tag_index = child->GetTagIndex();
+    }
+    m_controller->mvvm::ViewModelController::OnModelEvent(
+        mvvm::ItemInsertedEvent{parent, tag_index});
+    tag_index = tag_index.Next();
+  }
 }
 
 }  // namespace sup::gui
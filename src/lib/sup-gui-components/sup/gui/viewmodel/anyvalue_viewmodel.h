@@ -26,14 +26,28 @@
 namespace mvvm
 {
 class ISessionModel;
-}
+class SessionItem;
+class ViewModelController;
+}  // namespace mvvm
 
 namespace sup::gui
 {
 
+class PagedChildrenStrategy;
+
+/**
+ * @brief Default number of rows built by AnyValueViewModel on every fetch.
+ */
+const int kDefaultFetchPageSize = 1000;
+
 /**
  * @brief The AnyValueViewModel class is a view model to show AnyValueItem with editable display
  * name, value columnt, and type column.
+ *
+ * Rows of parents with more children than the fetch page size (i.e. huge arrays) are not built
+ * until the parent is expanded. The view requests them through canFetchMore/fetchMore, one page
+ * at a time, so the time to open the tree doesn't depend on array length. Such children are
+ * invisible for filtering proxies until fetched.
  */
 class AnyValueViewModel : public mvvm::ViewModel
 {
@@ -41,6 +55,50 @@ class AnyValueViewModel : public mvvm::ViewModel
 
 public:
   explicit AnyValueViewModel(mvvm::ISessionModel* model, QObject* parent_object = nullptr);
+
+  /**
+   * @brief C-tor with custom fetch page size.
+   *
+   * @param model The model to show.
+   * @param fetch_page_size The number of rows to build on every fetch, zero to build all at once.
+   * @param parent_object The parent object.
+   */
+  AnyValueViewModel(mvvm::ISessionModel* model, int fetch_page_size,
+                    QObject* parent_object = nullptr);
+
+  ~AnyValueViewModel() override;
+
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  bool canFetchMore(const QModelIndex& parent) const override;
+
+  void fetchMore(const QModelIndex& parent) override;
+
+  /**
+   * @brief Returns the number of rows built on every fetch.
+   */
+  int GetFetchPageSize() const;
+
+  /**
+   * @brief Fetches all pages which are necessary for the given item to get its row.
+   *
+   * It allows to select an item deep inside of the array which wasn't expanded yet.
+   */
+  void FetchItem(const mvvm::SessionItem* item);
+
+private:
+  /**
+   * @brief Returns the item which children are shown under the given index.
+   */
+  mvvm::SessionItem* GetParentItem(const QModelIndex& parent) const;
+
+  /**
+   * @brief Builds rows for the next page of children of the given parent.
+   */
+  void FetchMore(mvvm::SessionItem* parent);
+
+  mvvm::ViewModelController* m_controller{nullptr};
+  PagedChildrenStrategy* m_children_strategy{nullptr};
 };
 
 }  // namespace sup::gui
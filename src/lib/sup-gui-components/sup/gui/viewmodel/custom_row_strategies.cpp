@@ -42,6 +42,14 @@ bool HasEditableDisplayName(const sup::gui::AnyValueItem &item)
   return !(item_parent && item_parent->IsArray());
 }
 
+/**
+ * @brief Returns a text describing elements of the packed array, e.g. "float64[1000]".
+ */
+std::string GetScalarArraySummary(const sup::gui::AnyValueScalarArrayItem &item)
+{
+  return item.GetElementTypeName() + "[" + std::to_string(item.GetElementCount()) + "]";
+}
+
 }  // namespace
 
 namespace sup::gui
@@ -79,8 +87,16 @@ std::vector<std::unique_ptr<mvvm::ViewItem>> AnyValueRowStrategy::ConstructRowIm
     (void)result.emplace_back(mvvm::CreateDisplayNameViewItem(anyvalue_item));
   }
 
-  // second column
-  (void)result.emplace_back(mvvm::CreateDataViewItem(anyvalue_item));
+  // second column, packed arrays show the summary of their elements
+  if (auto packed_item = dynamic_cast<AnyValueScalarArrayItem *>(anyvalue_item); packed_item)
+  {
+    (void)result.emplace_back(
+        mvvm::CreateLabelViewItem(anyvalue_item, GetScalarArraySummary(*packed_item)));
+  }
+  else
+  {
+    (void)result.emplace_back(mvvm::CreateDataViewItem(anyvalue_item));
+  }
 
   // third column
   (void)result.emplace_back(
@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "paged_children_strategy.h"
+
+#include <mvvm/model/session_item.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief The value marking a parent with all children exposed.
+ */
+const int kAllExposed = -1;
+
+}  // namespace
+
+PagedChildrenStrategy::PagedChildrenStrategy(std::unique_ptr<mvvm::IChildrenStrategy> strategy,
+                                             int page_size)
+    : m_strategy(std::move(strategy)), m_page_size(std::max(0, page_size))
+{
+}
+
+PagedChildrenStrategy::~PagedChildrenStrategy() = default;
+
+std::vector<mvvm::SessionItem *> PagedChildrenStrategy::GetChildren(
+    const mvvm::SessionItem *item) const
+{
+  if (m_page_size == 0)
+  {
+    return m_strategy->GetChildren(item);
+  }
+
+  const int exposed_count = GetExposedCount(item);
+  if (exposed_count == 0)
+  {
+    return {};
+  }
+
+  if (exposed_count == kAllExposed)
+  {
+    return m_strategy->GetChildren(item);
+  }
+
+  // partially exposed parent, only exposed children are taken
+  return GetChildrenSlice(item, 0, std::min(exposed_count, GetChildrenCount(item)));
+}
+
+int PagedChildrenStrategy::GetPageSize() const
+{
+  return m_page_size;
+}
+
+bool PagedChildrenStrategy::CanFetchMore(const mvvm::SessionItem *parent) const
+{
+  auto iter = m_exposed_count.find(parent);
+  if (iter == m_exposed_count.end() || iter->second == kAllExposed)
+  {
+    return false;
+  }
+  return iter->second < GetChildrenCount(parent);
+}
+
+std::vector<mvvm::SessionItem *> PagedChildrenStrategy::FetchMore(const mvvm::SessionItem *parent)
+{
+  auto iter = m_exposed_count.find(parent);
+  if (iter == m_exposed_count.end() || iter->second == kAllExposed)
+  {
+    return {};
+  }
+
+  const int children_count = GetChildrenCount(parent);
+  const int first = std::min(iter->second, children_count);
+  const int last = std::min(first + m_page_size, children_count);
+  iter->second = last == children_count ? kAllExposed : last;
+
+  return GetChildrenSlice(parent, first, last);
+}
+
+bool PagedChildrenStrategy::IsExposed(const mvvm::SessionItem *parent, int index) const
+{
+  if (index < 0)
+  {
+    return false;
+  }
+  if (m_page_size == 0)
+  {
+    return true;
+  }
+  const int exposed_count = GetExposedCount(parent);
+  return exposed_count == kAllExposed || index < exposed_count;
+}
+
+void PagedChildrenStrategy::OnChildInserted(const mvvm::SessionItem *parent, int index)
+{
+  auto iter = m_exposed_count.find(parent);
+  if (iter != m_exposed_count.end() && iter->second != kAllExposed && index < iter->second)
+  {
+    ++iter->second;
+  }
+}
+
+void PagedChildrenStrategy::OnAboutToRemoveItem(const mvvm::SessionItem *item)
+{
+  auto is_removed = [item](const mvvm::SessionItem *parent)
+  {
+    for (auto current = parent; current; current = current->GetParent())
+    {
+      if (current == item)
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (auto iter = m_exposed_count.begin(); iter != m_exposed_count.end();)
+  {
+    iter = is_removed(iter->first) ? m_exposed_count.erase(iter) : std::next(iter);
+  }
+}
+
+void PagedChildrenStrategy::OnChildRemoved(const mvvm::SessionItem *parent, int index)
+{
+  auto iter = m_exposed_count.find(parent);
+  if (iter != m_exposed_count.end() && iter->second != kAllExposed && index < iter->second)
+  {
+    --iter->second;
+  }
+}
+
+void PagedChildrenStrategy::Reset()
+{
+  m_exposed_count.clear();
+}
+
+int PagedChildrenStrategy::GetChildrenCount(const mvvm::SessionItem *parent) const
+{
+  return static_cast<int>(m_strategy->GetChildren(parent).size());
+}
+
+std::vector<mvvm::SessionItem *> PagedChildrenStrategy::GetChildrenSlice(
+    const mvvm::SessionItem *parent, int first, int last) const
+{
+  auto children = m_strategy->GetChildren(parent);
+  const auto begin = static_cast<std::size_t>(std::max(0, first));
+  const auto end = std::min(static_cast<std::size_t>(std::max(0, last)), children.size());
+  if (begin >= end)
+  {
+    return {};
+  }
+  return {children.begin() + begin, children.begin() + end};
+}
+
+int PagedChildrenStrategy::GetExposedCount(const mvvm::SessionItem *parent) const
+{
+  auto iter = m_exposed_count.find(parent);
+  if (iter == m_exposed_count.end())
+  {
+    const int children_count = GetChildrenCount(parent);
+    if (children_count == 0)
+    {
+      return kAllExposed;  // no need to remember leaves
+    }
+    // parent seen for the first time: small parents are exposed entirely and stay so
+    const int exposed_count = children_count > m_page_size ? 0 : kAllExposed;
+    iter = m_exposed_count.emplace(parent, exposed_count).first;
+  }
+  return iter->second;
+}
+
+}  // namespace sup::gui
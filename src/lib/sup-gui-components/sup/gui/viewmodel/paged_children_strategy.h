@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWMODEL_PAGED_CHILDREN_STRATEGY_H_
+#define SUP_GUI_VIEWMODEL_PAGED_CHILDREN_STRATEGY_H_
+
+#include <mvvm/viewmodel/i_children_strategy.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The PagedChildrenStrategy class decorates another children strategy and reports children
+ * of large parents page by page.
+ *
+ * Parents with a number of children not exceeding the page size are reported as they are. Parents
+ * with more children are reported as empty until the next page is explicitly fetched. It allows
+ * the view model to build rows of huge arrays only when the user expands them.
+ *
+ * The strategy remembers the number of exposed children for every parent it has seen. A parent that
+ * was once fully exposed stays fully exposed, so newly inserted children appear immediately. The
+ * owner has to report insertions and removals of children, so the number of exposed children of
+ * partially exposed parents follows the model.
+ */
+class PagedChildrenStrategy : public mvvm::IChildrenStrategy
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param strategy The strategy to report all children of a parent.
+   * @param page_size The number of children to expose in one go, zero means no paging at all.
+   */
+  PagedChildrenStrategy(std::unique_ptr<mvvm::IChildrenStrategy> strategy, int page_size);
+  ~PagedChildrenStrategy() override;
+
+  std::vector<mvvm::SessionItem*> GetChildren(const mvvm::SessionItem* item) const override;
+
+  /**
+   * @brief Returns the page size.
+   */
+  int GetPageSize() const;
+
+  /**
+   * @brief Checks if the given parent has children which are not exposed yet.
+   */
+  bool CanFetchMore(const mvvm::SessionItem* parent) const;
+
+  /**
+   * @brief Exposes the next page of children of the given parent.
+   *
+   * @return Children which became exposed.
+   */
+  std::vector<mvvm::SessionItem*> FetchMore(const mvvm::SessionItem* parent);
+
+  /**
+   * @brief Checks if the child with the given index is currently exposed by the parent.
+   */
+  bool IsExposed(const mvvm::SessionItem* parent, int index) const;
+
+  /**
+   * @brief Updates the number of exposed children after the child was inserted into the parent.
+   *
+   * Should be called before the view model processes the insertion. A child inserted in the middle
+   * of exposed children becomes exposed too, so children exposed before stay exposed.
+   */
+  void OnChildInserted(const mvvm::SessionItem* parent, int index);
+
+  /**
+   * @brief Forgets about the item which is about to be removed, and about all its descendants.
+   */
+  void OnAboutToRemoveItem(const mvvm::SessionItem* item);
+
+  /**
+   * @brief Updates the number of exposed children after the child was removed from the parent.
+   */
+  void OnChildRemoved(const mvvm::SessionItem* parent, int index);
+
+  /**
+   * @brief Forgets about all parents seen so far.
+   *
+   * Should be called before the view model is rebuilt, since recorded parents might be deleted.
+   */
+  void Reset();
+
+protected:
+  /**
+   * @brief Returns the number of children of the given parent.
+   *
+   * Default implementation collects all children using the decorated strategy. Derived classes
+   * can count children without collecting them.
+   */
+  virtual int GetChildrenCount(const mvvm::SessionItem* parent) const;
+
+  /**
+   * @brief Returns children of the given parent with indices in [first, last) interval.
+   *
+   * Default implementation collects all children using the decorated strategy. Derived classes
+   * can take children by index without collecting all of them.
+   */
+  virtual std::vector<mvvm::SessionItem*> GetChildrenSlice(const mvvm::SessionItem* parent,
+                                                           int first, int last) const;
+
+private:
+  /**
+   * @brief Returns the number of exposed children of the given parent, registers the parent if
+   * necessary.
+   */
+  int GetExposedCount(const mvvm::SessionItem* parent) const;
+
+  std::unique_ptr<mvvm::IChildrenStrategy> m_strategy;
+  int m_page_size{0};
+  mutable std::unordered_map<const mvvm::SessionItem*, int> m_exposed_count;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWMODEL_PAGED_CHILDREN_STRATEGY_H_
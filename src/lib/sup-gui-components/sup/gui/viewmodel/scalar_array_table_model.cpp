@@ -0,0 +1,315 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "scalar_array_table_model.h"
+
+#include "anyvalue_viewmodel.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+
+#include <mvvm/model/i_session_model.h>
+#include <mvvm/model/item_utils.h>
+#include <mvvm/signals/event_types.h>
+#include <mvvm/signals/model_listener.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Converts an element of the buffer to QVariant.
+ */
+QVariant GetQtVariant(const mvvm::variant_t& value)
+{
+  auto on_value = [](const auto& element) -> QVariant
+  {
+    using value_t = std::decay_t<decltype(element)>;
+    if constexpr (std::is_same_v<value_t, bool>)
+    {
+      return QVariant(element);
+    }
+    else if constexpr (std::is_integral_v<value_t> && std::is_signed_v<value_t>)
+    {
+      return QVariant(static_cast<qlonglong>(element));
+    }
+    else if constexpr (std::is_integral_v<value_t>)
+    {
+      return QVariant(static_cast<qulonglong>(element));
+    }
+    else if constexpr (std::is_floating_point_v<value_t>)
+    {
+      return QVariant(static_cast<double>(element));
+    }
+    else
+    {
+      return QVariant();
+    }
+  };
+  return std::visit(on_value, value);
+}
+
+/**
+ * @brief Converts QVariant to the type of the given element.
+ *
+ * @return Empty variant if the value can't be represented by the element type.
+ */
+mvvm::variant_t GetElementVariant(const QVariant& value, const mvvm::variant_t& element)
+{
+  auto on_element = [&value](const auto& current) -> mvvm::variant_t
+  {
+    using value_t = std::decay_t<decltype(current)>;
+    if constexpr (std::is_same_v<value_t, bool>)
+    {
+      return value.toBool();
+    }
+    else if constexpr (std::is_integral_v<value_t> && std::is_signed_v<value_t>)
+    {
+      bool is_ok{false};
+      const auto result = value.toLongLong(&is_ok);
+      if (is_ok && result >= std::numeric_limits<value_t>::min()
+          && result <= std::numeric_limits<value_t>::max())
+      {
+        return mvvm::variant_t(std::in_place_type<value_t>, static_cast<value_t>(result));
+      }
+    }
+    else if constexpr (std::is_integral_v<value_t>)
+    {
+      bool is_ok{false};
+      const auto result = value.toULongLong(&is_ok);
+      if (is_ok && result <= std::numeric_limits<value_t>::max())
+      {
+        return mvvm::variant_t(std::in_place_type<value_t>, static_cast<value_t>(result));
+      }
+    }
+    else if constexpr (std::is_floating_point_v<value_t>)
+    {
+      bool is_ok{false};
+      const auto result = value.toDouble(&is_ok);
+      if (is_ok)
+      {
+        return mvvm::variant_t(std::in_place_type<value_t>, static_cast<value_t>(result));
+      }
+    }
+    return {};
+  };
+  return std::visit(on_element, element);
+}
+
+}  // namespace
+
+ScalarArrayTableModel::ScalarArrayTableModel(QObject* parent_object)
+    : ScalarArrayTableModel(kDefaultFetchPageSize, parent_object)
+{
+}
+
+ScalarArrayTableModel::ScalarArrayTableModel(int fetch_page_size, QObject* parent_object)
+    : QAbstractTableModel(parent_object), m_fetch_page_size(std::max(0, fetch_page_size))
+{
+}
+
+ScalarArrayTableModel::~ScalarArrayTableModel() = default;
+
+void ScalarArrayTableModel::SetItem(AnyValueScalarArrayItem* item)
+{
+  m_listener.reset();
+  m_item = item;
+
+  if (m_item && m_item->GetModel())
+  {
+    m_listener = std::make_unique<mvvm::ModelListener>(m_item->GetModel());
+    m_listener->Connect<mvvm::DataChangedEvent>(
+        [this](const auto& event)
+        {
+          if (event.item->GetParent() == m_item && !m_is_setting_data)
+          {
+            ScheduleItemDataChanged();
+          }
+        });
+    m_listener->Connect<mvvm::AboutToRemoveItemEvent>(
+        [this](const auto& event)
+        {
+          auto removed = event.item->GetItem(event.tag_index);
+          if (m_item && (removed == m_item || mvvm::utils::IsItemAncestor(m_item, removed)))
+          {
+            // the listener is kept until the next SetItem, we are inside its callback
+            m_item = nullptr;
+            Refresh();
+          }
+        });
+  }
+
+  Refresh();
+}
+
+AnyValueScalarArrayItem* ScalarArrayTableModel::GetItem() const
+{
+  return m_item;
+}
+
+void ScalarArrayTableModel::Refresh()
+{
+  beginResetModel();
+  m_buffer = m_item ? m_item->GetBuffer() : ScalarArrayBuffer();
+  const int element_count = GetElementCount();
+  m_fetched_count =
+      m_fetch_page_size == 0 ? element_count : std::min(m_fetch_page_size, element_count);
+  endResetModel();
+}
+
+int ScalarArrayTableModel::GetFetchPageSize() const
+{
+  return m_fetch_page_size;
+}
+
+int ScalarArrayTableModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : m_fetched_count;
+}
+
+int ScalarArrayTableModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : 1;
+}
+
+QVariant ScalarArrayTableModel::data(const QModelIndex& index, int role) const
+{
+  if (!index.isValid() || index.row() >= m_fetched_count
+      || (role != Qt::DisplayRole && role != Qt::EditRole))
+  {
+    return {};
+  }
+
+  return GetQtVariant(m_buffer.GetElement(static_cast<std::size_t>(index.row())));
+}
+
+bool ScalarArrayTableModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+  if (!m_item || !index.isValid() || index.row() >= m_fetched_count || role != Qt::EditRole)
+  {
+    return false;
+  }
+
+  const auto row = static_cast<std::size_t>(index.row());
+  const auto element = GetElementVariant(value, m_buffer.GetElement(row));
+  if (element.index() == 0)
+  {
+    return false;  // value can't be represented by the element type
+  }
+
+  m_buffer.SetElement(row, element);
+  m_is_setting_data = true;
+  m_item->SetElement(row, element);
+  m_is_setting_data = false;
+  emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+  return true;
+}
+
+Qt::ItemFlags ScalarArrayTableModel::flags(const QModelIndex& index) const
+{
+  auto result = QAbstractTableModel::flags(index);
+  if (index.isValid())
+  {
+    result |= Qt::ItemIsEditable;
+  }
+  return result;
+}
+
+QVariant ScalarArrayTableModel::headerData(int section, Qt::Orientation orientation,
+                                           int role) const
+{
+  if (role != Qt::DisplayRole)
+  {
+    return {};
+  }
+
+  if (orientation == Qt::Horizontal)
+  {
+    return section == 0 ? QVariant(QString("Value")) : QVariant();
+  }
+
+  return QVariant(section);  // element index
+}
+
+bool ScalarArrayTableModel::canFetchMore(const QModelIndex& parent) const
+{
+  return !parent.isValid() && m_fetched_count < GetElementCount();
+}
+
+void ScalarArrayTableModel::fetchMore(const QModelIndex& parent)
+{
+  if (!canFetchMore(parent))
+  {
+    return;
+  }
+
+  const int last = std::min(m_fetched_count + m_fetch_page_size, GetElementCount());
+  beginInsertRows(QModelIndex(), m_fetched_count, last - 1);
+  m_fetched_count = last;
+  endInsertRows();
+}
+
+int ScalarArrayTableModel::GetElementCount() const
+{
+  return static_cast<int>(m_buffer.GetSize());
+}
+
+void ScalarArrayTableModel::ScheduleItemDataChanged()
+{
+  if (m_update_pending)
+  {
+    return;
+  }
+
+  // properties of the item are changed one by one, they are consistent only after the whole change
+  m_update_pending = true;
+  auto on_update = [this]()
+  {
+    m_update_pending = false;
+    if (m_item)
+    {
+      OnItemDataChanged();
+    }
+  };
+  QMetaObject::invokeMethod(this, on_update, Qt::QueuedConnection);
+}
+
+void ScalarArrayTableModel::OnItemDataChanged()
+{
+  if (m_item->GetElementCount() != m_buffer.GetSize()
+      || m_item->GetElementTypeName() != m_buffer.GetElementTypeName())
+  {
+    Refresh();
+    return;
+  }
+
+  m_buffer = m_item->GetBuffer();
+  if (m_fetched_count > 0)
+  {
+    emit dataChanged(index(0, 0), index(m_fetched_count - 1, 0), {Qt::DisplayRole, Qt::EditRole});
+  }
+}
+
+}  // namespace sup::gui
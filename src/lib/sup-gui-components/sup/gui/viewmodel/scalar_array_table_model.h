@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWMODEL_SCALAR_ARRAY_TABLE_MODEL_H_
+#define SUP_GUI_VIEWMODEL_SCALAR_ARRAY_TABLE_MODEL_H_
+
+#include <sup/gui/model/scalar_array_buffer.h>
+
+#include <QAbstractTableModel>
+
+#include <memory>
+
+namespace mvvm
+{
+class ModelListener;
+}  // namespace mvvm
+
+namespace sup::gui
+{
+
+class AnyValueScalarArrayItem;
+
+/**
+ * @brief The ScalarArrayTableModel class shows elements of AnyValueScalarArrayItem as rows of a
+ * table.
+ *
+ * Rows are virtual, there are no items behind them and every cell is decoded from the buffer on
+ * request. Rows are reported page by page through canFetchMore/fetchMore, so a view showing an
+ * array with millions of elements stays responsive. An edited element is written back to the item
+ * as a single undoable change.
+ *
+ * The model keeps a copy of the buffer and follows changes of the item made from outside, e.g. by
+ * undo/redo. The item is forgotten when it is removed from the model.
+ */
+class ScalarArrayTableModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  explicit ScalarArrayTableModel(QObject* parent_object = nullptr);
+
+  /**
+   * @brief C-tor with custom fetch page size.
+   *
+   * @param fetch_page_size The number of rows to report on every fetch, zero to report all at once.
+   * @param parent_object The parent object.
+   */
+  explicit ScalarArrayTableModel(int fetch_page_size, QObject* parent_object = nullptr);
+
+  ~ScalarArrayTableModel() override;
+
+  /**
+   * @brief Sets the item to show, nullptr to show nothing.
+   */
+  void SetItem(AnyValueScalarArrayItem* item);
+
+  AnyValueScalarArrayItem* GetItem() const;
+
+  /**
+   * @brief Reloads elements from the item.
+   */
+  void Refresh();
+
+  /**
+   * @brief Returns the number of rows reported on every fetch.
+   */
+  int GetFetchPageSize() const;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+
+  Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+  QVariant headerData(int section, Qt::Orientation orientation,
+                      int role = Qt::DisplayRole) const override;
+
+  bool canFetchMore(const QModelIndex& parent) const override;
+
+  void fetchMore(const QModelIndex& parent) override;
+
+private:
+  /**
+   * @brief Returns the number of elements in the buffer.
+   */
+  int GetElementCount() const;
+
+  /**
+   * @brief Schedules OnItemDataChanged() to the next event loop iteration.
+   */
+  void ScheduleItemDataChanged();
+
+  /**
+   * @brief Reloads elements after the item was changed from outside.
+   *
+   * @details Rows are kept if the number of elements stays the same.
+   */
+  void OnItemDataChanged();
+
+  AnyValueScalarArrayItem* m_item{nullptr};
+  ScalarArrayBuffer m_buffer;
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  bool m_is_setting_data{false};  //!< the item is being changed by this model
+  bool m_update_pending{false};   //!< OnItemDataChanged() is scheduled
+  int m_fetch_page_size{0};
+  int m_fetched_count{0};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWMODEL_SCALAR_ARRAY_TABLE_MODEL_H_
@@ -0,0 +1,535 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "json_validator.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Maximum number of characters in the excerpt before the error position.
+ */
+const std::size_t kMaxExcerptHead = 60;
+
+/**
+ * @brief Maximum number of characters in the excerpt starting from the error position.
+ */
+const std::size_t kMaxExcerptTail = 20;
+
+/**
+ * @brief The size of a chunk to read from a file.
+ */
+const std::size_t kFileChunkSize = 64 * 1024;
+
+bool IsWhitespace(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+bool IsDigit(char ch)
+{
+  return ch >= '0' && ch <= '9';
+}
+
+bool IsHexDigit(char ch)
+{
+  return IsDigit(ch) || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+}
+
+/**
+ * @brief Returns the text suitable for a single line message.
+ */
+std::string GetPrintableText(const std::string& text)
+{
+  std::string result(text);
+  std::replace_if(
+      result.begin(), result.end(), [](char ch) { return static_cast<unsigned char>(ch) < 0x20; },
+      ' ');
+  return result;
+}
+
+/**
+ * @brief Returns the end of the line text to start the excerpt with.
+ */
+std::string GetLineHead(const std::string& line_text)
+{
+  return line_text.size() > kMaxExcerptHead ? line_text.substr(line_text.size() - kMaxExcerptHead)
+                                            : line_text;
+}
+
+}  // namespace
+
+JsonValidator::JsonValidator() = default;
+
+bool JsonValidator::Feed(const char* data, std::size_t size)
+{
+  if (!IsValid())
+  {
+    return false;
+  }
+
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    if (!ProcessChar(data[index]))
+    {
+      // the tail of the excerpt is taken from the same chunk up to the end of the line
+      const char* tail_begin = data + index;
+      const char* tail_end = tail_begin + std::min(kMaxExcerptTail, size - index);
+      tail_end = std::find_if(tail_begin, tail_end,
+                              [](char ch) { return ch == '\n' || ch == '\r'; });
+      m_excerpt = GetPrintableText(GetLineHead(m_line_text) + std::string(tail_begin, tail_end));
+      return false;
+    }
+    UpdatePosition(data[index]);
+  }
+
+  return true;
+}
+
+bool JsonValidator::Feed(const std::string& data)
+{
+  return Feed(data.data(), data.size());
+}
+
+bool JsonValidator::Finish()
+{
+  if (!IsValid())
+  {
+    return false;
+  }
+
+  if (m_containers.empty() && IsNumberComplete())
+  {
+    EndValue();
+  }
+
+  if (m_state != State::kDone)
+  {
+    SetError(m_offset == 0 ? "empty document" : "unexpected end of document");
+    m_excerpt = GetPrintableText(GetLineHead(m_line_text));
+    return false;
+  }
+
+  return true;
+}
+
+bool JsonValidator::IsValid() const
+{
+  return m_description.empty();
+}
+
+std::size_t JsonValidator::GetLine() const
+{
+  return m_line;
+}
+
+std::size_t JsonValidator::GetColumn() const
+{
+  return m_column;
+}
+
+std::size_t JsonValidator::GetOffset() const
+{
+  return m_offset;
+}
+
+std::string JsonValidator::GetDescription() const
+{
+  return m_description;
+}
+
+std::string JsonValidator::GetExcerpt() const
+{
+  return m_excerpt;
+}
+
+std::string JsonValidator::GetErrorMessage() const
+{
+  if (IsValid())
+  {
+    return {};
+  }
+
+  return "line " + std::to_string(m_line) + ", column " + std::to_string(m_column) + ": "
+         + m_description + ", near '" + m_excerpt + "'";
+}
+
+bool JsonValidator::ProcessChar(char ch)
+{
+  switch (m_state)
+  {
+  case State::kString:
+    if (ch == '"')
+    {
+      if (m_is_key)
+      {
+        m_state = State::kColon;
+      }
+      else
+      {
+        EndValue();
+      }
+    }
+    else if (ch == '\\')
+    {
+      m_state = State::kStringEscape;
+    }
+    else if (static_cast<unsigned char>(ch) < 0x20)
+    {
+      SetError("control character in string");
+    }
+    break;
+
+  case State::kStringEscape:
+    if (ch == 'u')
+    {
+      m_hex_digit_count = 0;
+      m_state = State::kStringUnicode;
+    }
+    else if (ch != '\0' && std::strchr("\"\\/bfnrt", ch) != nullptr)
+    {
+      m_state = State::kString;
+    }
+    else
+    {
+      SetError("invalid escape sequence in string");
+    }
+    break;
+
+  case State::kStringUnicode:
+    if (!IsHexDigit(ch))
+    {
+      SetError("invalid unicode escape sequence in string");
+    }
+    else if (++m_hex_digit_count == 4)
+    {
+      m_state = State::kString;
+    }
+    break;
+
+  case State::kLiteral:
+    if (ch != m_literal[m_literal_pos])
+    {
+      SetError("invalid literal");
+    }
+    else if (m_literal[++m_literal_pos] == '\0')
+    {
+      EndValue();
+    }
+    break;
+
+  case State::kNumberMinus:
+  case State::kNumberZero:
+  case State::kNumberInteger:
+  case State::kNumberDot:
+  case State::kNumberFraction:
+  case State::kNumberExponent:
+  case State::kNumberExponentSign:
+  case State::kNumberExponentDigits:
+    return ProcessNumberChar(ch);
+
+  default:
+    if (IsWhitespace(ch))
+    {
+      break;
+    }
+
+    if (m_state == State::kValue)
+    {
+      if (!StartValue(ch))
+      {
+        SetError("expected value");
+      }
+    }
+    else if (m_state == State::kValueOrArrayEnd)
+    {
+      if (ch == ']')
+      {
+        (void)CloseContainer(ch);
+      }
+      else if (!StartValue(ch))
+      {
+        SetError("expected value or ']'");
+      }
+    }
+    else if (m_state == State::kKeyOrObjectEnd || m_state == State::kKey)
+    {
+      if (ch == '"')
+      {
+        m_is_key = true;
+        m_state = State::kString;
+      }
+      else if (ch == '}' && m_state == State::kKeyOrObjectEnd)
+      {
+        (void)CloseContainer(ch);
+      }
+      else
+      {
+        SetError("expected object key");
+      }
+    }
+    else if (m_state == State::kColon)
+    {
+      if (ch == ':')
+      {
+        m_state = State::kValue;
+      }
+      else
+      {
+        SetError("expected ':' after object key");
+      }
+    }
+    else if (m_state == State::kCommaOrEnd)
+    {
+      const bool is_object = m_containers.back() == '{';
+      if (ch == ',')
+      {
+        m_state = is_object ? State::kKey : State::kValue;
+      }
+      else if (!CloseContainer(ch))
+      {
+        SetError(is_object ? "expected ',' or '}'" : "expected ',' or ']'");
+      }
+    }
+    else
+    {
+      SetError("unexpected content after the end of document");
+    }
+  }
+
+  return IsValid();
+}
+
+bool JsonValidator::ProcessNumberChar(char ch)
+{
+  const bool is_digit = IsDigit(ch);
+  const bool is_exponent = ch == 'e' || ch == 'E';
+
+  switch (m_state)
+  {
+  case State::kNumberMinus:
+    if (!is_digit)
+    {
+      SetError("invalid number");
+      return false;
+    }
+    m_state = ch == '0' ? State::kNumberZero : State::kNumberInteger;
+    return true;
+
+  case State::kNumberZero:
+  case State::kNumberInteger:
+    if (is_digit && m_state == State::kNumberInteger)
+    {
+      return true;
+    }
+    if (ch == '.')
+    {
+      m_state = State::kNumberDot;
+      return true;
+    }
+    if (is_exponent)
+    {
+      m_state = State::kNumberExponent;
+      return true;
+    }
+    break;
+
+  case State::kNumberDot:
+    if (!is_digit)
+    {
+      SetError("invalid number");
+      return false;
+    }
+    m_state = State::kNumberFraction;
+    return true;
+
+  case State::kNumberFraction:
+    if (is_digit)
+    {
+      return true;
+    }
+    if (is_exponent)
+    {
+      m_state = State::kNumberExponent;
+      return true;
+    }
+    break;
+
+  case State::kNumberExponent:
+    if (ch == '+' || ch == '-')
+    {
+      m_state = State::kNumberExponentSign;
+      return true;
+    }
+    [[fallthrough]];
+
+  case State::kNumberExponentSign:
+    if (!is_digit)
+    {
+      SetError("invalid number");
+      return false;
+    }
+    m_state = State::kNumberExponentDigits;
+    return true;
+
+  case State::kNumberExponentDigits:
+    if (is_digit)
+    {
+      return true;
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  // the number is complete, the character belongs to what follows it
+  EndValue();
+  return ProcessChar(ch);
+}
+
+bool JsonValidator::StartValue(char ch)
+{
+  switch (ch)
+  {
+  case '{':
+    m_containers.push_back(ch);
+    m_state = State::kKeyOrObjectEnd;
+    return true;
+  case '[':
+    m_containers.push_back(ch);
+    m_state = State::kValueOrArrayEnd;
+    return true;
+  case '"':
+    m_is_key = false;
+    m_state = State::kString;
+    return true;
+  case '-':
+    m_state = State::kNumberMinus;
+    return true;
+  case '0':
+    m_state = State::kNumberZero;
+    return true;
+  case 't':
+    m_literal = "true";
+    break;
+  case 'f':
+    m_literal = "false";
+    break;
+  case 'n':
+    m_literal = "null";
+    break;
+  default:
+    if (IsDigit(ch))
+    {
+      m_state = State::kNumberInteger;
+      return true;
+    }
+    return false;
+  }
+
+  m_literal_pos = 1;
+  m_state = State::kLiteral;
+  return true;
+}
+
+bool JsonValidator::CloseContainer(char ch)
+{
+  const char expected = m_containers.back() == '{' ? '}' : ']';
+  if (ch != expected)
+  {
+    return false;
+  }
+
+  m_containers.pop_back();
+  EndValue();
+  return true;
+}
+
+void JsonValidator::EndValue()
+{
+  m_state = m_containers.empty() ? State::kDone : State::kCommaOrEnd;
+}
+
+bool JsonValidator::IsNumberComplete() const
+{
+  return m_state == State::kNumberZero || m_state == State::kNumberInteger
+         || m_state == State::kNumberFraction || m_state == State::kNumberExponentDigits;
+}
+
+void JsonValidator::SetError(const std::string& description)
+{
+  m_description = description;
+}
+
+void JsonValidator::UpdatePosition(char ch)
+{
+  ++m_offset;
+  if (ch == '\n')
+  {
+    ++m_line;
+    m_column = 1;
+    m_line_text.clear();
+    return;
+  }
+
+  ++m_column;
+  m_line_text.push_back(ch);
+  if (m_line_text.size() > 2 * kMaxExcerptHead)
+  {
+    (void)m_line_text.erase(0, m_line_text.size() - kMaxExcerptHead);
+  }
+}
+
+std::string ValidateJSONString(const std::string& str)
+{
+  JsonValidator validator;
+  (void)validator.Feed(str);
+  (void)validator.Finish();
+  return validator.GetErrorMessage();
+}
+
+std::string ValidateJSONFile(const std::string& file_name)
+{
+  std::ifstream input(file_name, std::ios::binary);
+  if (!input)
+  {
+    return "Can't open file '" + file_name + "'";
+  }
+
+  JsonValidator validator;
+  std::vector<char> buffer(kFileChunkSize);
+  while (input && validator.IsValid())
+  {
+    (void)input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    (void)validator.Feed(buffer.data(), static_cast<std::size_t>(input.gcount()));
+  }
+  (void)validator.Finish();
+  return validator.GetErrorMessage();
+}
+
+}  // namespace sup::gui
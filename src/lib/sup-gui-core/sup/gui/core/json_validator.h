@@ -0,0 +1,165 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_CORE_JSON_VALIDATOR_H_
+#define SUP_GUI_CORE_JSON_VALIDATOR_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The JsonValidator class checks JSON syntax of the content fed to it chunk by chunk.
+ *
+ * The validator doesn't build any document and its memory doesn't depend on the size of the
+ * input, so it can check huge files while they are being read. It stops at the first error and
+ * reports its line, column and a short excerpt of the text around it. The length of the error
+ * message is bounded.
+ *
+ * Only JSON syntax is checked, whether the content represents a valid AnyValue is left to the
+ * parser.
+ */
+class JsonValidator
+{
+public:
+  JsonValidator();
+
+  /**
+   * @brief Validates the next chunk of the content.
+   *
+   * @return False if the content is invalid, further chunks are ignored then.
+   */
+  bool Feed(const char* data, std::size_t size);
+
+  /**
+   * @brief Validates the next chunk of the content.
+   */
+  bool Feed(const std::string& data);
+
+  /**
+   * @brief Checks that the content fed so far is a complete JSON document.
+   */
+  bool Finish();
+
+  /**
+   * @brief Returns true if no error was found so far.
+   */
+  bool IsValid() const;
+
+  /**
+   * @brief Returns the line of the error, or of the next character to validate (starts from 1).
+   */
+  std::size_t GetLine() const;
+
+  /**
+   * @brief Returns the column of the error, or of the next character to validate (starts from 1).
+   *
+   * Column is counted in bytes.
+   */
+  std::size_t GetColumn() const;
+
+  /**
+   * @brief Returns the number of bytes validated before the error.
+   */
+  std::size_t GetOffset() const;
+
+  /**
+   * @brief Returns the description of the error, or empty string if there is no error.
+   */
+  std::string GetDescription() const;
+
+  /**
+   * @brief Returns the text around the error on the same line.
+   */
+  std::string GetExcerpt() const;
+
+  /**
+   * @brief Returns the error message with the line, column, description and excerpt.
+   */
+  std::string GetErrorMessage() const;
+
+private:
+  enum class State
+  {
+    kValue,
+    kValueOrArrayEnd,
+    kKeyOrObjectEnd,
+    kKey,
+    kColon,
+    kCommaOrEnd,
+    kString,
+    kStringEscape,
+    kStringUnicode,
+    kLiteral,
+    kNumberMinus,
+    kNumberZero,
+    kNumberInteger,
+    kNumberDot,
+    kNumberFraction,
+    kNumberExponent,
+    kNumberExponentSign,
+    kNumberExponentDigits,
+    kDone
+  };
+
+  bool ProcessChar(char ch);
+  bool ProcessNumberChar(char ch);
+  bool StartValue(char ch);
+  bool CloseContainer(char ch);
+  void EndValue();
+  bool IsNumberComplete() const;
+  void SetError(const std::string& description);
+  void UpdatePosition(char ch);
+
+  State m_state{State::kValue};
+  std::vector<char> m_containers;  //!< opening brackets of nested objects and arrays
+  bool m_is_key{false};            //!< current string is an object key
+  const char* m_literal{nullptr};  //!< current literal (true, false, null)
+  std::size_t m_literal_pos{0};
+  int m_hex_digit_count{0};
+
+  std::size_t m_line{1};
+  std::size_t m_column{1};
+  std::size_t m_offset{0};
+  std::string m_line_text;  //!< the end of the current line, used for excerpt
+  std::string m_description;
+  std::string m_excerpt;
+};
+
+/**
+ * @brief Validates JSON syntax of the string.
+ *
+ * @return Error message, or empty string if the string is a valid JSON.
+ */
+std::string ValidateJSONString(const std::string& str);
+
+/**
+ * @brief Validates JSON syntax of the file reading it chunk by chunk.
+ *
+ * @return Error message, or empty string if the file contains a valid JSON.
+ */
+std::string ValidateJSONFile(const std::string& file_name);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_CORE_JSON_VALIDATOR_H_
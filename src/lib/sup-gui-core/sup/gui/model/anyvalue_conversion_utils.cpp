@@ -113,6 +113,14 @@ std::unique_ptr<AnyValueItem> CreateAnyValueItem(const sup::dto::AnyValue& any_v
   return builder.MoveAnyValueItem();
 }
 
+std::unique_ptr<AnyValueItem> CreatePackedAnyValueItem(const sup::dto::AnyValue& any_value,
+                                                       std::size_t min_array_size)
+{
+  AnyValueItemBuilder builder(/*pack_scalar_arrays*/ true, min_array_size);
+  sup::dto::SerializeAnyValue(any_value, builder);
+  return builder.MoveAnyValueItem();
+}
+
 void SetDataFromScalar(const anyvalue_t& value, AnyValueItem& item)
 {
   auto variant = GetVariantFromScalar(value);
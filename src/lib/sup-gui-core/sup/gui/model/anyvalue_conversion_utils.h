@@ -28,6 +28,7 @@
 
 #include <mvvm/core/variant.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -67,6 +68,17 @@ sup::dto::AnyValue CreateAnyValue(const AnyValueItem& item);
  */
 std::unique_ptr<AnyValueItem> CreateAnyValueItem(const sup::dto::AnyValue& any_value);
 
+/**
+ * @brief Creates AnyValueItem from given AnyValue, where arrays of numeric scalars are represented
+ * by AnyValueScalarArrayItem with elements packed in a single buffer.
+ *
+ * @param any_value The value to convert.
+ * @param min_array_size Minimum number of elements of the array to pack, smaller arrays get an
+ * item per element.
+ */
+std::unique_ptr<AnyValueItem> CreatePackedAnyValueItem(const sup::dto::AnyValue& any_value,
+                                                       std::size_t min_array_size = 1);
+
 /**
  * @brief Sets the data of AnyValueItem using scalar AnyValue.
  *
@@ -22,6 +22,8 @@
 
 #include "anyvalue_item_constants.h"
 #include "anyvalue_item_utils.h"
+#include "item_arena.h"
+#include "scalar_array_buffer.h"
 #include "scalar_conversion_utils.h"
 #include "scalartype_property_item.h"
 
@@ -29,9 +31,144 @@
 
 #include <mvvm/model/item_utils.h>
 
+#include <cstdint>
+
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Returns child with the given index.
+ *
+ * The tag with children accepts AnyValueItem types only, so there is no need for dynamic cast.
+ */
+AnyValueItem* GetChild(const AnyValueItem& parent, int index)
+{
+  return static_cast<AnyValueItem*>(parent.GetItem(constants::kAnyValueChildrenTag, index));
+}
+
+/**
+ * @brief The number of element edits kept next to the buffer of AnyValueScalarArrayItem before
+ * they are merged into the buffer.
+ */
+const std::size_t kMaxScalarArrayEdits = 256;
+
+/**
+ * @brief The number of bytes in front of the element in the edit record, to store its index.
+ */
+const std::size_t kEditIndexSize = sizeof(std::uint64_t);
+
+/**
+ * @brief Returns the index of element stored in the edit record at the given position.
+ */
+std::size_t GetEditIndex(const std::string& edits, std::size_t pos)
+{
+  std::uint64_t result{0};
+  for (std::size_t i = 0; i < kEditIndexSize; ++i)
+  {
+    result |= static_cast<std::uint64_t>(static_cast<unsigned char>(edits[pos + i])) << (8 * i);
+  }
+  return static_cast<std::size_t>(result);
+}
+
+/**
+ * @brief Appends the element index to the edit record, little-endian as the elements themselves.
+ */
+void AppendEditIndex(std::size_t index, std::string& edits)
+{
+  for (std::size_t i = 0; i < kEditIndexSize; ++i)
+  {
+    edits.push_back(static_cast<char>((static_cast<std::uint64_t>(index) >> (8 * i)) & 0xff));
+  }
+}
+
+/**
+ * @brief Applies edit records, each made of element index and raw element bytes, to raw data.
+ */
+void ApplyEdits(const std::string& edits, std::size_t element_size, std::string& data)
+{
+  const std::size_t record_size = kEditIndexSize + element_size;
+  for (std::size_t pos = 0; pos + record_size <= edits.size(); pos += record_size)
+  {
+    const auto offset = GetEditIndex(edits, pos) * element_size;
+    if (offset + element_size <= data.size())
+    {
+      (void)data.replace(offset, element_size, edits, pos + kEditIndexSize, element_size);
+    }
+  }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// AnyValueItemRange
+// ----------------------------------------------------------------------------
+
+AnyValueItemRange::Iterator::Iterator(const AnyValueItem* parent, int index)
+    : m_parent(parent), m_index(index)
+{
+}
+
+AnyValueItem* AnyValueItemRange::Iterator::operator*() const
+{
+  return GetChild(*m_parent, m_index);
+}
+
+AnyValueItemRange::Iterator& AnyValueItemRange::Iterator::operator++()
+{
+  ++m_index;
+  return *this;
+}
+
+AnyValueItemRange::Iterator AnyValueItemRange::Iterator::operator++(int)
+{
+  auto result = *this;
+  ++m_index;
+  return result;
+}
+
+bool AnyValueItemRange::Iterator::operator==(const Iterator& other) const
+{
+  return m_parent == other.m_parent && m_index == other.m_index;
+}
+
+bool AnyValueItemRange::Iterator::operator!=(const Iterator& other) const
+{
+  return !(*this == other);
+}
+
+AnyValueItemRange::AnyValueItemRange(const AnyValueItem* parent, int size)
+    : m_parent(parent), m_size(size)
+{
+}
+
+AnyValueItem* AnyValueItemRange::operator[](int index) const
+{
+  return GetChild(*m_parent, index);
+}
+
+int AnyValueItemRange::GetSize() const
+{
+  return m_size;
+}
+
+bool AnyValueItemRange::IsEmpty() const
+{
+  return m_size == 0;
+}
+
+AnyValueItemRange::Iterator AnyValueItemRange::begin() const
+{
+  return {m_parent, 0};
+}
+
+AnyValueItemRange::Iterator AnyValueItemRange::end() const
+{
+  return {m_parent, m_size};
+}
+
 // ----------------------------------------------------------------------------
 // AnyValueItem
 // ----------------------------------------------------------------------------
@@ -74,12 +211,29 @@ bool AnyValueItem::IsArray() const
 
 std::vector<AnyValueItem*> AnyValueItem::GetChildren() const
 {
-  return {};
+  const auto range = GetChildRange();
+  return {range.begin(), range.end()};
+}
+
+AnyValueItemRange AnyValueItem::GetChildRange() const
+{
+  return {this, GetChildrenCount()};
 }
 
 int AnyValueItem::GetChildrenCount() const
 {
-  return static_cast<int>(GetChildren().size());
+  // only structs and arrays have the tag with children
+  return IsStruct() || IsArray() ? GetItemCount(constants::kAnyValueChildrenTag) : 0;
+}
+
+void* AnyValueItem::operator new(std::size_t size)
+{
+  return AllocateItemMemory(size);
+}
+
+void AnyValueItem::operator delete(void* ptr) noexcept
+{
+  DeallocateItemMemory(ptr);
 }
 
 // ----------------------------------------------------------------------------
@@ -181,11 +335,6 @@ AnyValueScalarItem* AnyValueStructItem::AddScalarField(const std::string& field_
   return child_ptr;
 }
 
-std::vector<AnyValueItem*> AnyValueStructItem::GetChildren() const
-{
-  return GetItems<AnyValueItem>(constants::kAnyValueChildrenTag);
-}
-
 // ----------------------------------------------------------------------------
 // AnyValueArrayItem
 // ----------------------------------------------------------------------------
@@ -213,9 +362,118 @@ bool AnyValueArrayItem::IsArray() const
   return true;
 }
 
-std::vector<AnyValueItem*> AnyValueArrayItem::GetChildren() const
+// ----------------------------------------------------------------------------
+// AnyValueScalarArrayItem
+// ----------------------------------------------------------------------------
+
+AnyValueScalarArrayItem::AnyValueScalarArrayItem() : AnyValueItem(GetStaticType())
+{
+  (void)SetDisplayName(constants::kArrayTypeName);
+  (void)SetToolTip(constants::kArrayTypeName);
+  (void)AddProperty(constants::kAnyValueTypeTag, std::string()).SetVisible(false);
+  (void)AddProperty(constants::kScalarArrayElementTypeTag, std::string()).SetVisible(false);
+  (void)AddProperty(constants::kScalarArrayDataTag, std::string()).SetVisible(false);
+  (void)AddProperty(constants::kScalarArrayElementCountTag, 0).SetVisible(false);
+  (void)AddProperty(constants::kScalarArrayEditsTag, std::string()).SetVisible(false);
+  // elements live in the buffer, the tag is there to report that there are no children
+  RegisterTag(CreateAnyValueTag(constants::kAnyValueChildrenTag, 0, 0), /*as_default*/ true);
+}
+
+std::string AnyValueScalarArrayItem::GetStaticType()
+{
+  return "AnyValueScalarArray";
+}
+
+std::unique_ptr<mvvm::SessionItem> AnyValueScalarArrayItem::Clone() const
+{
+  return std::make_unique<AnyValueScalarArrayItem>(*this);
+}
+
+bool AnyValueScalarArrayItem::IsArray() const
+{
+  return true;
+}
+
+ScalarArrayBuffer AnyValueScalarArrayItem::GetBuffer() const
+{
+  const auto element_type_name = GetElementTypeName();
+  if (element_type_name.empty())
+  {
+    return {};
+  }
+
+  const auto text = Property<std::string>(constants::kScalarArrayDataTag);
+  auto buffer = ScalarArrayBuffer::FromText(element_type_name, text);
+  const auto edits = Property<std::string>(constants::kScalarArrayEditsTag);
+  if (edits.empty())
+  {
+    return buffer;
+  }
+
+  auto data = buffer.GetData();
+  ApplyEdits(DecodeBase64(edits), buffer.GetElementSize(), data);
+  return {element_type_name, std::move(data)};
+}
+
+void AnyValueScalarArrayItem::SetBuffer(const ScalarArrayBuffer& buffer)
+{
+  mvvm::utils::BeginMacro(*this, "Set array elements");
+  SetProperty(constants::kScalarArrayElementTypeTag, buffer.GetElementTypeName());
+  SetProperty(constants::kScalarArrayDataTag, buffer.ToText());
+  SetProperty(constants::kScalarArrayElementCountTag, static_cast<int>(buffer.GetSize()));
+  SetProperty(constants::kScalarArrayEditsTag, std::string());
+  mvvm::utils::EndMacro(*this);
+}
+
+std::string AnyValueScalarArrayItem::GetElementTypeName() const
+{
+  return Property<std::string>(constants::kScalarArrayElementTypeTag);
+}
+
+std::size_t AnyValueScalarArrayItem::GetElementCount() const
+{
+  return static_cast<std::size_t>(Property<int>(constants::kScalarArrayElementCountTag));
+}
+
+void AnyValueScalarArrayItem::SetElement(std::size_t index, const mvvm::variant_t& value)
 {
-  return GetItems<AnyValueItem>(constants::kAnyValueChildrenTag);
+  if (index >= GetElementCount())
+  {
+    throw RuntimeException("Index of scalar array element is out of range");
+  }
+
+  // validates the value and gives its raw bytes
+  ScalarArrayBuffer element(GetElementTypeName(), 1);
+  element.SetElement(0, value);
+
+  const std::size_t record_size = kEditIndexSize + element.GetElementSize();
+  auto edits = DecodeBase64(Property<std::string>(constants::kScalarArrayEditsTag));
+
+  // the element edited before gets its record updated
+  std::size_t pos = 0;
+  while (pos < edits.size() && GetEditIndex(edits, pos) != index)
+  {
+    pos += record_size;
+  }
+  if (pos >= edits.size())
+  {
+    if (edits.size() / record_size >= kMaxScalarArrayEdits)
+    {
+      auto buffer = GetBuffer();
+      buffer.SetElement(index, value);
+      SetBuffer(buffer);
+      return;
+    }
+
+    AppendEditIndex(index, edits);
+    (void)edits.append(element.GetData());
+  }
+  else
+  {
+    (void)edits.replace(pos + kEditIndexSize, element.GetElementSize(), element.GetData());
+  }
+
+  SetProperty(constants::kScalarArrayEditsTag, EncodeBase64(edits));
 }
 
 }  // namespace sup::gui
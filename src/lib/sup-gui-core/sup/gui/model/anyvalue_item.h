@@ -21,11 +21,73 @@
 #ifndef SUP_GUI_MODEL_ANYVALUE_ITEM_H_
 #define SUP_GUI_MODEL_ANYVALUE_ITEM_H_
 
+#include <sup/gui/model/scalar_array_buffer.h>
+
 #include <mvvm/model/compound_item.h>
 
+#include <cstddef>
+#include <iterator>
+
 namespace sup::gui
 {
 
+class AnyValueItem;
+
+/**
+ * @brief The AnyValueItemRange class is a lightweight view on children of AnyValueItem.
+ *
+ * The range doesn't allocate and doesn't cast children dynamically. It stays valid as long as no
+ * children are inserted into, or removed from the parent.
+ */
+class AnyValueItemRange
+{
+public:
+  /**
+   * @brief The Iterator class iterates over children using their index in the parent.
+   */
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = AnyValueItem*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = AnyValueItem* const*;
+    using reference = AnyValueItem*;
+
+    Iterator(const AnyValueItem* parent, int index);
+
+    AnyValueItem* operator*() const;
+    Iterator& operator++();
+    Iterator operator++(int);
+
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+  private:
+    const AnyValueItem* m_parent{nullptr};
+    int m_index{0};
+  };
+
+  AnyValueItemRange() = default;
+  AnyValueItemRange(const AnyValueItem* parent, int size);
+
+  /**
+   * @brief Returns child with the given index, no range checks.
+   */
+  AnyValueItem* operator[](int index) const;
+
+  int GetSize() const;
+
+  bool IsEmpty() const;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+private:
+  const AnyValueItem* m_parent{nullptr};
+  int m_size{0};
+};
+
 /**
  * @brief The AnyValueItem class is a base for all AnyValueItems.
  *
@@ -47,9 +109,28 @@ public:
   virtual bool IsStruct() const;
   virtual bool IsArray() const;
 
+  /**
+   * @brief Returns the vector with children.
+   *
+   * Prefer GetChildRange() in loops, it doesn't allocate.
+   */
   virtual std::vector<AnyValueItem*> GetChildren() const;
 
+  /**
+   * @brief Returns non-allocating view on children.
+   */
+  AnyValueItemRange GetChildRange() const;
+
+  /**
+   * @brief Returns the number of children, without collecting them.
+   */
   int GetChildrenCount() const;
+
+  /**
+   * @brief Allocates items in the arena of the current ItemArenaScope, if any.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr) noexcept;
 };
 
 /**
@@ -100,8 +181,6 @@ public:
 
   AnyValueScalarItem* AddScalarField(const std::string& field_name, const std::string& field_type,
                                      const mvvm::variant_t& value);
-
-  std::vector<AnyValueItem*> GetChildren() const override;
 };
 
 /**
@@ -117,8 +196,57 @@ public:
   std::unique_ptr<SessionItem> Clone() const override;
 
   bool IsArray() const override;
+};
+
+/**
+ * @brief The AnyValueScalarArrayItem class represents an AnyValue array of numeric scalars with
+ * all elements packed into a single ScalarArrayBuffer.
+ *
+ * Elements are not represented by child items, the item has no children and doesn't accept them.
+ * It allows to keep arrays with millions of elements in the model at the cost of a few bytes per
+ * element.
+ *
+ * Elements changed one by one are kept as a short list of edits next to the buffer, so an undo
+ * command of a single change stores only that list. The list is merged into the buffer when it
+ * grows too long.
+ */
+class AnyValueScalarArrayItem : public AnyValueItem
+{
+public:
+  AnyValueScalarArrayItem();
+
+  static std::string GetStaticType();
+
+  std::unique_ptr<SessionItem> Clone() const override;
+
+  bool IsArray() const override;
 
-  std::vector<AnyValueItem*> GetChildren() const override;
+  /**
+   * @brief Returns a copy of the buffer with elements.
+   */
+  ScalarArrayBuffer GetBuffer() const;
+
+  /**
+   * @brief Replaces all elements, and their type, with the content of the buffer.
+   */
+  void SetBuffer(const ScalarArrayBuffer& buffer);
+
+  /**
+   * @brief Returns the type name of array elements.
+   */
+  std::string GetElementTypeName() const;
+
+  /**
+   * @brief Returns the number of array elements.
+   */
+  std::size_t GetElementCount() const;
+
+  /**
+   * @brief Sets the element with the given index.
+   *
+   * @details Will throw if the index is out of range, or the value has a different type.
+   */
+  void SetElement(std::size_t index, const mvvm::variant_t& value);
 };
 
 }  // namespace sup::gui
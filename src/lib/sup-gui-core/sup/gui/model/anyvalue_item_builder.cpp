@@ -23,6 +23,8 @@
 #include "anyvalue_conversion_utils.h"
 #include "anyvalue_item.h"
 #include "anyvalue_item_constants.h"
+#include "scalar_array_buffer.h"
+#include "scalar_conversion_utils.h"
 
 #include <mvvm/model/session_item.h>
 #include <mvvm/model/tagindex.h>
@@ -34,6 +36,11 @@
 namespace sup::gui
 {
 
+AnyValueItemBuilder::AnyValueItemBuilder(bool pack_scalar_arrays, std::size_t packed_array_min_size)
+    : m_pack_scalar_arrays(pack_scalar_arrays), m_packed_array_min_size(packed_array_min_size)
+{
+}
+
 std::unique_ptr<AnyValueItem> AnyValueItemBuilder::MoveAnyValueItem()
 {
   return std::move(m_result);
@@ -84,13 +91,36 @@ void AnyValueItemBuilder::MemberEpilog(const anyvalue_t *anyvalue, const std::st
 void AnyValueItemBuilder::ArrayProlog(const anyvalue_t *anyvalue)
 {
   m_index = 0;
+
+  if (m_pack_scalar_arrays && IsPackableArray(*anyvalue)
+      && anyvalue->NumberOfElements() >= m_packed_array_min_size)
+  {
+    auto packed_item = std::make_unique<AnyValueScalarArrayItem>();
+    packed_item->SetAnyTypeName(anyvalue->GetTypeName());
+    packed_item->SetBuffer(CreateScalarArrayBuffer(*anyvalue));
+    AddItem(std::move(packed_item));
+    m_skip_array_elements = true;
+    return;
+  }
+
   auto array_item = std::make_unique<AnyValueArrayItem>();
   array_item->SetAnyTypeName(anyvalue->GetTypeName());
   AddItem(std::move(array_item));
+
+  if (IsNumericScalarArray(*anyvalue))
+  {
+    AddScalarArrayElements(*anyvalue);
+    m_skip_array_elements = true;
+  }
 }
 
 void AnyValueItemBuilder::ArrayElementSeparator()
 {
+  if (m_skip_array_elements)
+  {
+    return;
+  }
+
   m_index++;
   m_current_item = m_current_item->GetParent();
 }
@@ -99,11 +129,24 @@ void AnyValueItemBuilder::ArrayEpilog(const anyvalue_t *anyvalue)
 {
   (void)anyvalue;
   m_index = -1;
+
+  if (m_skip_array_elements)
+  {
+    // current item is still the array, as for regular arrays after the last element
+    m_skip_array_elements = false;
+    return;
+  }
+
   m_current_item = m_current_item->GetParent();
 }
 
 void AnyValueItemBuilder::ScalarProlog(const anyvalue_t *anyvalue)
 {
+  if (m_skip_array_elements)
+  {
+    return;
+  }
+
   auto scalar = std::make_unique<AnyValueScalarItem>();
   SetDataFromScalar(*anyvalue, *scalar);
 
@@ -151,4 +194,23 @@ void AnyValueItemBuilder::AddItem(std::unique_ptr<AnyValueItem> item)
   m_current_item = item_ptr;
 }
 
+void AnyValueItemBuilder::AddScalarArrayElements(const anyvalue_t &anyvalue)
+{
+  // Element type is resolved once for the whole array, instead of converting every element
+  // through visitor callbacks and type code lookup.
+  const auto element_type_name = anyvalue.GetType().ElementType().GetTypeName();
+  auto array_item = m_current_item;
+
+  for (auto &variant : GetVariantsFromScalarArray(anyvalue))
+  {
+    auto scalar = std::make_unique<AnyValueScalarItem>();
+    scalar->SetAnyTypeName(element_type_name);
+    (void)scalar->SetData(std::move(variant));
+
+    AddItem(std::move(scalar));
+    m_index++;
+    m_current_item = array_item;
+  }
+}
+
 }  // namespace sup::gui
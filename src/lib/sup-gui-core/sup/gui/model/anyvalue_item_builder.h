@@ -25,6 +25,7 @@
 
 #include <sup/dto/i_any_visitor.h>
 
+#include <cstddef>
 #include <memory>
 
 namespace mvvm
@@ -40,6 +41,15 @@ class AnyValueItem;
 class AnyValueItemBuilder : public sup::dto::IAnyVisitor<const sup::dto::AnyValue>
 {
 public:
+  /**
+   * @brief Main constructor.
+   *
+   * @param pack_scalar_arrays Use AnyValueScalarArrayItem to represent arrays of numeric scalars.
+   * @param packed_array_min_size Minimum number of elements of the array to pack.
+   */
+  explicit AnyValueItemBuilder(bool pack_scalar_arrays = false,
+                               std::size_t packed_array_min_size = 1);
+
   std::unique_ptr<AnyValueItem> MoveAnyValueItem();
 
   void EmptyProlog(const anyvalue_t* anyvalue) override;
@@ -62,10 +72,18 @@ public:
 private:
   void AddItem(std::unique_ptr<AnyValueItem> item);
 
+  /**
+   * @brief Adds scalar items for all elements of the array of numeric scalars at once.
+   */
+  void AddScalarArrayElements(const anyvalue_t& anyvalue);
+
   std::unique_ptr<AnyValueItem> m_result;
   mvvm::SessionItem* m_current_item{nullptr};
   int m_index{-1};
   std::string m_member_name;
+  bool m_pack_scalar_arrays{false};
+  std::size_t m_packed_array_min_size{1};
+  bool m_skip_array_elements{false};  //!< elements of current array are already processed
 };
 
 }  // namespace sup::gui
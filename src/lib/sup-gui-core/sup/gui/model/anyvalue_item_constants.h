@@ -21,6 +21,7 @@
 #ifndef SUP_GUI_MODEL_ANYVALUE_ITEM_CONSTANTS_H_
 #define SUP_GUI_MODEL_ANYVALUE_ITEM_CONSTANTS_H_
 
+#include <cstddef>
 #include <string>
 
 namespace sup::gui::constants
@@ -33,6 +34,13 @@ const std::string kEmptyTypeName = "empty";
 
 const std::string kAnyValueChildrenTag = "kAnyValueChildrenTag";
 const std::string kAnyValueTypeTag = "kAnyValueTypeTag";
+const std::string kScalarArrayElementTypeTag = "kScalarArrayElementTypeTag";
+const std::string kScalarArrayDataTag = "kScalarArrayDataTag";
+const std::string kScalarArrayElementCountTag = "kScalarArrayElementCountTag";
+const std::string kScalarArrayEditsTag = "kScalarArrayEditsTag";
+
+//! Numeric arrays of this size and above are packed on import
+const std::size_t kPackedScalarArrayMinSize = 1024;
 
 const std::string kFieldNamePrefix = "field";
 const std::string kElementNamePrefix = "element";
@@ -49,11 +49,41 @@ std::unique_ptr<mvvm::ItemCatalogue<AnyValueItem>> CreateItemCatalogue()
   result->RegisterItem<AnyValueEmptyItem>();
   result->RegisterItem<AnyValueScalarItem>();
   result->RegisterItem<AnyValueArrayItem>();
+  result->RegisterItem<AnyValueScalarArrayItem>();
   result->RegisterItem<AnyValueStructItem>();
 
   return result;
 }
 
+/**
+ * @brief Updates elements of the packed array from the source with the same layout.
+ */
+void UpdateScalarArrayData(const AnyValueItem &source, AnyValueScalarArrayItem &target)
+{
+  auto source_array = dynamic_cast<const AnyValueScalarArrayItem *>(&source);
+  if (!source_array)
+  {
+    throw RuntimeException(
+        "While updating target AnyValue from source the different layout "
+        "of target and source has been detected. The target array is packed, the source is not");
+  }
+
+  auto buffer = source_array->GetBuffer();
+  const auto target_buffer = target.GetBuffer();
+  if (buffer.GetElementTypeName() != target_buffer.GetElementTypeName()
+      || buffer.GetSize() != target_buffer.GetSize())
+  {
+    throw RuntimeException(
+        "While updating target AnyValue from source the different layout "
+        "of target and source has been detected. Packed arrays do not match");
+  }
+
+  if (buffer != target_buffer)
+  {
+    target.SetBuffer(buffer);
+  }
+}
+
 }  // namespace
 
 
@@ -124,13 +154,19 @@ void UpdateAnyValueItemData(const AnyValueItem &source, AnyValueItem &target)
       UpdateAnyValueItemScalarData(*node.source, *node.target);
       nodes.pop();
     }
+    else if (auto target_array = dynamic_cast<AnyValueScalarArrayItem *>(node.target);
+             target_array)
+    {
+      UpdateScalarArrayData(*node.source, *target_array);
+      nodes.pop();
+    }
     else
     {
-      auto source_children = node.source->GetChildren();
-      auto target_children = node.target->GetChildren();
+      const auto source_children = node.source->GetChildRange();
+      const auto target_children = node.target->GetChildRange();
       nodes.pop();
 
-      if (source_children.size() != target_children.size())
+      if (source_children.GetSize() != target_children.GetSize())
       {
         throw RuntimeException(
             "While updating target AnyValue from source the different layout "
@@ -138,17 +174,10 @@ void UpdateAnyValueItemData(const AnyValueItem &source, AnyValueItem &target)
             "does not match");
       }
 
-      // preparing vector containing pairs of children
-      std::vector<Node> new_children;
-      auto on_transform = [](const AnyValueItem *source, AnyValueItem *target)
-      { return Node{source, target}; };
-      (void) std::transform(source_children.begin(), source_children.end(), target_children.begin(),
-                     std::back_inserter(new_children), on_transform);
-
-      // adding to the stack in reverse order
-      for (auto it = new_children.rbegin(); it != new_children.rend(); ++it)
+      // adding pairs of children to the stack in reverse order
+      for (int index = source_children.GetSize() - 1; index >= 0; --index)
       {
-        nodes.push(*it);
+        nodes.push({source_children[index], target_children[index]});
       }
     }
   }
@@ -156,19 +185,19 @@ void UpdateAnyValueItemData(const AnyValueItem &source, AnyValueItem &target)
 
 bool IsSuitableScalarType(const AnyValueArrayItem &array, const std::string &scalar_type)
 {
-  if (array.GetChildren().empty())
+  if (array.GetChildrenCount() == 0)
   {
     return true;
   }
 
-  auto first_child = array.GetChildren().at(0);
-  return first_child->GetAnyTypeName() == scalar_type;
+  return array.GetChildRange()[0]->GetAnyTypeName() == scalar_type;
 }
 
 std::vector<std::string> GetAnyValueItemTypes()
 {
   return {AnyValueEmptyItem::GetStaticType(), AnyValueScalarItem::GetStaticType(),
-          AnyValueStructItem::GetStaticType(), AnyValueArrayItem::GetStaticType()};
+          AnyValueStructItem::GetStaticType(), AnyValueArrayItem::GetStaticType(),
+          AnyValueScalarArrayItem::GetStaticType()};
 }
 
 mvvm::TagInfo CreateAnyValueTag(std::string name, const std::optional<std::size_t> &min,
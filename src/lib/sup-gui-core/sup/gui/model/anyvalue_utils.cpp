@@ -20,6 +20,7 @@
 
 #include "anyvalue_utils.h"
 
+#include <sup/gui/core/json_validator.h>
 #include <sup/gui/core/sup_gui_core_exceptions.h>
 
 #include <sup/dto/anytype_helper.h>
@@ -31,6 +32,40 @@
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Maximum length of the input text quoted in exception messages.
+ */
+const std::size_t kMaxExcerptLength = 256;
+
+/**
+ * @brief Returns the beginning of the text to quote in the error message.
+ *
+ * The input might be the content of a huge file.
+ */
+std::string GetTextExcerpt(const std::string& text)
+{
+  return text.size() > kMaxExcerptLength ? text.substr(0, kMaxExcerptLength) + "..." : text;
+}
+
+/**
+ * @brief Returns the error message for the text which can't be parsed, with the location of JSON
+ * syntax error if there is one.
+ */
+std::string CreateParseErrorMessage(const std::string& text, const std::string& str)
+{
+  auto result = text + " '" + GetTextExcerpt(str) + "'";
+  if (auto syntax_error = ValidateJSONString(str); !syntax_error.empty())
+  {
+    result += ", " + syntax_error;
+  }
+  return result;
+}
+
+}  // namespace
+
 std::string AnyValueToJSONString(const anyvalue_t &value, bool is_pretty)
 {
   return sup::dto::AnyValueToJSONString(value, is_pretty);
@@ -59,7 +94,7 @@ sup::dto::AnyType AnyTypeFromJSONString(const std::string &str, const anytype_re
   sup::dto::JSONAnyTypeParser parser;
   if (!parser.ParseString(str, registry))
   {
-    throw RuntimeException("Can't parse Json type from string '" + str + "'");
+    throw RuntimeException(CreateParseErrorMessage("Can't parse Json type from string", str));
   }
   return parser.MoveAnyType();
 }
@@ -70,7 +105,7 @@ sup::dto::AnyValue AnyValueFromJSONString(const std::string &str,
   sup::dto::JSONAnyValueParser parser;
   if (!parser.ParseString(str, registry))
   {
-    throw RuntimeException("Can't parse Json value from string '" + str + "'");
+    throw RuntimeException(CreateParseErrorMessage("Can't parse Json value from string", str));
   }
   return parser.MoveAnyValue();
 }
@@ -80,7 +115,7 @@ dto::AnyValue AnyValueFromJSONString(const dto::AnyType &anytype, const std::str
   sup::dto::JSONAnyValueParser value_parser;
   if (!value_parser.TypedParseString(anytype, value_str))
   {
-    throw RuntimeException("Can't parse Json value from value '" + value_str + "'");
+    throw RuntimeException(CreateParseErrorMessage("Can't parse Json value from value", value_str));
   }
 
   return value_parser.MoveAnyValue();
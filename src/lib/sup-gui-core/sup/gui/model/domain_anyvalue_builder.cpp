@@ -22,16 +22,66 @@
 
 #include "anyvalue_conversion_utils.h"
 #include "anyvalue_item.h"
+#include "scalar_array_buffer.h"
+#include "scalar_conversion_utils.h"
 
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_composer.h>
 
 #include <cassert>
 #include <stack>
+#include <vector>
 
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Returns data of all children if they are scalars of the same numeric type, returns empty
+ * vector otherwise.
+ */
+std::vector<mvvm::variant_t> GetNumericScalarData(const AnyValueItem& array_item)
+{
+  std::vector<mvvm::variant_t> result;
+  const auto children = array_item.GetChildRange();
+  if (children.IsEmpty())
+  {
+    return result;
+  }
+
+  // names from the table of scalar type names can be compared by address
+  const std::string* element_type_name{nullptr};
+  result.reserve(children.GetSize());
+  for (auto child : children)
+  {
+    if (!child->IsScalar())
+    {
+      return {};
+    }
+
+    result.push_back(child->Data());
+    const auto& type_name = GetScalarTypeName(result.back());
+    if (!element_type_name)
+    {
+      if (!ScalarArrayBuffer::IsSupportedElementType(type_name))
+      {
+        return {};
+      }
+      element_type_name = &type_name;
+    }
+    else if (element_type_name != &type_name)
+    {
+      return {};
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
 enum NodeContext
 {
   kRoot,
@@ -131,6 +181,18 @@ struct DomainAnyValueBuilder::DomainAnyValueBuilderImpl
 
   void ProcessNewArrayNode(Node& node)
   {
+    if (auto packed_item = dynamic_cast<const AnyValueScalarArrayItem*>(node.m_item); packed_item)
+    {
+      ProcessScalarArrayItem(node, *packed_item);
+      return;
+    }
+
+    if (auto data = GetNumericScalarData(*node.m_item); !data.empty())
+    {
+      ProcessNumericArrayItem(node, data);
+      return;
+    }
+
     StartComposite(node);
     m_builder.StartArray(node.m_item->GetAnyTypeName());
     AddChildren(node, NodeContext::kArrayElement);
@@ -178,12 +240,13 @@ struct DomainAnyValueBuilder::DomainAnyValueBuilderImpl
 
   void AddChildren(Node& node, NodeContext context)
   {
-    auto children = node.m_item->GetChildren();
+    const auto children = node.m_item->GetChildRange();
     // iteration in reverse order
-    for (auto it = children.rbegin(); it != children.rend(); ++it)
+    for (int index = children.GetSize() - 1; index >= 0; --index)
     {
-      Node child_node{const_cast<const AnyValueItem*>(*it), context};
-      child_node.m_name = (*it)->GetDisplayName();
+      const AnyValueItem* child = children[index];
+      Node child_node{child, context};
+      child_node.m_name = child->GetDisplayName();
       m_stack.push(child_node);
     }
   }
@@ -194,6 +257,22 @@ struct DomainAnyValueBuilder::DomainAnyValueBuilderImpl
     m_builder.AddValue(GetAnyValueFromScalar(*node.m_item));
     EndComposite(node);
   }
+
+  void ProcessScalarArrayItem(Node& node, const AnyValueScalarArrayItem& item)
+  {
+    // the whole array is created from the buffer at once
+    StartComposite(node);
+    m_builder.AddValue(CreateAnyValueFromBuffer(item.GetBuffer(), item.GetAnyTypeName()));
+    EndComposite(node);
+  }
+
+  void ProcessNumericArrayItem(Node& node, const std::vector<mvvm::variant_t>& data)
+  {
+    // the whole array is created in one typed loop instead of element by element
+    StartComposite(node);
+    m_builder.AddValue(GetScalarArrayFromVariants(data, node.m_item->GetAnyTypeName()));
+    EndComposite(node);
+  }
 };
 
 DomainAnyValueBuilder::DomainAnyValueBuilder(const AnyValueItem& item)
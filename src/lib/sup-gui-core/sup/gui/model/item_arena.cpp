@@ -0,0 +1,291 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "item_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <utility>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ItemArenaChunk struct is a piece of memory of the arena with the count of references.
+ *
+ * Live allocations refer to the chunk, and the arena refers to its current chunk, as long as new
+ * allocations can be taken from it.
+ */
+struct ItemArenaChunk
+{
+  ItemArenaChunk(ItemArena* owner, std::size_t chunk_size)
+      : arena(owner), data(new std::byte[chunk_size]), size(chunk_size)
+  {
+  }
+
+  ItemArena* arena{nullptr};
+  std::unique_ptr<std::byte[]> data;
+  std::size_t size{0};
+  std::atomic<std::size_t> ref_count{1};
+};
+
+namespace
+{
+
+/**
+ * @brief The size of the first memory chunk of the arena.
+ */
+const std::size_t kInitialChunkSize = 4 * 1024;
+
+/**
+ * @brief The size limit for regular chunks, larger allocations get a chunk of their own.
+ */
+const std::size_t kMaxChunkSize = 256 * 1024;
+
+/**
+ * @brief Returns the size rounded up to the fundamental alignment.
+ */
+std::size_t GetAlignedSize(std::size_t size)
+{
+  const std::size_t alignment = alignof(std::max_align_t);
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief The ChunkRegistry class maps memory of all arena chunks to chunks themselves.
+ *
+ * It allows to find where an allocation came from without a header in front of every item.
+ */
+class ChunkRegistry
+{
+public:
+  void Register(ItemArenaChunk* chunk)
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(chunk->data.get());
+    const std::unique_lock<std::shared_mutex> lock(m_mutex);
+    (void)m_chunks.emplace(address, std::make_pair(address + chunk->size, chunk));
+  }
+
+  void Unregister(const std::byte* begin)
+  {
+    const std::unique_lock<std::shared_mutex> lock(m_mutex);
+    (void)m_chunks.erase(reinterpret_cast<std::uintptr_t>(begin));
+  }
+
+  ItemArenaChunk* FindChunk(const void* ptr) const
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto iter = m_chunks.upper_bound(address);
+    if (iter == m_chunks.begin())
+    {
+      return nullptr;
+    }
+    --iter;
+    return address < iter->second.first ? iter->second.second : nullptr;
+  }
+
+private:
+  mutable std::shared_mutex m_mutex;
+  std::map<std::uintptr_t, std::pair<std::uintptr_t, ItemArenaChunk*>> m_chunks;  //!< by begin
+};
+
+ChunkRegistry& GetChunkRegistry()
+{
+  // never destroyed, since items can be deleted during static destruction
+  static auto registry = new ChunkRegistry;
+  return *registry;
+}
+
+/**
+ * @brief The number of existing arenas, chunks are looked up only if there are any.
+ */
+std::atomic<std::size_t> arena_count{0};
+
+thread_local ItemArena* current_arena{nullptr};
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// ItemArena
+// ----------------------------------------------------------------------------
+
+ItemArena::ItemArena() : m_next_chunk_size(kInitialChunkSize)
+{
+  (void)arena_count.fetch_add(1, std::memory_order_acq_rel);
+}
+
+ItemArena::~ItemArena()
+{
+  for (const auto& chunk : m_chunks)
+  {
+    GetChunkRegistry().Unregister(chunk->data.get());
+  }
+  (void)arena_count.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void* ItemArena::Allocate(std::size_t size)
+{
+  size = GetAlignedSize(size);
+
+  if (!m_current_chunk || m_chunk_offset + size > m_current_chunk->size)
+  {
+    AddChunk(std::max(m_next_chunk_size, size));
+    m_next_chunk_size = std::min(m_next_chunk_size * 2, kMaxChunkSize);
+  }
+
+  void* result = m_current_chunk->data.get() + m_chunk_offset;
+  m_chunk_offset += size;
+  (void)m_current_chunk->ref_count.fetch_add(1, std::memory_order_relaxed);
+  (void)m_ref_count.fetch_add(1, std::memory_order_relaxed);
+  return result;
+}
+
+void ItemArena::Release(ItemArenaChunk* chunk) noexcept
+{
+  ReleaseChunk(chunk);
+  ReleaseReference();
+}
+
+std::size_t ItemArena::GetAllocationCount() const
+{
+  // one reference belongs to the scope, while it is alive
+  const auto count = m_ref_count.load(std::memory_order_acquire);
+  return m_has_scope.load(std::memory_order_acquire) ? count - 1 : count;
+}
+
+std::size_t ItemArena::GetChunkCount() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_chunks.size();
+}
+
+std::size_t ItemArena::GetReservedSize() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_reserved_size;
+}
+
+void ItemArena::AddChunk(std::size_t size)
+{
+  CloseCurrentChunk();
+
+  auto chunk = std::make_unique<ItemArenaChunk>(this, size);
+  GetChunkRegistry().Register(chunk.get());
+  m_current_chunk = chunk.get();
+  m_chunk_offset = 0;
+
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  m_reserved_size += size;
+  m_chunks.push_back(std::move(chunk));
+}
+
+void ItemArena::CloseCurrentChunk() noexcept
+{
+  if (auto chunk = std::exchange(m_current_chunk, nullptr); chunk)
+  {
+    ReleaseChunk(chunk);
+  }
+}
+
+void ItemArena::ReleaseChunk(ItemArenaChunk* chunk) noexcept
+{
+  if (chunk->ref_count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+  {
+    return;
+  }
+
+  GetChunkRegistry().Unregister(chunk->data.get());
+
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  auto iter = std::find_if(m_chunks.begin(), m_chunks.end(),
+                           [chunk](const auto& element) { return element.get() == chunk; });
+  m_reserved_size -= chunk->size;
+  (void)m_chunks.erase(iter);
+}
+
+void ItemArena::ReleaseReference() noexcept
+{
+  if (m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    delete this;
+  }
+}
+
+// ----------------------------------------------------------------------------
+// ItemArenaScope
+// ----------------------------------------------------------------------------
+
+ItemArenaScope::ItemArenaScope() : m_arena(new ItemArena), m_previous_arena(current_arena)
+{
+  current_arena = m_arena;
+}
+
+ItemArenaScope::~ItemArenaScope()
+{
+  current_arena = m_previous_arena;
+  m_arena->CloseCurrentChunk();
+  m_arena->m_has_scope.store(false, std::memory_order_release);
+  m_arena->ReleaseReference();
+}
+
+ItemArena* ItemArenaScope::GetArena() const
+{
+  return m_arena;
+}
+
+ItemArena* ItemArenaScope::GetCurrentArena()
+{
+  return current_arena;
+}
+
+// ----------------------------------------------------------------------------
+// Functions
+// ----------------------------------------------------------------------------
+
+void* AllocateItemMemory(std::size_t size)
+{
+  auto arena = ItemArenaScope::GetCurrentArena();
+  return arena ? arena->Allocate(size) : ::operator new(size);
+}
+
+void DeallocateItemMemory(void* ptr) noexcept
+{
+  if (!ptr)
+  {
+    return;
+  }
+
+  if (arena_count.load(std::memory_order_acquire) > 0)
+  {
+    if (auto chunk = GetChunkRegistry().FindChunk(ptr); chunk)
+    {
+      chunk->arena->Release(chunk);
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,169 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_MODEL_ITEM_ARENA_H_
+#define SUP_GUI_MODEL_ITEM_ARENA_H_
+
+//! @file
+//! Optional arena allocation for items of large subtrees built in one go.
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sup::gui
+{
+
+struct ItemArenaChunk;
+
+/**
+ * @brief The ItemArena class is a memory resource for items of a large subtree built in one go.
+ *
+ * Memory is taken from chunks one piece after another, so items created together are laid out
+ * contiguously. The first chunk is small, every next one is twice as large up to a limit, so a
+ * small subtree doesn't reserve much memory.
+ *
+ * Memory of a deleted item is not reused, but every chunk is released as soon as the last item
+ * allocated in it is deleted, and the chunk is not used for new allocations anymore. Thus removing
+ * most of a subtree gives most of its memory back, while surviving items keep only their own
+ * chunks alive. The arena deletes itself together with its last chunk, once no ItemArenaScope
+ * uses it.
+ *
+ * Allocation is expected from the single thread owning the scope, while items can be deleted from
+ * any thread.
+ */
+class ItemArena
+{
+public:
+  ItemArena(const ItemArena&) = delete;
+  ItemArena& operator=(const ItemArena&) = delete;
+
+  /**
+   * @brief Allocates memory of the given size.
+   */
+  void* Allocate(std::size_t size);
+
+  /**
+   * @brief Notifies the arena that one of its allocations in the given chunk was freed.
+   *
+   * The chunk is released when it has no allocations left. The arena deletes itself when nothing
+   * refers to it anymore.
+   */
+  void Release(ItemArenaChunk* chunk) noexcept;
+
+  /**
+   * @brief Returns the number of allocations which are still in use.
+   */
+  std::size_t GetAllocationCount() const;
+
+  /**
+   * @brief Returns the number of memory chunks.
+   */
+  std::size_t GetChunkCount() const;
+
+  /**
+   * @brief Returns the total size of memory chunks.
+   */
+  std::size_t GetReservedSize() const;
+
+private:
+  friend class ItemArenaScope;
+
+  ItemArena();
+  ~ItemArena();
+
+  /**
+   * @brief Adds the chunk of the given size, which becomes the current one.
+   */
+  void AddChunk(std::size_t size);
+
+  /**
+   * @brief Stops allocations from the current chunk, which is released if it is empty.
+   */
+  void CloseCurrentChunk() noexcept;
+
+  /**
+   * @brief Drops one reference to the chunk, and releases the chunk when it was the last one.
+   */
+  void ReleaseChunk(ItemArenaChunk* chunk) noexcept;
+
+  /**
+   * @brief Drops one reference to the arena, and deletes the arena when it was the last one.
+   */
+  void ReleaseReference() noexcept;
+
+  std::vector<std::unique_ptr<ItemArenaChunk>> m_chunks;
+  ItemArenaChunk* m_current_chunk{nullptr};  //!< chunk used for new allocations
+  std::size_t m_chunk_offset{0};             //!< used part of the current chunk
+  std::size_t m_next_chunk_size{0};          //!< size of the next regular chunk
+  std::size_t m_reserved_size{0};            //!< total size of all chunks
+  std::atomic<std::size_t> m_ref_count{1};   //!< live allocations plus the owning scope
+  std::atomic<bool> m_has_scope{true};
+  mutable std::mutex m_mutex;  //!< guards the list of chunks, emptied chunks go from any thread
+};
+
+/**
+ * @brief The ItemArenaScope class enables arena allocation of items in the current thread.
+ *
+ * All AnyValueItems created in the current thread while the scope exists are placed in the arena
+ * of the scope. Scopes can be nested, the innermost scope is used.
+ */
+class ItemArenaScope
+{
+public:
+  ItemArenaScope();
+  ~ItemArenaScope();
+
+  ItemArenaScope(const ItemArenaScope&) = delete;
+  ItemArenaScope& operator=(const ItemArenaScope&) = delete;
+
+  /**
+   * @brief Returns the arena of this scope.
+   */
+  ItemArena* GetArena() const;
+
+  /**
+   * @brief Returns the arena of the innermost scope of the current thread, or nullptr.
+   */
+  static ItemArena* GetCurrentArena();
+
+private:
+  ItemArena* m_arena{nullptr};
+  ItemArena* m_previous_arena{nullptr};
+};
+
+/**
+ * @brief Allocates memory for an item, from the current arena if any, or from the global heap.
+ *
+ * Allocations don't carry any header. Memory is given back to its arena, if it lies in one of
+ * arena chunks, which is looked up only while at least one arena exists.
+ */
+void* AllocateItemMemory(std::size_t size);
+
+/**
+ * @brief Frees memory allocated with AllocateItemMemory.
+ */
+void DeallocateItemMemory(void* ptr) noexcept;
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_MODEL_ITEM_ARENA_H_
@@ -0,0 +1,183 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "packed_waveform_item.h"
+
+#include "scalar_array_buffer.h"
+
+#include <sup/dto/anytype.h>
+
+#include <mvvm/model/item_utils.h>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+const std::string kDataItemIdentifierTag = "kDataItemIdentifier";
+const std::string kUniformXTag = "kUniformX";
+const std::string kXValuesTag = "kXValues";
+const std::string kYValuesTag = "kYValues";
+
+/**
+ * @brief Checks if x-values of points can be restored exactly from the start and the step.
+ */
+bool IsUniformX(const std::vector<std::pair<double, double>>& points)
+{
+  if (points.size() < 2)
+  {
+    return false;
+  }
+
+  const double start = points.front().first;
+  const double step = points[1].first - start;
+  for (std::size_t index = 0; index < points.size(); ++index)
+  {
+    if (start + static_cast<double>(index) * step != points[index].first)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string EncodeValues(const std::vector<double>& values)
+{
+  ScalarArrayBuffer buffer(sup::dto::kFloat64TypeName, values.size());
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    buffer.SetElement(index, mvvm::variant_t(values[index]));
+  }
+  return buffer.ToText();
+}
+
+std::vector<double> DecodeValues(const std::string& text)
+{
+  const auto buffer = ScalarArrayBuffer::FromText(sup::dto::kFloat64TypeName, text);
+  std::vector<double> result;
+  result.reserve(buffer.GetSize());
+  for (std::size_t index = 0; index < buffer.GetSize(); ++index)
+  {
+    result.push_back(std::get<double>(buffer.GetElement(index)));
+  }
+  return result;
+}
+
+}  // namespace
+
+PackedWaveformItem::PackedWaveformItem() : CompoundItem(GetStaticType())
+{
+  (void)SetDisplayName("Packed waveform");
+  (void)AddProperty(kDataItemIdentifierTag, std::string()).SetVisible(false);
+  (void)AddProperty(kUniformXTag, false).SetVisible(false);
+  (void)AddProperty(kXValuesTag, std::string()).SetVisible(false);
+  (void)AddProperty(kYValuesTag, std::string()).SetVisible(false);
+}
+
+std::string PackedWaveformItem::GetStaticType()
+{
+  return "PackedWaveform";
+}
+
+std::unique_ptr<mvvm::SessionItem> PackedWaveformItem::Clone() const
+{
+  return std::make_unique<PackedWaveformItem>(*this);
+}
+
+std::string PackedWaveformItem::GetDataItemIdentifier() const
+{
+  return Property<std::string>(kDataItemIdentifierTag);
+}
+
+void PackedWaveformItem::SetDataItemIdentifier(const std::string& identifier)
+{
+  SetProperty(kDataItemIdentifierTag, identifier);
+}
+
+std::vector<std::pair<double, double>> PackedWaveformItem::GetWaveform() const
+{
+  const auto x_values = DecodeValues(Property<std::string>(kXValuesTag));
+  const auto y_values = DecodeValues(Property<std::string>(kYValuesTag));
+
+  std::vector<std::pair<double, double>> result;
+  result.reserve(y_values.size());
+  if (HasUniformX())
+  {
+    const double start = x_values.at(0);
+    const double step = x_values.at(1);
+    for (std::size_t index = 0; index < y_values.size(); ++index)
+    {
+      result.emplace_back(start + static_cast<double>(index) * step, y_values[index]);
+    }
+  }
+  else
+  {
+    for (std::size_t index = 0; index < y_values.size(); ++index)
+    {
+      result.emplace_back(x_values.at(index), y_values[index]);
+    }
+  }
+  return result;
+}
+
+void PackedWaveformItem::SetWaveform(const std::vector<std::pair<double, double>>& points)
+{
+  const bool uniform_x = IsUniformX(points);
+
+  std::vector<double> x_values;
+  std::vector<double> y_values;
+  y_values.reserve(points.size());
+  if (uniform_x)
+  {
+    x_values = {points[0].first, points[1].first - points[0].first};
+  }
+  else
+  {
+    x_values.reserve(points.size());
+  }
+  for (const auto& [x, y] : points)
+  {
+    if (!uniform_x)
+    {
+      x_values.push_back(x);
+    }
+    y_values.push_back(y);
+  }
+
+  mvvm::utils::BeginMacro(*this, "Pack waveform");
+  SetProperty(kUniformXTag, uniform_x);
+  SetProperty(kXValuesTag, EncodeValues(x_values));
+  SetProperty(kYValuesTag, EncodeValues(y_values));
+  mvvm::utils::EndMacro(*this);
+}
+
+std::size_t PackedWaveformItem::GetPointCount() const
+{
+  const auto text = Property<std::string>(kYValuesTag);
+  return ScalarArrayBuffer::FromText(sup::dto::kFloat64TypeName, text).GetSize();
+}
+
+bool PackedWaveformItem::HasUniformX() const
+{
+  return Property<bool>(kUniformXTag);
+}
+
+}  // namespace sup::gui
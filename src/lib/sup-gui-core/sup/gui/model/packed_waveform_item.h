@@ -0,0 +1,78 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_MODEL_PACKED_WAVEFORM_ITEM_H_
+#define SUP_GUI_MODEL_PACKED_WAVEFORM_ITEM_H_
+
+#include <mvvm/model/compound_item.h>
+
+#include <utility>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The PackedWaveformItem class keeps points of a waveform packed into string properties,
+ * while the waveform is neither displayed nor edited.
+ *
+ * Points are stored in ScalarArrayBuffer, so they survive undo/redo, copy-and-paste and XML
+ * serialization at the cost of a few dozens of bytes per point, instead of a PointItem with its
+ * properties. The x-axis of equidistant points is reduced to its start and step.
+ *
+ * The item refers to LineSeriesDataItem, which had these points, by its identifier.
+ */
+class PackedWaveformItem : public mvvm::CompoundItem
+{
+public:
+  PackedWaveformItem();
+
+  static std::string GetStaticType();
+
+  std::unique_ptr<SessionItem> Clone() const override;
+
+  /**
+   * @brief Returns identifier of the data item which had these points.
+   */
+  std::string GetDataItemIdentifier() const;
+
+  void SetDataItemIdentifier(const std::string& identifier);
+
+  /**
+   * @brief Returns unpacked points.
+   */
+  std::vector<std::pair<double, double>> GetWaveform() const;
+
+  /**
+   * @brief Packs given points, replacing previous content.
+   */
+  void SetWaveform(const std::vector<std::pair<double, double>>& points);
+
+  std::size_t GetPointCount() const;
+
+  /**
+   * @brief Checks if points are equidistant along x, and only the start and the step are stored.
+   */
+  bool HasUniformX() const;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_MODEL_PACKED_WAVEFORM_ITEM_H_
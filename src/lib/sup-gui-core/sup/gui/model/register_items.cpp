@@ -21,6 +21,7 @@
 #include "register_items.h"
 
 #include "anyvalue_item.h"
+#include "packed_waveform_item.h"
 #include "scalartype_property_item.h"
 #include "settings_item.h"
 
@@ -35,8 +36,10 @@ void RegisterSessionItems()
   (void)mvvm::RegisterGlobalItem<AnyValueScalarItem>();
   (void)mvvm::RegisterGlobalItem<AnyValueStructItem>();
   (void)mvvm::RegisterGlobalItem<AnyValueArrayItem>();
+  (void)mvvm::RegisterGlobalItem<AnyValueScalarArrayItem>();
   (void)mvvm::RegisterGlobalItem<CommonSettingsItem>();
   (void)mvvm::RegisterGlobalItem<ScalarTypePropertyItem>();
+  (void)mvvm::RegisterGlobalItem<PackedWaveformItem>();
 }
 
 }  // namespace sup::gui
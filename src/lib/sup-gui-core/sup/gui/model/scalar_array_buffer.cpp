@@ -0,0 +1,403 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "scalar_array_buffer.h"
+
+#include "anyvalue_conversion_utils.h"
+#include "scalar_conversion_utils.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+const char kBase64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const char kBase64Padding = '=';
+
+template <std::size_t N>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1>
+{
+  using type = std::uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2>
+{
+  using type = std::uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4>
+{
+  using type = std::uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8>
+{
+  using type = std::uint64_t;
+};
+
+/**
+ * @brief Writes bytes of the value's binary representation, least significant first.
+ */
+template <typename T>
+void EncodeElement(T value, char* dest)
+{
+  using bits_t = typename UnsignedOfSize<sizeof(T)>::type;
+  bits_t bits{0};
+  std::memcpy(&bits, &value, sizeof(T));
+  for (std::size_t pos = 0; pos < sizeof(T); ++pos)
+  {
+    dest[pos] = static_cast<char>(bits & 0xFFU);
+    bits = static_cast<bits_t>(bits >> 8U);
+  }
+}
+
+/**
+ * @brief Reads the value from bytes written by EncodeElement.
+ */
+template <typename T>
+T DecodeElement(const char* src)
+{
+  using bits_t = typename UnsignedOfSize<sizeof(T)>::type;
+  bits_t bits{0};
+  for (std::size_t pos = sizeof(T); pos > 0; --pos)
+  {
+    bits = static_cast<bits_t>((bits << 8U) | static_cast<unsigned char>(src[pos - 1]));
+  }
+
+  if constexpr (std::is_same_v<T, bool>)
+  {
+    return bits != 0;
+  }
+  else
+  {
+    T value{};
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+}
+
+/**
+ * @brief Returns the number of bytes to store one element of the given type.
+ */
+std::size_t GetElementSizeOfType(const std::string& element_type_name)
+{
+  if (!ScalarArrayBuffer::IsSupportedElementType(element_type_name))
+  {
+    throw RuntimeException("Type [" + element_type_name
+                           + "] is not supported as an element of scalar array buffer");
+  }
+  auto on_type = [](auto tag) { return sizeof(typename decltype(tag)::type); };
+  return VisitNumericScalarType(GetScalarTypeCode(element_type_name), on_type);
+}
+
+/**
+ * @brief Returns the value of base64 digit, or -1 for invalid characters.
+ */
+int GetBase64DigitValue(char digit)
+{
+  if (digit >= 'A' && digit <= 'Z')
+  {
+    return digit - 'A';
+  }
+  if (digit >= 'a' && digit <= 'z')
+  {
+    return digit - 'a' + 26;
+  }
+  if (digit >= '0' && digit <= '9')
+  {
+    return digit - '0' + 52;
+  }
+  if (digit == '+')
+  {
+    return 62;
+  }
+  return digit == '/' ? 63 : -1;
+}
+
+/**
+ * @brief Returns the byte at the given position as unsigned number.
+ */
+std::uint32_t GetByte(const std::string& bytes, std::size_t pos)
+{
+  return static_cast<unsigned char>(bytes[pos]);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// ScalarArrayBuffer
+// ----------------------------------------------------------------------------
+
+ScalarArrayBuffer::ScalarArrayBuffer(const std::string& element_type_name, std::size_t size)
+    : m_element_type_name(element_type_name)
+    , m_element_size(GetElementSizeOfType(element_type_name))
+    , m_data(size * m_element_size, '\0')
+{
+}
+
+ScalarArrayBuffer::ScalarArrayBuffer(const std::string& element_type_name, std::string data)
+    : m_element_type_name(element_type_name)
+    , m_element_size(GetElementSizeOfType(element_type_name))
+    , m_data(std::move(data))
+{
+  if (m_data.size() % m_element_size != 0)
+  {
+    throw RuntimeException("Length of scalar array data doesn't match its element type");
+  }
+}
+
+ScalarArrayBuffer ScalarArrayBuffer::FromText(const std::string& element_type_name,
+                                              const std::string& text)
+{
+  return {element_type_name, DecodeBase64(text)};
+}
+
+bool ScalarArrayBuffer::IsSupportedElementType(const std::string& type_name)
+{
+  return IsScalarTypeName(type_name)
+         && GetScalarTypeCode(type_name) != sup::dto::TypeCode::String;
+}
+
+std::string ScalarArrayBuffer::GetElementTypeName() const
+{
+  return m_element_type_name;
+}
+
+std::size_t ScalarArrayBuffer::GetSize() const
+{
+  return m_element_size == 0 ? 0 : m_data.size() / m_element_size;
+}
+
+std::size_t ScalarArrayBuffer::GetElementSize() const
+{
+  return m_element_size;
+}
+
+bool ScalarArrayBuffer::IsEmpty() const
+{
+  return m_data.empty();
+}
+
+mvvm::variant_t ScalarArrayBuffer::GetElement(std::size_t index) const
+{
+  if (index >= GetSize())
+  {
+    throw RuntimeException("Index of scalar array element is out of range");
+  }
+
+  const char* src = m_data.data() + index * m_element_size;
+  auto on_type = [src](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    return mvvm::variant_t(std::in_place_type<value_t>, DecodeElement<value_t>(src));
+  };
+  return VisitNumericScalarType(GetScalarTypeCode(m_element_type_name), on_type);
+}
+
+void ScalarArrayBuffer::SetElement(std::size_t index, const mvvm::variant_t& value)
+{
+  if (index >= GetSize())
+  {
+    throw RuntimeException("Index of scalar array element is out of range");
+  }
+
+  char* dest = m_data.data() + index * m_element_size;
+  auto on_type = [dest, &value](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    auto element = std::get_if<value_t>(&value);
+    if (!element)
+    {
+      throw RuntimeException("Value type doesn't match the element type of scalar array");
+    }
+    EncodeElement(*element, dest);
+  };
+  VisitNumericScalarType(GetScalarTypeCode(m_element_type_name), on_type);
+}
+
+const std::string& ScalarArrayBuffer::GetData() const
+{
+  return m_data;
+}
+
+std::string ScalarArrayBuffer::ToText() const
+{
+  return EncodeBase64(m_data);
+}
+
+bool ScalarArrayBuffer::operator==(const ScalarArrayBuffer& other) const
+{
+  return m_element_type_name == other.m_element_type_name && m_data == other.m_data;
+}
+
+bool ScalarArrayBuffer::operator!=(const ScalarArrayBuffer& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// Functions
+// ----------------------------------------------------------------------------
+
+ScalarArrayBuffer CreateScalarArrayBuffer(const sup::dto::AnyValue& array)
+{
+  if (array.GetTypeCode() != sup::dto::TypeCode::Array)
+  {
+    throw RuntimeException("Scalar array buffer can be created only from array");
+  }
+
+  const auto element_type_name = array.GetType().ElementType().GetTypeName();
+  const auto count = array.NumberOfElements();
+
+  // single typed loop over all elements, no intermediate variants
+  std::string data(count * GetElementSizeOfType(element_type_name), '\0');
+  auto on_type = [&array, &data, count](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    char* dest = data.data();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      EncodeElement(array[index].template As<value_t>(), dest);
+      dest += sizeof(value_t);
+    }
+  };
+  VisitNumericScalarType(GetScalarTypeCode(element_type_name), on_type);
+
+  return {element_type_name, std::move(data)};
+}
+
+sup::dto::AnyValue CreateAnyValueFromBuffer(const ScalarArrayBuffer& buffer,
+                                            const std::string& array_type_name)
+{
+  const auto element_type_name = buffer.GetElementTypeName();
+  const auto type_code = GetScalarTypeCode(element_type_name);
+  const auto count = buffer.GetSize();
+
+  sup::dto::AnyValue result(count, sup::dto::AnyType(type_code), array_type_name);
+
+  auto on_type = [&result, &buffer, count](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    const char* src = buffer.GetData().data();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      result[index].ConvertFrom(DecodeElement<value_t>(src));
+      src += sizeof(value_t);
+    }
+  };
+  VisitNumericScalarType(type_code, on_type);
+
+  return result;
+}
+
+bool IsPackableArray(const sup::dto::AnyValue& anyvalue)
+{
+  return IsNumericScalarArray(anyvalue);
+}
+
+std::string EncodeBase64(const std::string& bytes)
+{
+  std::string result;
+  result.reserve((bytes.size() + 2) / 3 * 4);
+
+  std::size_t pos = 0;
+  for (; pos + 2 < bytes.size(); pos += 3)
+  {
+    const auto group =
+        (GetByte(bytes, pos) << 16U) | (GetByte(bytes, pos + 1) << 8U) | GetByte(bytes, pos + 2);
+    result.push_back(kBase64Digits[(group >> 18U) & 0x3FU]);
+    result.push_back(kBase64Digits[(group >> 12U) & 0x3FU]);
+    result.push_back(kBase64Digits[(group >> 6U) & 0x3FU]);
+    result.push_back(kBase64Digits[group & 0x3FU]);
+  }
+
+  // last incomplete group is padded
+  if (const auto rest = bytes.size() - pos; rest > 0)
+  {
+    std::uint32_t group = GetByte(bytes, pos) << 16U;
+    if (rest == 2)
+    {
+      group |= GetByte(bytes, pos + 1) << 8U;
+    }
+    result.push_back(kBase64Digits[(group >> 18U) & 0x3FU]);
+    result.push_back(kBase64Digits[(group >> 12U) & 0x3FU]);
+    result.push_back(rest == 2 ? kBase64Digits[(group >> 6U) & 0x3FU] : kBase64Padding);
+    result.push_back(kBase64Padding);
+  }
+
+  return result;
+}
+
+std::string DecodeBase64(const std::string& text)
+{
+  if (text.size() % 4 != 0)
+  {
+    throw RuntimeException("Length of base64 text is not a multiple of four");
+  }
+
+  std::size_t padding = 0;
+  if (!text.empty() && text.back() == kBase64Padding)
+  {
+    padding = text[text.size() - 2] == kBase64Padding ? 2 : 1;
+  }
+
+  std::string result;
+  result.reserve(text.size() / 4 * 3);
+  for (std::size_t pos = 0; pos < text.size(); pos += 4)
+  {
+    const bool is_last = pos + 4 == text.size();
+    std::uint32_t group = 0;
+    for (std::size_t digit_pos = 0; digit_pos < 4; ++digit_pos)
+    {
+      const bool is_padding = is_last && digit_pos >= 4 - padding;
+      const int value = is_padding ? 0 : GetBase64DigitValue(text[pos + digit_pos]);
+      if (value < 0)
+      {
+        throw RuntimeException("Invalid character in base64 text");
+      }
+      group = (group << 6U) | static_cast<std::uint32_t>(value);
+    }
+    result.push_back(static_cast<char>((group >> 16U) & 0xFFU));
+    result.push_back(static_cast<char>((group >> 8U) & 0xFFU));
+    result.push_back(static_cast<char>(group & 0xFFU));
+  }
+  result.resize(result.size() - padding);
+
+  return result;
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,156 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_MODEL_SCALAR_ARRAY_BUFFER_H_
+#define SUP_GUI_MODEL_SCALAR_ARRAY_BUFFER_H_
+
+#include <sup/gui/core/dto_types_fwd.h>
+
+#include <mvvm/core/variant.h>
+
+#include <cstddef>
+#include <string>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ScalarArrayBuffer class is a contiguous storage of elements of a homogeneous array of
+ * numeric scalars.
+ *
+ * Elements are kept as raw bytes, in little-endian order, so any element can be read or written
+ * in place. Item data is stored as text, to survive XML serialization and copy-and-paste, thus
+ * buffers are kept in items in base64 encoding, see ToText() and FromText().
+ *
+ * Supported element types are boolean, char8, all integers and floating point types.
+ */
+class ScalarArrayBuffer
+{
+public:
+  /**
+   * @brief Creates empty buffer without element type.
+   */
+  ScalarArrayBuffer() = default;
+
+  /**
+   * @brief Creates buffer with the given number of zero-initialized elements.
+   */
+  ScalarArrayBuffer(const std::string& element_type_name, std::size_t size);
+
+  /**
+   * @brief Creates buffer from raw bytes of elements.
+   *
+   * @details Will throw if the element type is not supported, or data length doesn't correspond
+   * to a whole number of elements.
+   */
+  ScalarArrayBuffer(const std::string& element_type_name, std::string data);
+
+  /**
+   * @brief Creates buffer from the text made by ToText().
+   *
+   * @details Will throw if the element type is not supported, or the text is not a valid
+   * encoding of a whole number of elements.
+   */
+  static ScalarArrayBuffer FromText(const std::string& element_type_name, const std::string& text);
+
+  /**
+   * @brief Checks if arrays with the given element type can be stored in the buffer.
+   */
+  static bool IsSupportedElementType(const std::string& type_name);
+
+  std::string GetElementTypeName() const;
+
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Returns the number of bytes per element.
+   */
+  std::size_t GetElementSize() const;
+
+  bool IsEmpty() const;
+
+  /**
+   * @brief Returns the element with the given index as a variant of the element type.
+   */
+  mvvm::variant_t GetElement(std::size_t index) const;
+
+  /**
+   * @brief Sets the element with the given index.
+   *
+   * @details Will throw if the index is out of range, or the value has a different type.
+   */
+  void SetElement(std::size_t index, const mvvm::variant_t& value);
+
+  /**
+   * @brief Returns raw bytes of all elements.
+   */
+  const std::string& GetData() const;
+
+  /**
+   * @brief Returns elements encoded as text, suitable for storing in item data.
+   */
+  std::string ToText() const;
+
+  bool operator==(const ScalarArrayBuffer& other) const;
+  bool operator!=(const ScalarArrayBuffer& other) const;
+
+private:
+  std::string m_element_type_name;
+  std::size_t m_element_size{0};  //!< number of bytes per element
+  std::string m_data;             //!< raw bytes of elements
+};
+
+/**
+ * @brief Creates buffer from the array AnyValue.
+ *
+ * @details Elements are converted in a single typed loop. Will throw if the value is not an
+ * array of supported scalars.
+ */
+ScalarArrayBuffer CreateScalarArrayBuffer(const sup::dto::AnyValue& array);
+
+/**
+ * @brief Creates array AnyValue from the buffer.
+ *
+ * @param buffer The buffer with elements.
+ * @param array_type_name The type name of the resulting array.
+ */
+sup::dto::AnyValue CreateAnyValueFromBuffer(const ScalarArrayBuffer& buffer,
+                                            const std::string& array_type_name);
+
+/**
+ * @brief Checks if the given AnyValue is a non-empty array of scalars supported by the buffer.
+ */
+bool IsPackableArray(const sup::dto::AnyValue& anyvalue);
+
+/**
+ * @brief Encodes arbitrary bytes as base64 text.
+ */
+std::string EncodeBase64(const std::string& bytes);
+
+/**
+ * @brief Decodes base64 text made by EncodeBase64.
+ *
+ * @details Will throw if the text is not a valid base64 encoding.
+ */
+std::string DecodeBase64(const std::string& text);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_MODEL_SCALAR_ARRAY_BUFFER_H_
@@ -30,6 +30,7 @@
 
 #include <functional>
 #include <map>
+#include <vector>
 
 namespace
 {
@@ -53,6 +54,19 @@ mvvm::variant_t GetVariantFromScalarT(const sup::dto::AnyValue &anyvalue)
   return {val};
 }
 
+/**
+ * @brief Creates a table of scalar type names indexed by variant alternative.
+ */
+std::vector<std::string> CreateVariantIndexToTypeNameTable()
+{
+  std::vector<std::string> result(std::variant_size_v<mvvm::variant_t>);
+  for (const auto &name : sup::gui::GetScalarTypeNames())
+  {
+    result.at(sup::gui::GetVariantFromScalarTypeName(name).index()) = name;
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace sup::gui
@@ -128,4 +142,76 @@ mvvm::variant_t GetVariantFromScalarTypeName(const std::string &type_name)
   return GetVariantFromScalar(anyvalue);
 }
 
+bool IsNumericScalarArray(const anyvalue_t &value)
+{
+  if (value.GetTypeCode() != sup::dto::TypeCode::Array || value.NumberOfElements() == 0)
+  {
+    return false;
+  }
+
+  const auto element_type = value.GetType().ElementType();
+  return IsScalarTypeName(element_type.GetTypeName())
+         && element_type.GetTypeCode() != sup::dto::TypeCode::String;
+}
+
+std::vector<mvvm::variant_t> GetVariantsFromScalarArray(const anyvalue_t &array)
+{
+  if (!IsNumericScalarArray(array))
+  {
+    throw RuntimeException("AnyValue is not an array of numeric scalars");
+  }
+
+  const auto count = array.NumberOfElements();
+  std::vector<mvvm::variant_t> result;
+  result.reserve(count);
+
+  auto on_type = [&array, &result, count](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      result.emplace_back(std::in_place_type<value_t>, array[index].template As<value_t>());
+    }
+  };
+  VisitNumericScalarType(array.GetType().ElementType().GetTypeCode(), on_type);
+
+  return result;
+}
+
+sup::dto::AnyValue GetScalarArrayFromVariants(const std::vector<mvvm::variant_t> &variants,
+                                              const std::string &array_type_name)
+{
+  if (variants.empty())
+  {
+    throw RuntimeException("Can't deduce element type of empty array");
+  }
+
+  const auto type_code = GetScalarTypeCode(GetScalarTypeName(variants.front()));
+  const auto count = variants.size();
+  sup::dto::AnyValue result(count, sup::dto::AnyType(type_code), array_type_name);
+
+  auto on_type = [&variants, &result, count](auto tag)
+  {
+    using value_t = typename decltype(tag)::type;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      auto value = std::get_if<value_t>(&variants[index]);
+      if (!value)
+      {
+        throw RuntimeException("Array elements have different types");
+      }
+      result[index].ConvertFrom(*value);
+    }
+  };
+  VisitNumericScalarType(type_code, on_type);
+
+  return result;
+}
+
+const std::string &GetScalarTypeName(const mvvm::variant_t &variant)
+{
+  static const auto table = CreateVariantIndexToTypeNameTable();
+  return table.at(variant.index());
+}
+
 }  // namespace sup::gui
@@ -25,12 +25,68 @@
 //! Utility functions to convert scalar AnyValue to variant_t and back.
 
 #include <sup/gui/core/dto_types_fwd.h>
+#include <sup/gui/core/sup_gui_core_exceptions.h>
 
 #include <mvvm/core/variant.h>
 
+#include <sup/dto/anytype.h>
+
+#include <vector>
+
 namespace sup::gui
 {
 
+/**
+ * @brief Carries the C++ type of AnyValue scalar to a generic lambda.
+ */
+template <typename T>
+struct ScalarTypeTag
+{
+  using type = T;
+};
+
+/**
+ * @brief Calls the function with ScalarTypeTag corresponding to the numeric type code.
+ *
+ * Allows to resolve the type once and then process a whole range of values in a single typed
+ * loop. Throws if type code doesn't denote boolean, character, integer or floating point scalar.
+ */
+template <typename Func>
+auto VisitNumericScalarType(sup::dto::TypeCode type_code, Func&& func)
+{
+  using sup::dto::TypeCode;
+  switch (type_code)
+  {
+  case TypeCode::Bool:
+    return func(ScalarTypeTag<sup::dto::boolean>{});
+  case TypeCode::Char8:
+    return func(ScalarTypeTag<sup::dto::char8>{});
+  case TypeCode::Int8:
+    return func(ScalarTypeTag<sup::dto::int8>{});
+  case TypeCode::UInt8:
+    return func(ScalarTypeTag<sup::dto::uint8>{});
+  case TypeCode::Int16:
+    return func(ScalarTypeTag<sup::dto::int16>{});
+  case TypeCode::UInt16:
+    return func(ScalarTypeTag<sup::dto::uint16>{});
+  case TypeCode::Int32:
+    return func(ScalarTypeTag<sup::dto::int32>{});
+  case TypeCode::UInt32:
+    return func(ScalarTypeTag<sup::dto::uint32>{});
+  case TypeCode::Int64:
+    return func(ScalarTypeTag<sup::dto::int64>{});
+  case TypeCode::UInt64:
+    return func(ScalarTypeTag<sup::dto::uint64>{});
+  case TypeCode::Float32:
+    return func(ScalarTypeTag<sup::dto::float32>{});
+  case TypeCode::Float64:
+    return func(ScalarTypeTag<sup::dto::float64>{});
+  default:
+    break;
+  }
+  throw RuntimeException("Not a numeric scalar type code");
+}
+
 /**
  * @brief Return scalar-like variant from AnyValue rpresenting a scalar.
  */
@@ -47,6 +103,41 @@ sup::dto::AnyValue GetAnyValueFromScalar(const mvvm::variant_t& variant);
  */
 mvvm::variant_t GetVariantFromScalarTypeName(const std::string& type_name);
 
+/**
+ * @brief Returns true if AnyValue is a non-empty array of numeric scalars.
+ *
+ * Such arrays can be converted in bulk, see GetVariantsFromScalarArray and
+ * GetScalarArrayFromVariants.
+ */
+bool IsNumericScalarArray(const anyvalue_t& value);
+
+/**
+ * @brief Returns scalar-like variants for all elements of the array of numeric scalars.
+ *
+ * The element type is resolved once, and the whole element range is converted in a single typed
+ * loop.
+ */
+std::vector<mvvm::variant_t> GetVariantsFromScalarArray(const anyvalue_t& array);
+
+/**
+ * @brief Returns array AnyValue from non-empty vector of variants holding numeric scalars of the
+ * same type.
+ *
+ * The element type is resolved from the first variant, and the whole range is converted in a
+ * single typed loop. Throws if variants hold different types.
+ */
+sup::dto::AnyValue GetScalarArrayFromVariants(const std::vector<mvvm::variant_t>& variants,
+                                              const std::string& array_type_name);
+
+/**
+ * @brief Returns scalar type name corresponding to the variant alternative, or empty string if the
+ * variant doesn't hold a scalar.
+ *
+ * The function doesn't allocate, names are taken from the table built on first use. Returned names
+ * can be compared by address.
+ */
+const std::string& GetScalarTypeName(const mvvm::variant_t& variant);
+
 }  // namespace sup::gui
 
 #endif  // SUP_GUI_MODEL_SCALAR_CONVERSION_UTILS_H_
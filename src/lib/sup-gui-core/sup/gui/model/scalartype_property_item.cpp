@@ -21,6 +21,7 @@
 #include "scalartype_property_item.h"
 
 #include "anyvalue_conversion_utils.h"
+#include "item_arena.h"
 #include "scalar_conversion_utils.h"
 
 #include <mvvm/model/combo_property.h>
@@ -85,6 +86,16 @@ void sup::gui::ScalarTypePropertyItem::SetScalarTypeName(const std::string& type
   SetData(combo_value);
 }
 
+void* ScalarTypePropertyItem::operator new(std::size_t size)
+{
+  return AllocateItemMemory(size);
+}
+
+void ScalarTypePropertyItem::operator delete(void* ptr) noexcept
+{
+  DeallocateItemMemory(ptr);
+}
+
 bool ScalarTypePropertyItem::OnSetData(mvvm::SessionItem* item, const mvvm::variant_t& value,
                                        int32_t role)
 {
@@ -47,6 +47,12 @@ public:
 
   void SetScalarTypeName(const std::string& type_name);
 
+  /**
+   * @brief Allocates items in the arena of the current ItemArenaScope, if any.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr) noexcept;
+
 private:
   /**
    * @brief Custom strategy to update data (combo type selector) and the value of AnyValueItem
@@ -50,10 +50,17 @@ mvvm::ContainerItem *WaveformModel::GetDataContainer() const
   return mvvm::utils::GetTopItem<mvvm::ContainerItem>(this);
 }
 
+mvvm::ContainerItem *WaveformModel::GetPackedDataContainer() const
+{
+  auto containers = mvvm::utils::GetTopItems<mvvm::ContainerItem>(this);
+  return containers.size() > 1 ? containers.at(1) : nullptr;
+}
+
 void WaveformModel::PopulateModel()
 {
   (void)InsertItem<mvvm::ChartViewportItem>();
   (void)InsertItem<mvvm::ContainerItem>();
+  (void)InsertItem<mvvm::ContainerItem>();
 }
 
 }  // namespace sup::gui
@@ -44,6 +44,8 @@ namespace sup::gui
  *    ContainerItem            <-- container for data
  *      LineSeriesDataItem0    <-- data for waveform0
  *      LineSeriesDataItem1    <-- data for waveform1
+ *    ContainerItem            <-- container for packed data of hidden waveforms
+ *      PackedWaveformItem     <-- points of LineSeriesDataItem1, while it stays empty
  */
 class WaveformModel : public mvvm::ApplicationModel
 {
@@ -56,6 +58,13 @@ public:
 
   mvvm::ContainerItem* GetDataContainer() const;
 
+  /**
+   * @brief Returns container with packed data of hidden waveforms.
+   *
+   * Projects saved before the container was introduced don't have it, nullptr will be returned.
+   */
+  mvvm::ContainerItem* GetPackedDataContainer() const;
+
 private:
   /**
    * @brief Populate the model with the initial content.
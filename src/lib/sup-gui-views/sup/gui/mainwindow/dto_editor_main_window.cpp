@@ -161,7 +161,7 @@ void DtoEditorMainWindow::OnProjectLoad()
 {
   const auto enable_undo = m_settings->Data<bool>(sup::gui::constants::kUseUndoSetting);
   const auto undo_limit = m_settings->Data<int>(sup::gui::constants::kUndoLimitSetting);
-  m_project->GetWaveformModel()->SetUndoEnabled(enable_undo, undo_limit);
+  // waveform view has no undo/redo, points of hidden waveforms are paged out instead
   m_project->GetSupDtoModel()->SetUndoEnabled(enable_undo, undo_limit);
 
   m_composer_view->SetModel(m_project->GetSupDtoModel());
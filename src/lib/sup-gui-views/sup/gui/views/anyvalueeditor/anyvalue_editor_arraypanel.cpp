@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "anyvalue_editor_arraypanel.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/viewmodel/scalar_array_table_model.h>
+
+#include <QHeaderView>
+#include <QLabel>
+#include <QTableView>
+#include <QVBoxLayout>
+
+namespace sup::gui
+{
+
+AnyValueEditorArrayPanel::AnyValueEditorArrayPanel(QWidget *parent_widget)
+    : QWidget(parent_widget)
+    , m_label(new QLabel)
+    , m_table_view(new QTableView)
+    , m_table_model(new ScalarArrayTableModel(this))
+{
+  setWindowTitle("Array elements");
+
+  auto layout = new QVBoxLayout(this);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setSpacing(0);
+
+  layout->addWidget(m_label);
+  layout->addWidget(m_table_view);
+
+  m_table_view->setModel(m_table_model);
+  m_table_view->setEditTriggers(QAbstractItemView::EditKeyPressed
+                                | QAbstractItemView::DoubleClicked);
+  m_table_view->setAlternatingRowColors(true);
+  m_table_view->horizontalHeader()->setStretchLastSection(true);
+
+  SetArrayItem(nullptr);
+}
+
+AnyValueEditorArrayPanel::~AnyValueEditorArrayPanel() = default;
+
+void AnyValueEditorArrayPanel::SetArrayItem(AnyValueScalarArrayItem *item)
+{
+  m_table_model->SetItem(item);
+  m_label->setText(item ? QString::fromStdString(item->GetDisplayName())
+                        : QString("Select an array of scalars to see its elements"));
+}
+
+AnyValueScalarArrayItem *AnyValueEditorArrayPanel::GetArrayItem() const
+{
+  return m_table_model->GetItem();
+}
+
+}  // namespace sup::gui
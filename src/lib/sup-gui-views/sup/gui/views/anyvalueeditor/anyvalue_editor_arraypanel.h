@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWS_ANYVALUEEDITOR_ANYVALUE_EDITOR_ARRAYPANEL_H_
+#define SUP_GUI_VIEWS_ANYVALUEEDITOR_ANYVALUE_EDITOR_ARRAYPANEL_H_
+
+#include <QWidget>
+
+class QLabel;
+class QTableView;
+
+namespace sup::gui
+{
+
+class AnyValueScalarArrayItem;
+class ScalarArrayTableModel;
+
+/**
+ * @brief The AnyValueEditorArrayPanel class represents a panel on the right of AnyValueEditor
+ * with a table of elements of the selected scalar array.
+ *
+ * Elements of AnyValueScalarArrayItem are not shown in the tree, this panel allows to see and edit
+ * them one by one.
+ */
+class AnyValueEditorArrayPanel : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit AnyValueEditorArrayPanel(QWidget* parent_widget = nullptr);
+  ~AnyValueEditorArrayPanel() override;
+
+  /**
+   * @brief Sets the array to show, nullptr to show nothing.
+   */
+  void SetArrayItem(AnyValueScalarArrayItem* item);
+
+  AnyValueScalarArrayItem* GetArrayItem() const;
+
+private:
+  QLabel* m_label{nullptr};
+  QTableView* m_table_view{nullptr};
+  ScalarArrayTableModel* m_table_model{nullptr};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWS_ANYVALUEEDITOR_ANYVALUE_EDITOR_ARRAYPANEL_H_
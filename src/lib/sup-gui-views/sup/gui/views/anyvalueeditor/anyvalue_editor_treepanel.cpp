@@ -91,6 +91,7 @@ std::vector<AnyValueItem *> AnyValueEditorTreePanel::GetSelectedItems() const
 
 void AnyValueEditorTreePanel::SetSelected(mvvm::SessionItem *item)
 {
+  m_component_provider->FetchItem(item);
   m_component_provider->SetSelectedItem(item);
   auto indices_of_inserted = m_component_provider->GetViewIndexes(item);
   if (!indices_of_inserted.empty())
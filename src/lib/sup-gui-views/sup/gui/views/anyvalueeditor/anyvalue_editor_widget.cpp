@@ -21,21 +21,25 @@
 #include "anyvalue_editor_widget.h"
 
 #include "anyvalue_editor_actions.h"
+#include "anyvalue_editor_arraypanel.h"
 #include "anyvalue_editor_textpanel.h"
 #include "anyvalue_editor_treepanel.h"
 
 #include <sup/gui/app/app_action_helper.h>
 #include <sup/gui/app/app_constants.h>
 #include <sup/gui/components/anyvalue_editor_action_handler.h>
+#include <sup/gui/components/anyvalue_file_tasks.h>
 #include <sup/gui/components/tree_helper.h>
 #include <sup/gui/mainwindow/clipboard_helper.h>
 #include <sup/gui/model/anyvalue_item.h>
 #include <sup/gui/style/style_helper.h>
+#include <sup/gui/tasks/task_executor.h>
 #include <sup/gui/views/anyvalueeditor/anyvalue_editor_dialog.h>
 #include <sup/gui/views/anyvalueeditor/anyvalue_editor_dialog_factory.h>
 #include <sup/gui/widgets/custom_splitter.h>
 #include <sup/gui/widgets/item_stack_widget.h>
 #include <sup/gui/widgets/message_helper.h>
+#include <sup/gui/widgets/progress_overlay_widget.h>
 
 #include <mvvm/model/item_utils.h>
 #include <mvvm/utils/file_utils.h>
@@ -77,10 +81,12 @@ AnyValueEditorWidget::AnyValueEditorWidget(QWidget *parent_widget)
           std::make_unique<AnyValueEditorActionHandler>(CreateActionContext(), nullptr))
     , m_actions(new AnyValueEditorActions(m_action_handler.get(), this))
     , m_text_panel(new AnyValueEditorTextPanel)
+    , m_array_panel(new AnyValueEditorArrayPanel)
     , m_tree_panel(new AnyValueEditorTreePanel)
     , m_left_panel(CreateLeftPanel())
     , m_right_panel(CreateRightPanel())
     , m_splitter(new CustomSplitter(kSplitterSettingName))
+    , m_task_executor(new TaskExecutor(1, this))
 {
   auto layout = new QVBoxLayout(this);
 
@@ -93,6 +99,8 @@ AnyValueEditorWidget::AnyValueEditorWidget(QWidget *parent_widget)
   layout->setContentsMargins(0, 0, 0, 0);
   layout->setSpacing(0);
 
+  m_progress_overlay = new ProgressOverlayWidget(this);
+
   SetupConnections();
   SetupWidgetActions();
   ReadSettings();
@@ -100,6 +108,8 @@ AnyValueEditorWidget::AnyValueEditorWidget(QWidget *parent_widget)
 
 AnyValueEditorWidget::~AnyValueEditorWidget()
 {
+  // running tasks will be cancelled by the executor, their results are not needed anymore
+  disconnect(m_task_executor, nullptr, this, nullptr);
   WriteSettings();
   AppUnregisterWidgetUniqueId(this);
 }
@@ -128,6 +138,19 @@ void AnyValueEditorWidget::OnImportFromFileRequest()
   }
 }
 
+void AnyValueEditorWidget::ImportAnyValueFromFile(const QString &file_name)
+{
+  if (m_file_task_id != 0)
+  {
+    return;
+  }
+
+  if (auto task = m_action_handler->CreateImportTask(file_name.toStdString()); task)
+  {
+    StartFileTask(std::move(task), "Importing " + file_name);
+  }
+}
+
 void AnyValueEditorWidget::OnExportToFileRequest()
 {
   auto file_name = QFileDialog::getSaveFileName(
@@ -135,7 +158,7 @@ void AnyValueEditorWidget::OnExportToFileRequest()
 
   if (!file_name.isEmpty())
   {
-    m_action_handler->OnExportToFileRequest(file_name.toStdString());
+    ExportAnyValueToFile(file_name);
     UpdateCurrentWorkdir(file_name);
   }
 }
@@ -195,12 +218,26 @@ void AnyValueEditorWidget::SetupConnections()
   connect(m_text_panel, &AnyValueEditorTextPanel::ExportToFileRequest, this,
           &AnyValueEditorWidget::OnExportToFileRequest);
 
+  // background import/export
+  connect(m_task_executor, &TaskExecutor::TaskProgressChanged, this,
+          [this](auto task_id, auto progress)
+          {
+            if (task_id == m_file_task_id)
+            {
+              m_progress_overlay->SetProgress(progress);
+            }
+          });
+  connect(m_task_executor, &TaskExecutor::TaskFinished, this,
+          &AnyValueEditorWidget::OnFileTaskFinished);
+  connect(m_progress_overlay, &ProgressOverlayWidget::CancelRequested, this,
+          [this]() { (void)m_task_executor->Cancel(m_file_task_id); });
+
   connect(m_tree_panel->GetTreeView(), &QTreeView::customContextMenuRequested, this,
           &AnyValueEditorWidget::OnContextMenuRequest);
 
   // selection change from tree panel
   connect(m_tree_panel, &AnyValueEditorTreePanel::SelectedItemChanged, this,
-          [this](auto) { m_actions->UpdateEnabledStatus(); });
+          &AnyValueEditorWidget::OnSelectedItemChanged);
 }
 
 void AnyValueEditorWidget::SetupWidgetActions()
@@ -256,17 +293,81 @@ QWidget *AnyValueEditorWidget::CreateLeftPanel()
   return result;
 }
 
-QWidget *AnyValueEditorWidget::CreateRightPanel()
+void AnyValueEditorWidget::OnSelectedItemChanged(mvvm::SessionItem *item)
+{
+  m_actions->UpdateEnabledStatus();
+
+  auto array_item = dynamic_cast<AnyValueScalarArrayItem *>(item);
+  m_array_panel->SetArrayItem(array_item);
+  if (array_item)
+  {
+    m_right_panel->SetCurrentWidget(m_array_panel);
+  }
+}
+
+ItemStackWidget *AnyValueEditorWidget::CreateRightPanel()
 {
   auto result = new ItemStackWidget;
   result->AddWidget(m_text_panel, m_text_panel->actions());
+  result->AddWidget(m_array_panel);
   return result;
 }
 
-void AnyValueEditorWidget::ImportAnyValueFromFile(const QString &file_name)
+void AnyValueEditorWidget::ExportAnyValueToFile(const QString &file_name)
+{
+  if (m_file_task_id != 0)
+  {
+    return;
+  }
+
+  if (auto task = m_action_handler->CreateExportTask(file_name.toStdString()); task)
+  {
+    StartFileTask(std::move(task), "Exporting " + file_name);
+  }
+}
+
+void AnyValueEditorWidget::StartFileTask(std::unique_ptr<ITask> task, const QString &text)
 {
-  m_action_handler->OnImportFromFileRequest(file_name.toStdString());
-  m_tree_panel->GetTreeView()->expandAll();
+  m_progress_overlay->Start(text);
+  m_file_task_id = m_task_executor->Submit(std::move(task));
+}
+
+void AnyValueEditorWidget::OnFileTaskFinished(quint64 task_id, int status)
+{
+  if (task_id != m_file_task_id)
+  {
+    return;
+  }
+
+  m_file_task_id = 0;
+  m_progress_overlay->hide();
+
+  auto task = m_task_executor->TakeResult(task_id);
+  if (static_cast<TaskStatus>(status) != TaskStatus::kCompleted)
+  {
+    return;
+  }
+
+  if (auto import_task = dynamic_cast<ImportAnyValueTask *>(task.get()); import_task)
+  {
+    if (!import_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Import failed", "Can't import AnyValue from file",
+                          "Exception was thrown", import_task->GetErrorMessage()});
+      return;
+    }
+    m_action_handler->InsertImportedItem(import_task->TakeItem());
+    m_tree_panel->GetTreeView()->expandAll();
+  }
+
+  if (auto export_task = dynamic_cast<ExportAnyValueTask *>(task.get()); export_task)
+  {
+    if (!export_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Export failed", "Can't save AnyValue to file", "Exception was thrown",
+                          export_task->GetErrorMessage()});
+    }
+  }
 }
 
 }  // namespace sup::gui
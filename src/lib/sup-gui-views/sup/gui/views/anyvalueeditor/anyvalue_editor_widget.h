@@ -39,11 +39,16 @@ namespace sup::gui
 {
 
 class AnyValueItem;
+class ITask;
 class AnyValueEditorActionHandler;
+class AnyValueEditorArrayPanel;
 class AnyValueEditorTextPanel;
 class AnyValueEditorTreePanel;
 class AnyValueEditorActions;
 class CustomSplitter;
+class ItemStackWidget;
+class ProgressOverlayWidget;
+class TaskExecutor;
 
 /**
  * @brief The AnyValueEditorWidget class is a main widget of AnyValueEditor.
@@ -72,6 +77,13 @@ public:
    */
   void OnImportFromFileRequest();
 
+  /**
+   * @brief Starts the import of AnyValue from JSON file in a background thread.
+   *
+   * Large numeric arrays are imported as a single packed item.
+   */
+  void ImportAnyValueFromFile(const QString& file_name);
+
   /**
    * @brief Exports top-level AnyValue to JSON file.
    */
@@ -107,9 +119,22 @@ private:
   void SetupWidgetActions();
 
   /**
-   * @brief Imports AnyValue from JSON file.
+   * @brief Starts the export of top-level AnyValue to JSON file in a background thread.
    */
-  void ImportAnyValueFromFile(const QString& file_name);
+  void ExportAnyValueToFile(const QString& file_name);
+
+  /**
+   * @brief Submits the task to the executor and shows the progress overlay.
+   */
+  void StartFileTask(std::unique_ptr<ITask> task, const QString& text);
+
+  /**
+   * @brief Processes the result of finished import or export task.
+   *
+   * The imported item is inserted in the model only if the task was completed successfully, so a
+   * cancelled import leaves the model untouched.
+   */
+  void OnFileTaskFinished(quint64 task_id, int status);
 
   /**
    * @brief Creates a context with all callbacks necessary for AnyValueEditorActions to function.
@@ -126,18 +151,27 @@ private:
    */
   void OnContextMenuRequest(const QPoint& point);
 
+  /**
+   * @brief Shows elements of the selected scalar array in the right panel.
+   */
+  void OnSelectedItemChanged(mvvm::SessionItem* item);
+
   QWidget* CreateLeftPanel();
-  QWidget* CreateRightPanel();
+  ItemStackWidget* CreateRightPanel();
 
   QAction* m_show_right_sidebar{nullptr};
 
   std::unique_ptr<AnyValueEditorActionHandler> m_action_handler;
   AnyValueEditorActions* m_actions{nullptr};
   AnyValueEditorTextPanel* m_text_panel{nullptr};
+  AnyValueEditorArrayPanel* m_array_panel{nullptr};
   AnyValueEditorTreePanel* m_tree_panel{nullptr};
   QWidget* m_left_panel{nullptr};
-  QWidget* m_right_panel{nullptr};
+  ItemStackWidget* m_right_panel{nullptr};
   CustomSplitter* m_splitter{nullptr};
+  TaskExecutor* m_task_executor{nullptr};
+  ProgressOverlayWidget* m_progress_overlay{nullptr};
+  quint64 m_file_task_id{0};  //! id of running import/export task, 0 if there is none
 
   QString m_current_workdir;  //! directory used during import/export operations
 };
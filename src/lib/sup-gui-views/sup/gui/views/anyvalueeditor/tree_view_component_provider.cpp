@@ -42,4 +42,9 @@ void TreeViewComponentProvider::SetFilterPattern(const QString &pattern)
   m_filter_proxy_model->SetPattern(pattern);
 }
 
+void TreeViewComponentProvider::FetchItem(const mvvm::SessionItem *item)
+{
+  static_cast<AnyValueViewModel *>(GetViewModel())->FetchItem(item);
+}
+
 }  // namespace sup::gui
@@ -28,6 +28,7 @@ class QTreeView;
 namespace mvvm
 {
 class FilterNameViewModel;
+class SessionItem;
 }  // namespace mvvm
 
 namespace sup::gui
@@ -55,6 +56,11 @@ public:
    */
   void SetFilterPattern(const QString& pattern);
 
+  /**
+   * @brief Builds rows necessary to show the given item, even if its parents weren't expanded yet.
+   */
+  void FetchItem(const mvvm::SessionItem* item);
+
 private:
   mvvm::FilterNameViewModel* m_filter_proxy_model{nullptr};
 };
@@ -20,7 +20,9 @@
 
 #include "code_editor.h"
 
+#include "code_editor_highlighter.h"
 #include "code_editor_sidebar.h"
+#include "text_diff_helper.h"
 
 #include <sup/gui/style/style_helper.h>
 
@@ -28,16 +30,36 @@
 
 #include <definition.h>
 #include <repository.h>
-#include <syntaxhighlighter.h>
 #include <theme.h>
 
 #include <QApplication>
 #include <QDebug>
 #include <QPainter>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QTimer>
+#include <algorithm>
 
 namespace sup::gui
 {
 
+namespace
+{
+
+//!< default number of characters starting from which the document is considered large
+const int kDefaultLargeDocumentThreshold = 1024 * 1024;
+
+//!< approximate number of characters to load in one event loop iteration
+const int kLoadChunkSize = 256 * 1024;
+
+//!< number of blocks to highlight above and below visible area
+const int kHighlightMarginBlocks = 100;
+
+//!< delay after the last scroll or edit before highlighting visible blocks
+const int kIdleHighlightDelayMsec = 50;
+
+}  // namespace
+
 /**
  * @brief The CodeEditorImpl class contains implementation details of CodeEditor class.
  * Invented to hide syntax-highlighter internals from users of CodeEditor class.
@@ -46,16 +68,39 @@ namespace sup::gui
 struct CodeEditor::CodeEditorImpl
 {
   KSyntaxHighlighting::Repository m_repository;
-  KSyntaxHighlighting::SyntaxHighlighter* m_highlighter{nullptr};
+  CodeEditorHighlighter* m_highlighter{nullptr};
   CodeEditorSidebar* m_sideBar;
   CodeEditor* m_self{nullptr};
+  QTimer* m_load_timer{nullptr};
+  QTimer* m_highlight_timer{nullptr};
+  int m_large_document_threshold{kDefaultLargeDocumentThreshold};
+  QString m_pending_text;  //!< text of the large document which is still loading
+  int m_pending_position{0};
 
   explicit CodeEditorImpl(CodeEditor* self)
-      : m_highlighter(new KSyntaxHighlighting::SyntaxHighlighter(self->document()))
+      : m_highlighter(new CodeEditorHighlighter(self->document()))
       , m_sideBar(new CodeEditorSidebar(self))
       , m_self(self)
+      , m_load_timer(new QTimer(self))
+      , m_highlight_timer(new QTimer(self))
+  {
+    m_load_timer->setInterval(0);
+    m_highlight_timer->setSingleShot(true);
+    m_highlight_timer->setInterval(kIdleHighlightDelayMsec);
+  }
 
+  /**
+   * @brief Stops chunked loading, if any.
+   */
+  void CancelLoading()
   {
+    if (!m_pending_text.isEmpty())
+    {
+      m_self->document()->setUndoRedoEnabled(true);
+    }
+    m_load_timer->stop();
+    m_pending_text.clear();
+    m_pending_position = 0;
   }
 
   /**
@@ -117,6 +162,11 @@ CodeEditor::CodeEditor(QWidget* parent_widget)
   connect(this, &QPlainTextEdit::cursorPositionChanged, this,
           [this]() { p_impl->highlightCurrentLine(); });
 
+  connect(p_impl->m_load_timer, &QTimer::timeout, this, &CodeEditor::LoadNextChunk);
+  connect(p_impl->m_highlight_timer, &QTimer::timeout, this, &CodeEditor::HighlightVisibleBlocks);
+  connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &CodeEditor::ScheduleHighlighting);
+  connect(document(), &QTextDocument::contentsChanged, this, &CodeEditor::ScheduleHighlighting);
+
   updateSidebarGeometry();
   p_impl->highlightCurrentLine();
 }
@@ -125,13 +175,53 @@ CodeEditor::~CodeEditor() = default;
 
 void CodeEditor::SetText(const QString& text, const QString& definition_name)
 {
+  p_impl->CancelLoading();
   clear();
 
   if (!definition_name.isEmpty())
   {
     SetDefinition(definition_name);
   }
-  setPlainText(text);
+
+  p_impl->m_highlighter->SetLazyMode(text.size() > p_impl->m_large_document_threshold);
+
+  if (IsLargeDocumentMode())
+  {
+    p_impl->m_pending_text = text;
+    document()->setUndoRedoEnabled(false);
+    LoadNextChunk();
+    if (IsLoading())
+    {
+      p_impl->m_load_timer->start();
+    }
+  }
+  else
+  {
+    setPlainText(text);
+    emit TextLoaded();
+  }
+}
+
+void CodeEditor::UpdateText(const QString& text)
+{
+  if (IsLoading() || document()->isEmpty()
+      || (text.size() > p_impl->m_large_document_threshold) != IsLargeDocumentMode())
+  {
+    SetText(text);
+    return;
+  }
+
+  if (ApplyLineDiff(*document(), text) == 0)
+  {
+    return;
+  }
+
+  if (IsLargeDocumentMode())
+  {
+    // block numbers have shifted, visible area has to be highlighted anew
+    p_impl->m_highlighter->SetLazyMode(true);
+    ScheduleHighlighting();
+  }
 }
 
 void CodeEditor::SetDefinition(const QString& definition_name)
@@ -140,10 +230,72 @@ void CodeEditor::SetDefinition(const QString& definition_name)
   p_impl->m_highlighter->setDefinition(def);
 }
 
+void CodeEditor::SetLargeDocumentThreshold(int value)
+{
+  p_impl->m_large_document_threshold = value;
+}
+
+bool CodeEditor::IsLargeDocumentMode() const
+{
+  return p_impl->m_highlighter->IsLazyMode();
+}
+
+bool CodeEditor::IsLoading() const
+{
+  return !p_impl->m_pending_text.isEmpty();
+}
+
 void CodeEditor::resizeEvent(QResizeEvent* event)
 {
   QPlainTextEdit::resizeEvent(event);
   updateSidebarGeometry();
+  ScheduleHighlighting();
+}
+
+void CodeEditor::LoadNextChunk()
+{
+  const auto& text = p_impl->m_pending_text;
+  const int text_size = static_cast<int>(text.size());
+  const int begin = p_impl->m_pending_position;
+
+  // chunk ends at the end of the line to not split lines between chunks
+  int end = static_cast<int>(
+      text.indexOf(QLatin1Char('\n'), std::min(begin + kLoadChunkSize, text_size - 1)));
+  end = end < 0 ? text_size : end + 1;
+
+  QTextCursor cursor(document());
+  cursor.movePosition(QTextCursor::End);
+  cursor.insertText(text.mid(begin, end - begin));
+  p_impl->m_pending_position = end;
+
+  if (end >= text_size)
+  {
+    p_impl->CancelLoading();
+    emit TextLoaded();
+  }
+}
+
+void CodeEditor::ScheduleHighlighting()
+{
+  if (IsLargeDocumentMode())
+  {
+    p_impl->m_highlight_timer->start();
+  }
+}
+
+void CodeEditor::HighlightVisibleBlocks()
+{
+  const auto first_block = firstVisibleBlock();
+  if (!first_block.isValid())
+  {
+    return;
+  }
+
+  const int line_spacing = std::max(1, fontMetrics().lineSpacing());
+  const int visible_count = viewport()->height() / line_spacing + 1;
+  const int first_number = std::max(0, first_block.blockNumber() - kHighlightMarginBlocks);
+  const int last_number = first_block.blockNumber() + visible_count + kHighlightMarginBlocks;
+  p_impl->m_highlighter->SetHighlightRange(first_number, last_number);
 }
 
 int CodeEditor::sidebarWidth() const
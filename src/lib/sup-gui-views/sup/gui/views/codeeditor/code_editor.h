@@ -32,6 +32,10 @@ namespace sup::gui
  * folding.
  *
  * @note Rely on KDE syntax highlighter https://github.com/KDE/syntax-highlighting
+ *
+ * Documents exceeding the large document threshold are handled in large-document mode. The text
+ * is loaded in chunks in the event loop, and only visible blocks plus some margin are highlighted
+ * when the editor is idle.
  */
 
 class CodeEditor : public QPlainTextEdit
@@ -47,17 +51,51 @@ public:
    */
   void SetText(const QString &text, const QString &definition_name = {});
 
+  /**
+   * @brief Updates editor content with the given text.
+   *
+   * The line-level difference with the current content is computed, and only changed lines are
+   * replaced within one edit block. Undo history, folding state and highlighting of unchanged
+   * lines are preserved.
+   */
+  void UpdateText(const QString &text);
+
   /**
    * @brief Set language definition for given name (JSON, XML)
    */
   void SetDefinition(const QString &definition_name);
 
+  /**
+   * @brief Sets the number of characters starting from which a document is considered large.
+   */
+  void SetLargeDocumentThreshold(int value);
+
+  /**
+   * @brief Checks if the editor works in large-document mode.
+   */
+  bool IsLargeDocumentMode() const;
+
+  /**
+   * @brief Checks if the chunked loading of the large document is still in progress.
+   */
+  bool IsLoading() const;
+
+signals:
+  /**
+   * @brief Emitted when the text set via SetText has been fully loaded into the editor.
+   */
+  void TextLoaded();
+
 protected:
   void resizeEvent(QResizeEvent *event) override;
 
 private:
   friend class CodeEditorSidebar;
 
+  void LoadNextChunk();
+  void ScheduleHighlighting();
+  void HighlightVisibleBlocks();
+
   int sidebarWidth() const;
   void sidebarPaintEvent(QPaintEvent *event);
   void updateSidebarGeometry();
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "code_editor_highlighter.h"
+
+#include <QTextBlock>
+#include <QTextDocument>
+
+namespace sup::gui
+{
+
+CodeEditorHighlighter::CodeEditorHighlighter(QTextDocument* document)
+    : KSyntaxHighlighting::SyntaxHighlighter(document)
+{
+}
+
+void CodeEditorHighlighter::SetLazyMode(bool value)
+{
+  m_is_lazy_mode = value;
+  m_first_block = 0;
+  m_last_block = -1;
+}
+
+bool CodeEditorHighlighter::IsLazyMode() const
+{
+  return m_is_lazy_mode;
+}
+
+void CodeEditorHighlighter::SetHighlightRange(int first_block, int last_block)
+{
+  const int previous_first = m_first_block;
+  const int previous_last = m_last_block;
+
+  m_first_block = first_block;
+  m_last_block = last_block;
+
+  if (!m_is_lazy_mode || !document())
+  {
+    return;
+  }
+
+  // highlighting blocks in ascending order, so every block gets the state of the previous one
+  auto block = document()->findBlockByNumber(first_block);
+  while (block.isValid() && block.blockNumber() <= last_block)
+  {
+    const int number = block.blockNumber();
+    if (number < previous_first || number > previous_last)
+    {
+      rehighlightBlock(block);
+    }
+    block = block.next();
+  }
+}
+
+bool CodeEditorHighlighter::IsInHighlightRange(int block_number) const
+{
+  return !m_is_lazy_mode || (block_number >= m_first_block && block_number <= m_last_block);
+}
+
+void CodeEditorHighlighter::highlightBlock(const QString& text)
+{
+  // Skipped blocks keep their state, so QSyntaxHighlighter stops propagation of changes on them.
+  if (IsInHighlightRange(currentBlock().blockNumber()))
+  {
+    KSyntaxHighlighting::SyntaxHighlighter::highlightBlock(text);
+  }
+}
+
+}  // namespace sup::gui
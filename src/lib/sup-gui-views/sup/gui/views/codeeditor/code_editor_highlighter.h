@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWS_CODEEDITOR_CODE_EDITOR_HIGHLIGHTER_H_
+#define SUP_GUI_VIEWS_CODEEDITOR_CODE_EDITOR_HIGHLIGHTER_H_
+
+#include <syntaxhighlighter.h>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The CodeEditorHighlighter class is a syntax highlighter which can be restricted to a
+ * range of blocks.
+ *
+ * In lazy mode only blocks within the given range are highlighted, all other blocks are skipped
+ * without changing their state. This is used by CodeEditor for large documents, where only the
+ * visible part of the document, plus some margin, is highlighted.
+ */
+class CodeEditorHighlighter : public KSyntaxHighlighting::SyntaxHighlighter
+{
+public:
+  explicit CodeEditorHighlighter(QTextDocument* document);
+
+  /**
+   * @brief Enables/disables lazy mode.
+   *
+   * Disabling lazy mode doesn't trigger rehighlighting.
+   */
+  void SetLazyMode(bool value);
+
+  bool IsLazyMode() const;
+
+  /**
+   * @brief Sets the range of blocks allowed for highlighting in lazy mode.
+   *
+   * Blocks of the new range, which were not in the previous range, are rehighlighted immediately.
+   *
+   * @param first_block The number of the first block.
+   * @param last_block The number of the last block, inclusive.
+   */
+  void SetHighlightRange(int first_block, int last_block);
+
+  /**
+   * @brief Checks if the block with the given number is allowed for highlighting.
+   */
+  bool IsInHighlightRange(int block_number) const;
+
+protected:
+  void highlightBlock(const QString& text) override;
+
+private:
+  bool m_is_lazy_mode{false};
+  int m_first_block{0};
+  int m_last_block{-1};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWS_CODEEDITOR_CODE_EDITOR_HIGHLIGHTER_H_
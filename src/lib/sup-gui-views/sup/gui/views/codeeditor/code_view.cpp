@@ -66,6 +66,9 @@ CodeView::CodeView(LanguageDefinition language, QWidget *parent_widget)
   m_text_edit->SetDefinition(LanguageName(language));
   m_text_edit->setReadOnly(true);
 
+  // large documents are loaded asynchronously
+  connect(m_text_edit, &CodeEditor::TextLoaded, this, &CodeView::RestoreScrollBarPosition);
+
   ReadSettings();
 }
 
@@ -96,15 +99,17 @@ void CodeView::SetContent(const QString &content)
 {
   SaveScrollBarPosition();
 
-  m_text_edit->clear();
-  m_text_edit->SetText(content);
+  m_text_edit->UpdateText(content);
 
-  RestoreScrollBarPosition();
+  if (!m_text_edit->IsLoading())
+  {
+    RestoreScrollBarPosition();
+  }
 }
 
 void CodeView::ClearText()
 {
-  m_text_edit->clear();
+  m_text_edit->SetText({});
 }
 
 void CodeView::OnExportToFileRequest()
@@ -55,6 +55,13 @@ public:
 
   void SetFile(const QString& file_name);
 
+  /**
+   * @brief Sets the content of the view.
+   *
+   * Only lines which differ from the current content are replaced, so undo history, scroll
+   * position and folding state are preserved. When the content is set from scratch, large
+   * documents are loaded in chunks, and the scroll position is restored when loading is complete.
+   */
   void SetContent(const QString& content);
 
   void ClearText();
@@ -0,0 +1,267 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "text_diff_helper.h"
+
+#include <QTextCursor>
+#include <QTextDocument>
+#include <algorithm>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns hash for every line.
+ */
+std::vector<size_t> GetLineHashes(const QStringList& lines, int first, int count)
+{
+  std::vector<size_t> result;
+  result.reserve(count);
+  for (int index = first; index < first + count; ++index)
+  {
+    result.push_back(qHash(lines[index]));
+  }
+  return result;
+}
+
+/**
+ * @brief The MatchingRun struct represents a run of equal lines found by Myers algorithm.
+ */
+struct MatchingRun
+{
+  int old_first{0};
+  int new_first{0};
+  int count{0};
+};
+
+/**
+ * @brief Finds runs of equal lines using Myers O(ND) algorithm.
+ *
+ * @return False if the edit distance exceeds the given limit.
+ */
+bool FindMatchingRuns(const QStringList& old_lines, int old_first, int n,
+                      const QStringList& new_lines, int new_first, int m, int max_edit_distance,
+                      std::vector<MatchingRun>& runs)
+{
+  const auto old_hashes = GetLineHashes(old_lines, old_first, n);
+  const auto new_hashes = GetLineHashes(new_lines, new_first, m);
+  auto is_equal = [&](int x, int y)
+  {
+    return old_hashes[x] == new_hashes[y]
+           && old_lines[old_first + x] == new_lines[new_first + y];
+  };
+
+  const int max_d = std::min(n + m, max_edit_distance);
+  const int offset = max_d + 1;
+  std::vector<int> v(2 * offset + 1, 0);
+
+  // trace[d] contains furthest reaching x for diagonals [-d, d] after step d
+  std::vector<std::vector<int>> trace;
+
+  int final_d = -1;
+  for (int d = 0; d <= max_d && final_d < 0; ++d)
+  {
+    for (int k = -d; k <= d; k += 2)
+    {
+      int x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]))
+                  ? v[offset + k + 1]
+                  : v[offset + k - 1] + 1;
+      int y = x - k;
+      while (x < n && y < m && is_equal(x, y))
+      {
+        ++x;
+        ++y;
+      }
+      v[offset + k] = x;
+      if (x >= n && y >= m)
+      {
+        final_d = d;
+      }
+    }
+    trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1);
+  }
+
+  if (final_d < 0)
+  {
+    return false;
+  }
+
+  // backtracking from the end, collecting runs of equal lines
+  std::vector<MatchingRun> reversed_runs;
+  int x = n;
+  int y = m;
+  for (int d = final_d; d > 0; --d)
+  {
+    const auto& previous = trace[d - 1];
+    auto previous_x = [&previous, d](int k) { return previous[k + d - 1]; };
+
+    const int k = x - y;
+    const bool is_insertion = k == -d || (k != d && previous_x(k - 1) < previous_x(k + 1));
+    const int previous_k = is_insertion ? k + 1 : k - 1;
+    const int start_x = previous_x(previous_k);
+    const int start_y = start_x - previous_k;
+
+    // position right after the insertion/deletion, the snake starts there
+    const int move_x = is_insertion ? start_x : start_x + 1;
+    const int move_y = is_insertion ? start_y + 1 : start_y;
+    if (x > move_x)
+    {
+      reversed_runs.push_back({move_x, move_y, x - move_x});
+    }
+    x = start_x;
+    y = start_y;
+  }
+  if (x > 0)
+  {
+    reversed_runs.push_back({0, 0, x});
+  }
+
+  runs.assign(reversed_runs.rbegin(), reversed_runs.rend());
+  return true;
+}
+
+}  // namespace
+
+bool LineDiffHunk::operator==(const LineDiffHunk& other) const
+{
+  return old_first == other.old_first && old_count == other.old_count
+         && new_first == other.new_first && new_count == other.new_count;
+}
+
+bool LineDiffHunk::operator!=(const LineDiffHunk& other) const
+{
+  return !(*this == other);
+}
+
+std::vector<LineDiffHunk> ComputeLineDiff(const QStringList& old_lines,
+                                          const QStringList& new_lines, int max_edit_distance)
+{
+  const int old_size = static_cast<int>(old_lines.size());
+  const int new_size = static_cast<int>(new_lines.size());
+
+  // common leading and trailing lines
+  int prefix = 0;
+  while (prefix < old_size && prefix < new_size && old_lines[prefix] == new_lines[prefix])
+  {
+    ++prefix;
+  }
+  int suffix = 0;
+  while (suffix < old_size - prefix && suffix < new_size - prefix
+         && old_lines[old_size - 1 - suffix] == new_lines[new_size - 1 - suffix])
+  {
+    ++suffix;
+  }
+
+  const int n = old_size - prefix - suffix;
+  const int m = new_size - prefix - suffix;
+  if (n == 0 && m == 0)
+  {
+    return {};
+  }
+
+  std::vector<MatchingRun> runs;
+  if (n == 0 || m == 0
+      || !FindMatchingRuns(old_lines, prefix, n, new_lines, prefix, m, max_edit_distance, runs))
+  {
+    return {{prefix, n, prefix, m}};
+  }
+
+  // hunks are gaps between runs of equal lines
+  std::vector<LineDiffHunk> result;
+  int x = 0;
+  int y = 0;
+  for (const auto& run : runs)
+  {
+    if (run.old_first > x || run.new_first > y)
+    {
+      result.push_back({prefix + x, run.old_first - x, prefix + y, run.new_first - y});
+    }
+    x = run.old_first + run.count;
+    y = run.new_first + run.count;
+  }
+  if (x < n || y < m)
+  {
+    result.push_back({prefix + x, n - x, prefix + y, m - y});
+  }
+
+  return result;
+}
+
+int ApplyLineDiff(QTextDocument& document, const QString& text)
+{
+  const auto current = document.toPlainText();
+  const auto old_lines = current.split(QLatin1Char('\n'));
+  const auto new_lines = text.split(QLatin1Char('\n'));
+  const auto hunks = ComputeLineDiff(old_lines, new_lines);
+  if (hunks.empty())
+  {
+    return 0;
+  }
+
+  // Offsets of line beginnings, as if every line is followed by a separator. The last element is
+  // the offset of the line after the last one.
+  auto get_line_offsets = [](const QStringList& lines)
+  {
+    std::vector<int> result(lines.size() + 1, 0);
+    for (int index = 0; index < static_cast<int>(lines.size()); ++index)
+    {
+      result[index + 1] = result[index] + static_cast<int>(lines[index].size()) + 1;
+    }
+    return result;
+  };
+  const auto old_offsets = get_line_offsets(old_lines);
+  const auto new_offsets = get_line_offsets(new_lines);
+  const int old_size = static_cast<int>(current.size());
+  const int new_size = static_cast<int>(text.size());
+
+  QTextCursor cursor(&document);
+  cursor.beginEditBlock();
+
+  // going from the end, so offsets of preceding hunks remain valid
+  for (auto it = hunks.rbegin(); it != hunks.rend(); ++it)
+  {
+    int old_begin = old_offsets[it->old_first];
+    int old_end = old_offsets[it->old_first + it->old_count];
+    int new_begin = new_offsets[it->new_first];
+    int new_end = new_offsets[it->new_first + it->new_count];
+
+    // The last line has no trailing separator, the hunk touching the end takes the separator
+    // preceding the hunk instead.
+    if (old_end > old_size)
+    {
+      old_begin = std::max(0, old_begin - 1);
+      old_end = old_size;
+      new_begin = std::max(0, new_begin - 1);
+      new_end = new_size;
+    }
+
+    cursor.setPosition(old_begin);
+    cursor.setPosition(old_end, QTextCursor::KeepAnchor);
+    cursor.insertText(text.mid(new_begin, new_end - new_begin));
+  }
+
+  cursor.endEditBlock();
+  return static_cast<int>(hunks.size());
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWS_CODEEDITOR_TEXT_DIFF_HELPER_H_
+#define SUP_GUI_VIEWS_CODEEDITOR_TEXT_DIFF_HELPER_H_
+
+//! @file
+//! Helper functions to compute line-level difference between two texts.
+
+#include <QStringList>
+#include <vector>
+
+class QTextDocument;
+
+namespace sup::gui
+{
+
+/**
+ * @brief The LineDiffHunk struct describes a range of lines in the old text which should be
+ * replaced with a range of lines from the new text.
+ */
+struct LineDiffHunk
+{
+  int old_first{0};  //!< index of the first replaced line in the old text
+  int old_count{0};  //!< number of lines to remove from the old text
+  int new_first{0};  //!< index of the first line in the new text
+  int new_count{0};  //!< number of lines to insert from the new text
+
+  bool operator==(const LineDiffHunk& other) const;
+  bool operator!=(const LineDiffHunk& other) const;
+};
+
+/**
+ * @brief Computes the list of hunks transforming old lines into new lines.
+ *
+ * Common leading and trailing lines are skipped first, the rest is processed with Myers
+ * algorithm. If the number of changed lines exceeds max_edit_distance, the whole middle part is
+ * reported as a single hunk.
+ *
+ * @return Hunks in ascending order.
+ */
+std::vector<LineDiffHunk> ComputeLineDiff(const QStringList& old_lines,
+                                          const QStringList& new_lines,
+                                          int max_edit_distance = 1000);
+
+/**
+ * @brief Updates the document to contain the given text.
+ *
+ * Only lines which differ from the current content are replaced. All changes are made within one
+ * edit block, so they are undone at once.
+ *
+ * @return The number of applied hunks.
+ */
+int ApplyLineDiff(QTextDocument& document, const QString& text);
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWS_CODEEDITOR_TEXT_DIFF_HELPER_H_
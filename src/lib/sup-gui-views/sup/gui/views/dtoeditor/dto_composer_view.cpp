@@ -26,7 +26,10 @@
 #include <sup/gui/app/app_constants.h>
 #include <sup/gui/components/dto_composer_action_handler.h>
 #include <sup/gui/components/dto_composer_tab_controller.h>
+#include <sup/gui/components/dto_composer_tasks.h>
+#include <sup/gui/tasks/task_executor.h>
 #include <sup/gui/views/anyvalueeditor/anyvalue_editor_widget.h>
+#include <sup/gui/widgets/message_helper.h>
 
 #include <mvvm/model/i_session_model.h>
 #include <mvvm/model/session_item.h>
@@ -59,6 +62,7 @@ DtoComposerView::DtoComposerView(QWidget *parent_widget)
     , m_tab_widget(new QTabWidget)
     , m_actions(new DtoComposerActions(this))
     , m_action_handler(new DtoComposerActionHandler(this))
+    , m_task_executor(new TaskExecutor(1, this))
 {
   auto layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
@@ -79,10 +83,17 @@ DtoComposerView::DtoComposerView(QWidget *parent_widget)
   SetupConnections();
 }
 
-DtoComposerView::~DtoComposerView() = default;
+DtoComposerView::~DtoComposerView()
+{
+  // running duplications will be cancelled by the executor, their results are not needed anymore
+  disconnect(m_task_executor, nullptr, this, nullptr);
+}
 
 void DtoComposerView::SetModel(mvvm::ISessionModel *model)
 {
+  // copies of containers of the previous model are not needed
+  m_task_executor->CancelAll();
+  m_duplicate_task_ids.clear();
   m_action_handler->SetModel(model);
   m_tab_controller =
       std::make_unique<DtoComposerTabController>(model, CreateCallback(), m_tab_widget);
@@ -102,7 +113,9 @@ void DtoComposerView::SetupConnections()
 
   // the request to duplicate existing tab
   connect(m_actions, &DtoComposerActions::DuplicateCurrentTabRequest, m_action_handler,
-          [this]() { m_action_handler->OnDuplicateContainer(m_tab_widget->currentIndex()); });
+          [this]() { DuplicateContainer(m_tab_widget->currentIndex()); });
+  connect(m_task_executor, &TaskExecutor::TaskFinished, this,
+          &DtoComposerView::OnDuplicateTaskFinished);
 
   // the request to remove current tab
   connect(m_actions, &DtoComposerActions::RemoveCurrentTabRequest, m_action_handler,
@@ -123,4 +136,42 @@ void DtoComposerView::SummonContextMenu(const QPoint &point)
   menu.exec(m_tab_widget->tabBar()->mapToGlobal(point));
 }
 
+void DtoComposerView::DuplicateContainer(int container_index)
+{
+  if (container_index < 0)
+  {
+    return;
+  }
+
+  const auto index = static_cast<std::size_t>(container_index);
+  if (auto task = m_action_handler->CreateDuplicateTask(index); task)
+  {
+    (void)m_duplicate_task_ids.insert(m_task_executor->Submit(std::move(task)));
+    return;
+  }
+
+  m_action_handler->OnDuplicateContainer(index);
+}
+
+void DtoComposerView::OnDuplicateTaskFinished(quint64 task_id, int status)
+{
+  auto task = m_task_executor->TakeResult(task_id);
+  if (m_duplicate_task_ids.erase(task_id) == 0
+      || static_cast<TaskStatus>(status) != TaskStatus::kCompleted)
+  {
+    return;
+  }
+
+  if (auto duplicate_task = dynamic_cast<DuplicateContainerTask *>(task.get()); duplicate_task)
+  {
+    if (!duplicate_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Duplication failed", "Can't duplicate the container", "",
+                          duplicate_task->GetErrorMessage()});
+      return;
+    }
+    m_action_handler->InsertDuplicatedContainer(*duplicate_task);
+  }
+}
+
 }  // namespace sup::gui
@@ -23,6 +23,7 @@
 
 #include <QWidget>
 #include <memory>
+#include <set>
 
 class QTabWidget;
 
@@ -38,6 +39,7 @@ namespace sup::gui
 class DtoComposerTabController;
 class DtoComposerActions;
 class DtoComposerActionHandler;
+class TaskExecutor;
 
 /**
  * @brief The DtoComposerView class represents a main view to assemble AnyValue.
@@ -58,12 +60,24 @@ private:
   void SetupConnections();
   void SummonContextMenu(const QPoint& point);
 
+  /**
+   * @brief Duplicates the container with the given index in a background thread when possible.
+   */
+  void DuplicateContainer(int container_index);
+
+  /**
+   * @brief Inserts the container built by the finished duplication task.
+   */
+  void OnDuplicateTaskFinished(quint64 task_id, int status);
+
   mvvm::ISessionModel* m_model{nullptr};
 
   QTabWidget* m_tab_widget{nullptr};
   std::unique_ptr<DtoComposerTabController> m_tab_controller;
   DtoComposerActions* m_actions{nullptr};
   DtoComposerActionHandler* m_action_handler;
+  TaskExecutor* m_task_executor{nullptr};
+  std::set<quint64> m_duplicate_task_ids;  //!< duplications started for the current model
 };
 
 }  // namespace sup::gui
@@ -22,17 +22,22 @@
 
 #include <sup/gui/components/dto_waveform_action_handler.h>
 #include <sup/gui/style/style_helper.h>
+#include <sup/gui/widgets/action_menu.h>
+
+#include <QMenu>
 
 namespace sup::gui
 {
 
 DtoWaveformActions::DtoWaveformActions(DtoWaveformActionHandler *action_handler,
                                        QObject *parent_object)
-    : QObject(parent_object), m_action_handler(action_handler)
+    : QObject(parent_object), m_file_menu(CreateFileMenu()), m_action_handler(action_handler)
 {
   SetupActions();
 }
 
+DtoWaveformActions::~DtoWaveformActions() = default;
+
 QList<QAction *> DtoWaveformActions::GetActions(const std::vector<ActionKey> &action_keys) const
 {
   return m_action_map.GetActions(action_keys);
@@ -57,6 +62,37 @@ void DtoWaveformActions::SetupActions()
   connect(m_remove_waveform_action, &QAction::triggered, this,
           [this]() { m_action_handler->RemoveWaveform(); });
   m_action_map.Add(ActionKey::kRemoveWaveform, m_remove_waveform_action);
+
+  // import/export
+  m_file_action = new ActionMenu("File", this);
+  m_file_action->setIcon(utils::FindIcon("file-export-outline"));
+  m_file_action->setToolTip("Import waveform from CSV or binary file, or export selected waveform");
+  m_file_action->setMenu(m_file_menu.get());
+  m_action_map.Add(ActionKey::kFileOperations, m_file_action);
+}
+
+std::unique_ptr<QMenu> DtoWaveformActions::CreateFileMenu()
+{
+  auto result = std::make_unique<QMenu>();
+  result->setToolTipsVisible(true);
+
+  auto import_action = result->addAction("Import from file");
+  import_action->setToolTip(
+      "Reads waveform from CSV file, or from binary file with float64 x,y pairs (*.bin)");
+  connect(import_action, &QAction::triggered, this, &DtoWaveformActions::ImportFromFileRequest);
+
+  auto export_action = result->addAction("Export to file");
+  export_action->setToolTip("Writes selected waveform to CSV or binary file");
+  connect(export_action, &QAction::triggered, this, &DtoWaveformActions::ExportToFileRequest);
+
+  auto export_resampled_action = result->addAction("Export all on common time base");
+  export_resampled_action->setToolTip(
+      "Resamples all waveforms on a common time base and writes them to JSON file as a single "
+      "AnyValue struct");
+  connect(export_resampled_action, &QAction::triggered, this,
+          &DtoWaveformActions::ExportResampledRequest);
+
+  return result;
 }
 
 }  // namespace sup::gui
@@ -24,13 +24,16 @@
 #include <sup/gui/components/action_map.h>
 
 #include <QObject>
+#include <memory>
 
 class QAction;
+class QMenu;
 
 namespace sup::gui
 {
 
 class DtoWaveformActionHandler;
+class ActionMenu;
 
 /**
  * @brief The DtoWaveformActions class contains the main actions of DtoWaveformView.
@@ -50,22 +53,36 @@ public:
   {
     kAddWaveform,
     kRemoveWaveform,
+    kFileOperations,
     kTotalCount
   };
 
   explicit DtoWaveformActions(DtoWaveformActionHandler* action_handler,
                               QObject* parent_object = nullptr);
+  ~DtoWaveformActions() override;
 
   /**
    * @brief Returns list of actions according to provided flags.
    */
   QList<QAction*> GetActions(const std::vector<ActionKey>& action_keys) const;
 
+signals:
+  void ImportFromFileRequest();
+  void ExportToFileRequest();
+  void ExportResampledRequest();
+
 private:
   void SetupActions();
 
+  /**
+   * @brief Creates menu with waveform import/export actions.
+   */
+  std::unique_ptr<QMenu> CreateFileMenu();
+
   QAction* m_add_waveform_action{nullptr};
   QAction* m_remove_waveform_action{nullptr};
+  std::unique_ptr<QMenu> m_file_menu;
+  ActionMenu* m_file_action{nullptr};
 
   sup::gui::ActionMap<ActionKey> m_action_map;
   DtoWaveformActionHandler* m_action_handler{nullptr};
@@ -21,16 +21,25 @@
 #include "dto_waveform_list_panel.h"
 
 #include <sup/gui/components/dto_waveform_action_handler.h>
+#include <sup/gui/components/waveform_file_tasks.h>
 #include <sup/gui/model/waveform_model.h>
+#include <sup/gui/tasks/task_executor.h>
 #include <sup/gui/views/dtoeditor/dto_waveform_actions.h>
+#include <sup/gui/views/dtoeditor/waveform_sparkline_delegate.h>
 #include <sup/gui/widgets/item_stack_widget.h>
+#include <sup/gui/widgets/message_helper.h>
+#include <sup/gui/widgets/progress_overlay_widget.h>
 
 #include <mvvm/standarditems/chart_viewport_item.h>
 #include <mvvm/standarditems/container_item.h>
+#include <mvvm/signals/model_listener.h>
 #include <mvvm/standarditems/line_series_item.h>
 #include <mvvm/viewmodel/top_items_viewmodel.h>
+#include <mvvm/viewmodel/viewmodel.h>
 #include <mvvm/views/component_provider_helper.h>
 
+#include <QFileDialog>
+#include <QFileInfo>
 #include <QListView>
 #include <QVBoxLayout>
 
@@ -44,6 +53,7 @@ DtoWaveformListPanel::DtoWaveformListPanel(QWidget *parent_widget)
     , m_stack_widget(new sup::gui::ItemStackWidget)
     , m_list_view(new QListView)
     , m_component_provider(mvvm::CreateProvider<mvvm::TopItemsViewModel>(m_list_view))
+    , m_task_executor(new TaskExecutor(1, this))
 {
   auto layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
@@ -53,18 +63,57 @@ DtoWaveformListPanel::DtoWaveformListPanel(QWidget *parent_widget)
   using ActionKey = DtoWaveformActions::ActionKey;
   m_list_view->setWindowTitle("Waveform list");
   m_stack_widget->AddWidget(
-      m_list_view, m_actions->GetActions({ActionKey::kAddWaveform, ActionKey::kRemoveWaveform}));
+      m_list_view, m_actions->GetActions({ActionKey::kAddWaveform, ActionKey::kRemoveWaveform,
+                                          ActionKey::kFileOperations}));
+
+  m_progress_overlay = new ProgressOverlayWidget(this);
+
+  // sparklines are served from the envelope cache of the handler
+  m_list_view->setItemDelegate(new WaveformSparklineDelegate(
+      [this](const QModelIndex &index, int bin_count)
+      {
+        auto item = m_component_provider->GetViewModel()->GetSessionItemFromIndex(index);
+        return m_action_handler->CreateWaveformOverview(
+            dynamic_cast<mvvm::LineSeriesItem *>(item), static_cast<std::size_t>(bin_count));
+      },
+      m_list_view));
 
   connect(m_component_provider.get(), &mvvm::ItemViewComponentProvider::SelectedItemChanged, this,
-          [this](auto) { emit WaveformSelected(GetSelectedWaveform()); });
+          [this](auto) { OnSelectedWaveformChanged(); });
 
   connect(m_action_handler, &DtoWaveformActionHandler::SelectWaveformRequest, this,
           &DtoWaveformListPanel::SetSelectedWaveform);
+
+  // background import/export
+  connect(m_actions, &DtoWaveformActions::ImportFromFileRequest, this,
+          &DtoWaveformListPanel::OnImportFromFileRequest);
+  connect(m_actions, &DtoWaveformActions::ExportToFileRequest, this,
+          &DtoWaveformListPanel::OnExportToFileRequest);
+  connect(m_actions, &DtoWaveformActions::ExportResampledRequest, this,
+          &DtoWaveformListPanel::OnExportResampledRequest);
+  connect(m_task_executor, &TaskExecutor::TaskProgressChanged, this,
+          [this](auto task_id, auto progress)
+          {
+            if (task_id == m_file_task_id)
+            {
+              m_progress_overlay->SetProgress(progress);
+            }
+          });
+  connect(m_task_executor, &TaskExecutor::TaskFinished, this,
+          &DtoWaveformListPanel::OnFileTaskFinished);
+  connect(m_progress_overlay, &ProgressOverlayWidget::CancelRequested, this,
+          [this]() { (void)m_task_executor->Cancel(m_file_task_id); });
 }
 
 void DtoWaveformListPanel::SetViewport(mvvm::ChartViewportItem *viewport)
 {
   m_chart_viewport = viewport;
+  m_listener = std::make_unique<mvvm::ModelListener>(viewport->GetModel());
+  m_listener->Connect<mvvm::DataChangedEvent>(this, &DtoWaveformListPanel::OnModelEvent);
+  m_listener->Connect<mvvm::ItemInsertedEvent>([this](const auto &)
+                                               { m_list_view->viewport()->update(); });
+  m_listener->Connect<mvvm::ItemRemovedEvent>([this](const auto &)
+                                              { m_list_view->viewport()->update(); });
   m_component_provider->SetItem(viewport);
   if (viewport->GetLineSeriesCount() > 0)
   {
@@ -72,7 +121,11 @@ void DtoWaveformListPanel::SetViewport(mvvm::ChartViewportItem *viewport)
   }
 }
 
-DtoWaveformListPanel::~DtoWaveformListPanel() = default;
+DtoWaveformListPanel::~DtoWaveformListPanel()
+{
+  // running tasks will be cancelled by the executor, their results are not needed anymore
+  disconnect(m_task_executor, nullptr, this, nullptr);
+}
 
 mvvm::LineSeriesItem *DtoWaveformListPanel::GetSelectedWaveform()
 {
@@ -84,6 +137,53 @@ void DtoWaveformListPanel::SetSelectedWaveform(mvvm::LineSeriesItem *waveform)
   m_component_provider->SetSelectedItem(waveform);
 }
 
+void DtoWaveformListPanel::ImportWaveformFromFile(const QString &file_name)
+{
+  if (m_file_task_id != 0)
+  {
+    return;
+  }
+
+  const auto file_name_str = file_name.toStdString();
+  if (auto task =
+          m_action_handler->CreateImportTask(file_name_str, GetWaveformFileOptions(file_name_str));
+      task)
+  {
+    StartFileTask(std::move(task), "Importing " + file_name);
+  }
+}
+
+void DtoWaveformListPanel::ExportWaveformToFile(const QString &file_name)
+{
+  if (m_file_task_id != 0)
+  {
+    return;
+  }
+
+  const auto file_name_str = file_name.toStdString();
+  if (auto task =
+          m_action_handler->CreateExportTask(file_name_str, GetWaveformFileOptions(file_name_str));
+      task)
+  {
+    StartFileTask(std::move(task), "Exporting " + file_name);
+  }
+}
+
+void DtoWaveformListPanel::ExportResampledWaveformsToFile(const QString &file_name)
+{
+  if (m_file_task_id != 0)
+  {
+    return;
+  }
+
+  if (auto task = m_action_handler->CreateResampledExportTask(file_name.toStdString(),
+                                                              WaveformResamplingOptions{});
+      task)
+  {
+    StartFileTask(std::move(task), "Exporting " + file_name);
+  }
+}
+
 DtoWaveformEditorContext DtoWaveformListPanel::CreateContext()
 {
   DtoWaveformEditorContext result;
@@ -91,6 +191,7 @@ DtoWaveformEditorContext DtoWaveformListPanel::CreateContext()
   result.waveform_container = [this]() { return GetWaveformModel()->GetViewPort(); };
   result.data_container = [this]() { return GetWaveformModel()->GetDataContainer(); };
   result.selected_waveform = [this]() { return GetSelectedWaveform(); };
+  result.packed_data_container = [this]() { return GetWaveformModel()->GetPackedDataContainer(); };
 
   return result;
 }
@@ -100,4 +201,152 @@ WaveformModel *DtoWaveformListPanel::GetWaveformModel()
   return dynamic_cast<WaveformModel *>(m_chart_viewport->GetModel());
 }
 
+void DtoWaveformListPanel::OnSelectedWaveformChanged()
+{
+  auto selected_waveform = GetSelectedWaveform();
+
+  // the editor should get the waveform with its points in place
+  m_action_handler->UnpackWaveform(selected_waveform);
+  emit WaveformSelected(selected_waveform);
+
+  ScheduleUpdatePackedWaveforms();
+}
+
+void DtoWaveformListPanel::OnModelEvent(const mvvm::DataChangedEvent &event)
+{
+  // sparklines follow changes of points, repaint is postponed by Qt till the next cycle anyway
+  m_list_view->viewport()->update();
+
+  // display flag is a property of the waveform located in our viewport
+  auto waveform = event.item->GetParent();
+  if (waveform && waveform->GetParent() == m_chart_viewport)
+  {
+    ScheduleUpdatePackedWaveforms();
+  }
+}
+
+void DtoWaveformListPanel::ScheduleUpdatePackedWaveforms()
+{
+  if (m_update_packed_pending)
+  {
+    return;
+  }
+
+  m_update_packed_pending = true;
+  QMetaObject::invokeMethod(
+      this,
+      [this]()
+      {
+        m_update_packed_pending = false;
+        m_action_handler->UpdatePackedWaveforms();
+      },
+      Qt::QueuedConnection);
+}
+
+void DtoWaveformListPanel::OnImportFromFileRequest()
+{
+  auto file_name = QFileDialog::getOpenFileName(
+      this, "Select waveform file to load", m_current_workdir,
+      "Waveform files (*.csv *.tsv *.txt *.dat *.bin *.raw *.f64);;All files (*)");
+
+  if (!file_name.isEmpty())
+  {
+    m_current_workdir = QFileInfo(file_name).absolutePath();
+    ImportWaveformFromFile(file_name);
+  }
+}
+
+void DtoWaveformListPanel::OnExportToFileRequest()
+{
+  if (!m_action_handler->CanExportWaveform())
+  {
+    SendWarningMessage({"Export failed", "Please select a waveform to export"});
+    return;
+  }
+
+  const auto default_name =
+      QString::fromStdString(GetSelectedWaveform()->GetDisplayName()) + ".csv";
+  auto file_name = QFileDialog::getSaveFileName(
+      this, "Save waveform", m_current_workdir + "/" + default_name,
+      "CSV files (*.csv *.tsv);;Binary float64 files (*.bin *.raw *.f64)");
+
+  if (!file_name.isEmpty())
+  {
+    m_current_workdir = QFileInfo(file_name).absolutePath();
+    ExportWaveformToFile(file_name);
+  }
+}
+
+void DtoWaveformListPanel::OnExportResampledRequest()
+{
+  if (!m_action_handler->CanExportResampledWaveforms())
+  {
+    SendWarningMessage({"Export failed", "There are no waveforms with points to export"});
+    return;
+  }
+
+  auto file_name =
+      QFileDialog::getSaveFileName(this, "Save waveforms", m_current_workdir + "/waveforms.json",
+                                   "JSON files (*.json *.JSON)");
+
+  if (!file_name.isEmpty())
+  {
+    m_current_workdir = QFileInfo(file_name).absolutePath();
+    ExportResampledWaveformsToFile(file_name);
+  }
+}
+
+void DtoWaveformListPanel::StartFileTask(std::unique_ptr<ITask> task, const QString &text)
+{
+  m_progress_overlay->Start(text);
+  m_file_task_id = m_task_executor->Submit(std::move(task));
+}
+
+void DtoWaveformListPanel::OnFileTaskFinished(quint64 task_id, int status)
+{
+  if (task_id != m_file_task_id)
+  {
+    return;
+  }
+
+  m_file_task_id = 0;
+  m_progress_overlay->hide();
+
+  auto task = m_task_executor->TakeResult(task_id);
+  if (static_cast<TaskStatus>(status) != TaskStatus::kCompleted)
+  {
+    return;
+  }
+
+  if (auto import_task = dynamic_cast<ImportWaveformTask *>(task.get()); import_task)
+  {
+    if (!import_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Import failed", "Can't import waveform from file", "",
+                          import_task->GetErrorMessage()});
+      return;
+    }
+    const auto name = QFileInfo(QString::fromStdString(import_task->GetFileName())).baseName();
+    m_action_handler->InsertImportedWaveform(import_task->TakeWaveform(), name.toStdString());
+  }
+
+  if (auto export_task = dynamic_cast<ExportWaveformTask *>(task.get()); export_task)
+  {
+    if (!export_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Export failed", "Can't save waveform to file", "",
+                          export_task->GetErrorMessage()});
+    }
+  }
+
+  if (auto export_task = dynamic_cast<ExportResampledWaveformsTask *>(task.get()); export_task)
+  {
+    if (!export_task->GetErrorMessage().empty())
+    {
+      SendWarningMessage({"Export failed", "Can't save waveforms to file", "",
+                          export_task->GetErrorMessage()});
+    }
+  }
+}
+
 }  // namespace sup::gui
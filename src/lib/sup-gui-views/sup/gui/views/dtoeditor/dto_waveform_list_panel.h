@@ -23,6 +23,8 @@
 
 #include <sup/gui/components/dto_waveform_editor_context.h>
 
+#include <mvvm/signals/event_types.h>
+
 #include <QWidget>
 #include <memory>
 
@@ -33,6 +35,7 @@ namespace mvvm
 class ItemViewComponentProvider;
 class LineSeriesItem;
 class ChartViewportItem;
+class ModelListener;
 }  // namespace mvvm
 
 namespace sup::gui
@@ -42,6 +45,9 @@ class ItemStackWidget;
 class DtoWaveformActionHandler;
 class DtoWaveformActions;
 class WaveformModel;
+class TaskExecutor;
+class ProgressOverlayWidget;
+class ITask;
 
 /**
  * @brief The DtoWaveformListPanel class represents a vertical panel with the list of available
@@ -65,6 +71,22 @@ public:
 
   void SetSelectedWaveform(mvvm::LineSeriesItem* waveform);
 
+  /**
+   * @brief Starts import of the waveform from CSV or binary file in a background thread.
+   */
+  void ImportWaveformFromFile(const QString& file_name);
+
+  /**
+   * @brief Starts export of the selected waveform to CSV or binary file in a background thread.
+   */
+  void ExportWaveformToFile(const QString& file_name);
+
+  /**
+   * @brief Starts export of all waveforms resampled on a common time base to JSON file in a
+   * background thread.
+   */
+  void ExportResampledWaveformsToFile(const QString& file_name);
+
 signals:
   void WaveformSelected(mvvm::LineSeriesItem* waveform);
 
@@ -76,6 +98,30 @@ private:
 
   WaveformModel* GetWaveformModel();
 
+  /**
+   * @brief Unpacks points of the selected waveform and notifies the editor.
+   *
+   * Waveforms hidden by the editor in response to the selection are packed later.
+   */
+  void OnSelectedWaveformChanged();
+
+  /**
+   * @brief Schedules update of packed waveforms when the display flag of a waveform changes, and
+   * repaints waveform sparklines.
+   */
+  void OnModelEvent(const mvvm::DataChangedEvent& event);
+
+  /**
+   * @brief Packs hidden waveforms and unpacks displayed ones on the next event loop cycle.
+   */
+  void ScheduleUpdatePackedWaveforms();
+
+  void OnImportFromFileRequest();
+  void OnExportToFileRequest();
+  void OnExportResampledRequest();
+  void StartFileTask(std::unique_ptr<ITask> task, const QString& text);
+  void OnFileTaskFinished(quint64 task_id, int status);
+
   DtoWaveformActionHandler* m_action_handler{nullptr};
   DtoWaveformActions* m_actions{nullptr};
 
@@ -84,6 +130,13 @@ private:
   std::unique_ptr<mvvm::ItemViewComponentProvider> m_component_provider;
 
   mvvm::ChartViewportItem* m_chart_viewport{nullptr};
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  bool m_update_packed_pending{false};
+
+  TaskExecutor* m_task_executor{nullptr};
+  ProgressOverlayWidget* m_progress_overlay{nullptr};
+  quint64 m_file_task_id{0};  //! id of running import/export task, 0 if there is none
+  QString m_current_workdir;  //! directory used during import/export operations
 };
 
 }  // namespace sup::gui
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "waveform_sparkline_delegate.h"
+
+#include <QPainter>
+#include <algorithm>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Width of the sparkline in pixels.
+ */
+const int kSparklineWidth = 64;
+
+/**
+ * @brief Margin around the sparkline in pixels.
+ */
+const int kSparklineMargin = 2;
+
+}  // namespace
+
+WaveformSparklineDelegate::WaveformSparklineDelegate(overview_callback_t callback,
+                                                     QObject *parent_object)
+    : QStyledItemDelegate(parent_object), m_overview_callback(std::move(callback))
+{
+}
+
+void WaveformSparklineDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                      const QModelIndex &index) const
+{
+  QStyledItemDelegate::paint(painter, option, index);
+
+  const QRect rect(option.rect.right() - kSparklineWidth - kSparklineMargin,
+                   option.rect.top() + kSparklineMargin, kSparklineWidth,
+                   option.rect.height() - 2 * kSparklineMargin);
+  if (!m_overview_callback || rect.left() <= option.rect.left() || rect.height() <= 0)
+  {
+    return;
+  }
+
+  const auto bins = m_overview_callback(index, rect.width());
+  if (bins.empty())
+  {
+    return;
+  }
+
+  double min_y = bins.front().first;
+  double max_y = bins.front().second;
+  for (const auto &[bin_min, bin_max] : bins)
+  {
+    min_y = std::min(min_y, bin_min);
+    max_y = std::max(max_y, bin_max);
+  }
+  const double range = max_y > min_y ? max_y - min_y : 1.0;
+
+  // flat waveform is drawn in the middle of the cell
+  auto to_pixel = [&rect, min_y, max_y, range](double value)
+  {
+    const double fraction = max_y > min_y ? (value - min_y) / range : 0.5;
+    return rect.bottom() - static_cast<int>(fraction * (rect.height() - 1));
+  };
+
+  painter->save();
+  const bool is_selected = option.state & QStyle::State_Selected;
+  painter->setPen(option.palette.color(is_selected ? QPalette::HighlightedText : QPalette::Text));
+  const double bin_width = static_cast<double>(rect.width()) / static_cast<double>(bins.size());
+  for (std::size_t bin = 0; bin < bins.size(); ++bin)
+  {
+    const int x = rect.left() + static_cast<int>(static_cast<double>(bin) * bin_width);
+    painter->drawLine(x, to_pixel(bins[bin].first), x, to_pixel(bins[bin].second));
+  }
+  painter->restore();
+}
+
+}  // namespace sup::gui
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_VIEWS_DTOEDITOR_WAVEFORM_SPARKLINE_DELEGATE_H_
+#define SUP_GUI_VIEWS_DTOEDITOR_WAVEFORM_SPARKLINE_DELEGATE_H_
+
+#include <QStyledItemDelegate>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace sup::gui
+{
+
+/**
+ * @brief The WaveformSparklineDelegate class draws a small overview of the waveform on the right
+ * side of the list cell, next to the waveform name.
+ *
+ * The overview is a vertical min/max bar per pixel column, provided by the callback. Since the
+ * callback serves bins from the cached envelope, the cost of painting depends on the width of the
+ * sparkline, not on the number of points.
+ */
+class WaveformSparklineDelegate : public QStyledItemDelegate
+{
+  Q_OBJECT
+
+public:
+  using overview_callback_t =
+      std::function<std::vector<std::pair<double, double>>(const QModelIndex&, int)>;
+
+  explicit WaveformSparklineDelegate(overview_callback_t callback,
+                                     QObject* parent_object = nullptr);
+
+  void paint(QPainter* painter, const QStyleOptionViewItem& option,
+             const QModelIndex& index) const override;
+
+private:
+  overview_callback_t m_overview_callback;
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_VIEWS_DTOEDITOR_WAVEFORM_SPARKLINE_DELEGATE_H_
@@ -22,22 +22,54 @@
 
 #include <sup/gui/components/component_types.h>
 #include <sup/gui/plotting/waveform_editor_action_handler.h>
+#include <sup/gui/plotting/waveform_transforms.h>
 #include <sup/gui/style/style_helper.h>
 #include <sup/gui/widgets/action_menu.h>
+#include <sup/gui/widgets/message_helper.h>
 
 #include <mvvm/plotting/plot_types.h>
 #include <mvvm/widgets/widget_utils.h>
 
 #include <QAction>
 #include <QActionGroup>
+#include <QApplication>
 #include <QButtonGroup>
+#include <QInputDialog>
 #include <QMenu>
 #include <QToolButton>
 #include <QWidgetAction>
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 namespace sup::gui
 {
 
+namespace
+{
+
+/**
+ * @brief Applies the transform to the selected waveform, and reports invalid parameters to the
+ * user.
+ */
+void ApplyTransform(WaveformEditorActionHandler& action_handler,
+                    const std::function<waveform_transform_t()>& create_transform,
+                    const QString& command_name)
+{
+  try
+  {
+    action_handler.ApplyTransform(create_transform(), command_name.toStdString());
+  }
+  catch (const std::exception& ex)
+  {
+    SendWarningMessage({"Transform failed", "Can't transform the waveform", "Exception was thrown",
+                        ex.what()});
+  }
+}
+
+}  // namespace
+
 WaveformEditorActions::WaveformEditorActions(WaveformEditorActionHandler* action_handler,
                                              QObject* parent_object)
     : QObject(parent_object)
@@ -47,6 +79,7 @@ WaveformEditorActions::WaveformEditorActions(WaveformEditorActionHandler* action
     , m_pan_button(new QToolButton)
     , m_pan_action(new QWidgetAction(this))
     , m_more_settings_menu(CreateMoreSettingsMenu())
+    , m_transform_menu(CreateTransformMenu())
     , m_action_handler(action_handler)
 {
   SetupCanvasActions();
@@ -140,6 +173,13 @@ void WaveformEditorActions::SetupTableActions()
   connect(m_remove_column, &QAction::triggered, this,
           [this]() { m_action_handler->OnRemoveColumnRequest(); });
   m_action_map.Add(ActionKey::kRemoveColumn, m_remove_column);
+
+  m_transform_action = new ActionMenu("Transform", this);
+  m_transform_action->setToolTip(
+      "Transform selected points, or the whole waveform if a single point is selected");
+  m_transform_action->setIcon(utils::FindIcon("chart-timeline-variant-shimmer"));
+  m_transform_action->setMenu(m_transform_menu.get());
+  m_action_map.Add(ActionKey::kTransform, m_transform_action);
 }
 
 std::unique_ptr<QMenu> WaveformEditorActions::CreateMoreSettingsMenu()
@@ -171,8 +211,80 @@ std::unique_ptr<QMenu> WaveformEditorActions::CreateMoreSettingsMenu()
                 static_cast<int>(WaveformDisplayMode::kDisplaySelected));
           });
 
+  auto keep_sorted = new QAction("Keep points sorted by x", this);
+  keep_sorted->setToolTip(
+      "Insert points according to their x value, and move edited points to keep the order");
+  keep_sorted->setCheckable(true);
+  connect(keep_sorted, &QAction::toggled, this,
+          [this](bool checked) { m_action_handler->SetSortedMode(checked); });
+
   result->addAction(show_all);
   result->addAction(show_selected);
+  result->addSeparator();
+  result->addAction(keep_sorted);
+
+  return result;
+}
+
+std::unique_ptr<QMenu> WaveformEditorActions::CreateTransformMenu()
+{
+  auto result = std::make_unique<QMenu>();
+  result->setToolTipsVisible(true);
+
+  // asks for a single parameter and applies the transform created from it
+  auto add_transform = [this, &result](const QString& text, const QString& label, double value,
+                                       auto create_transform)
+  {
+    auto action = result->addAction(text + "...");
+    connect(action, &QAction::triggered, this,
+            [this, text, label, value, create_transform]()
+            {
+              bool is_ok{false};
+              const double parameter = QInputDialog::getDouble(
+                  QApplication::activeWindow(), text, label, value,
+                  std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(), 6,
+                  &is_ok);
+              if (is_ok)
+              {
+                ApplyTransform(
+                    *m_action_handler, [&]() { return create_transform(parameter); }, text);
+              }
+            });
+  };
+
+  add_transform("Scale", "Factor", 1.0, [](double value) { return CreateScaleTransform(value); });
+  add_transform("Offset", "Offset", 0.0, [](double value) { return CreateOffsetTransform(value); });
+  add_transform("Time shift", "Shift", 0.0,
+                [](double value) { return CreateTimeShiftTransform(value); });
+  add_transform("Smooth", "Window size", 3.0, [](double value)
+                { return CreateSmoothTransform(static_cast<std::size_t>(std::max(value, 0.0))); });
+  add_transform("Resample", "Step", 1.0,
+                [](double value) { return CreateResampleTransform(value); });
+
+  auto clamp = result->addAction("Clamp...");
+  connect(clamp, &QAction::triggered, this,
+          [this]()
+          {
+            bool is_ok{false};
+            const double min_value = QInputDialog::getDouble(
+                QApplication::activeWindow(), "Clamp", "Minimum", 0.0,
+                std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(), 6,
+                &is_ok);
+            if (!is_ok)
+            {
+              return;
+            }
+            const double max_value = QInputDialog::getDouble(
+                QApplication::activeWindow(), "Clamp", "Maximum", std::max(min_value, 1.0),
+                min_value, std::numeric_limits<double>::max(), 6, &is_ok);
+            if (is_ok)
+            {
+              ApplyTransform(
+                  *m_action_handler,
+                  [min_value, max_value]() { return CreateClampTransform(min_value, max_value); },
+                  "Clamp");
+            }
+          });
 
   return result;
 }
@@ -59,6 +59,7 @@ public:
     kAddColumnBefore,
     kAddColumnAfter,
     kRemoveColumn,
+    kTransform,
     kMoreSettings,
     kTotalCount
   };
@@ -102,6 +103,11 @@ private:
    */
   std::unique_ptr<QMenu> CreateMoreSettingsMenu();
 
+  /**
+   * @brief Creates menu for kTransform action.
+   */
+  std::unique_ptr<QMenu> CreateTransformMenu();
+
   QButtonGroup* m_pointer_button_group{nullptr};
   QToolButton* m_pointer_button{nullptr};
   QWidgetAction* m_pointer_action{nullptr};
@@ -119,6 +125,9 @@ private:
   QAction* m_add_column_after{nullptr};
   QAction* m_remove_column{nullptr};
 
+  std::unique_ptr<QMenu> m_transform_menu;
+  ActionMenu* m_transform_action{nullptr};
+
   WaveformEditorActionHandler* m_action_handler{nullptr};
   sup::gui::ActionMap<ActionKey> m_action_map;
 };
@@ -29,12 +29,17 @@
 #include <sup/gui/style/style_helper.h>
 
 #include <mvvm/model/application_model.h>
+#include <mvvm/signals/model_listener.h>
+#include <mvvm/standarditems/chart_viewport_item.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/line_series_item.h>
 #include <mvvm/standarditems/point_item.h>
 #include <mvvm/views/chart_canvas.h>
 
 #include <QSplitter>
 #include <QToolBar>
 #include <QVBoxLayout>
+#include <utility>
 
 namespace sup::gui
 {
@@ -60,7 +65,8 @@ QList<QAction *> GetTableToolBarActions(WaveformEditorActions *editor_actions)
 {
   using ActionKey = WaveformEditorActions::ActionKey;
   return editor_actions->GetActions(
-      {ActionKey::kAddColumnBefore, ActionKey::kAddColumnAfter, ActionKey::kRemoveColumn});
+      {ActionKey::kAddColumnBefore, ActionKey::kAddColumnAfter, ActionKey::kRemoveColumn,
+       ActionKey::kTransform});
 }
 
 }  // namespace
@@ -72,7 +78,7 @@ WaveformEditorWidget::WaveformEditorWidget(QWidget *parent_widget)
     , m_splitter(new QSplitter)
     , m_chart_canvas(new mvvm::ChartCanvas)
     , m_table_tool_bar(new QToolBar)
-    , m_table_widget(new WaveformTableWidget(nullptr))
+    , m_table_widget(new WaveformTableWidget)
 {
   auto layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
@@ -97,6 +103,7 @@ WaveformEditorWidget::~WaveformEditorWidget() = default;
 
 void WaveformEditorWidget::SetLineSeriesItem(mvvm::LineSeriesItem *line_series_item)
 {
+  m_pending_point = nullptr;
   m_table_widget->SetLineSeriesItem(line_series_item);
   m_display_controller->SetSelected(line_series_item);
 }
@@ -105,6 +112,11 @@ void WaveformEditorWidget::SetViewportItem(mvvm::ChartViewportItem *viewport_ite
 {
   m_chart_canvas->SetViewport(viewport_item);
   m_display_controller = std::make_unique<WaveformDisplayController>(viewport_item);
+
+  m_pending_point = nullptr;
+  m_listener = std::make_unique<mvvm::ModelListener>(viewport_item->GetModel());
+  m_listener->Connect<mvvm::AboutToRemoveItemEvent>(
+      this, &WaveformEditorWidget::OnAboutToRemoveItemEvent);
 }
 
 mvvm::PointItem *WaveformEditorWidget::GetSelectedPoint() const
@@ -112,6 +124,11 @@ mvvm::PointItem *WaveformEditorWidget::GetSelectedPoint() const
   return m_table_widget->GetSelectedPoint();
 }
 
+std::vector<mvvm::PointItem *> WaveformEditorWidget::GetSelectedPoints() const
+{
+  return m_table_widget->GetSelectedPoints();
+}
+
 void WaveformEditorWidget::ZoomIn()
 {
   m_chart_canvas->ZoomIn();
@@ -137,7 +154,9 @@ WaveformEditorContext WaveformEditorWidget::CreateActionContext() const
   auto get_current_line_series = [this]() { return GetLineSeriesItem(); };
 
   auto get_selected_point_callback = [this]() { return GetSelectedPoint(); };
-  return {get_current_line_series, get_selected_point_callback};
+
+  auto get_selected_points_callback = [this]() { return GetSelectedPoints(); };
+  return {get_current_line_series, get_selected_point_callback, get_selected_points_callback};
 }
 
 void WaveformEditorWidget::SetupConnections()
@@ -155,6 +174,10 @@ void WaveformEditorWidget::SetupConnections()
   connect(m_action_handler, &WaveformEditorActionHandler::SelectItemRequest, this,
           [this](auto item) { SetSelectedPoint(dynamic_cast<const mvvm::PointItem *>(item)); });
 
+  // in sorted mode, point with edited x is moved to its place
+  connect(m_table_widget, &WaveformTableWidget::PointXEdited, this,
+          &WaveformEditorWidget::OnPointXEdited);
+
   // propagate request to change canvas operation mode (select/pan) from toolbar to canvas
   connect(m_actions, &WaveformEditorActions::ChangeOperationModeRequest, m_chart_canvas,
           &mvvm::ChartCanvas::SetOperationMode);
@@ -164,6 +187,38 @@ void WaveformEditorWidget::SetupConnections()
           &WaveformEditorActions::SetPointerButtonGroup);
 }
 
+void WaveformEditorWidget::OnPointXEdited(mvvm::PointItem *point)
+{
+  auto line_series = GetLineSeriesItem();
+  if (!m_action_handler->IsSortedMode() || !line_series || m_pending_point)
+  {
+    return;
+  }
+
+  if (point && point->GetParent() == line_series->GetDataItem())
+  {
+    // the table is still in the middle of editing, the point is moved after it
+    m_pending_point = point;
+    QMetaObject::invokeMethod(this, &WaveformEditorWidget::RestorePendingPointOrder,
+                              Qt::QueuedConnection);
+  }
+}
+
+void WaveformEditorWidget::OnAboutToRemoveItemEvent(const mvvm::AboutToRemoveItemEvent &event)
+{
+  (void)event;
+  // removed item might be the pending point, or one of its parents
+  m_pending_point = nullptr;
+}
+
+void WaveformEditorWidget::RestorePendingPointOrder()
+{
+  if (auto point = std::exchange(m_pending_point, nullptr); point)
+  {
+    m_action_handler->RestoreSortedOrder(*point);
+  }
+}
+
 std::unique_ptr<QWidget> WaveformEditorWidget::CreateTableEnvelopWidget()
 {
   auto result = std::make_unique<QWidget>();
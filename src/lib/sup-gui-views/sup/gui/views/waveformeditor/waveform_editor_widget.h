@@ -21,7 +21,11 @@
 #ifndef SUP_GUI_VIEWS_WAVEFORMEDITOR_WAVEFORM_EDITOR_WIDGET_H_
 #define SUP_GUI_VIEWS_WAVEFORMEDITOR_WAVEFORM_EDITOR_WIDGET_H_
 
+#include <mvvm/signals/event_types.h>
+
 #include <QWidget>
+#include <memory>
+#include <vector>
 
 class QToolBar;
 class QSplitter;
@@ -33,6 +37,7 @@ class LineSeriesItem;
 class ChartViewportItem;
 class ChartCanvas;
 class PointItem;
+class ModelListener;
 }  // namespace mvvm
 
 namespace sup::gui
@@ -83,6 +88,11 @@ public:
    */
   mvvm::PointItem* GetSelectedPoint() const;
 
+  /**
+   * @brief Returns all points with at least one selected cell.
+   */
+  std::vector<mvvm::PointItem*> GetSelectedPoints() const;
+
   void ZoomIn();
 
   void ZoomOut();
@@ -102,6 +112,17 @@ public:
 private:
   void SetupConnections();
 
+  /**
+   * @brief Schedules restoration of points order, if x value of a point was edited in the table in
+   * sorted mode.
+   *
+   * @details Only edits made by the user are handled, changes made by undo/redo are left as they
+   * are, so the redo history is kept.
+   */
+  void OnPointXEdited(mvvm::PointItem* point);
+  void OnAboutToRemoveItemEvent(const mvvm::AboutToRemoveItemEvent& event);
+  void RestorePendingPointOrder();
+
   /**
    * @brief Places table widget together with own toolbar.
    */
@@ -115,6 +136,9 @@ private:
   mvvm::ChartCanvas* m_chart_canvas{nullptr};
   QToolBar* m_table_tool_bar{nullptr};
   WaveformTableWidget* m_table_widget{nullptr};
+
+  std::unique_ptr<mvvm::ModelListener> m_listener;
+  mvvm::PointItem* m_pending_point{nullptr};  //!< point which has to be moved to its sorted place
 };
 
 }  // namespace sup::gui
@@ -20,23 +20,38 @@
 
 #include "waveform_table_widget.h"
 
-#include <sup/gui/views/waveformeditor/waveform_table_component_provider.h>
+#include <sup/gui/plotting/waveform_table_model.h>
 
-#include <mvvm/model/application_model.h>
 #include <mvvm/standarditems/line_series_data_item.h>
 #include <mvvm/standarditems/line_series_item.h>
 #include <mvvm/standarditems/point_item.h>
 #include <mvvm/widgets/widget_utils.h>
 
 #include <QHeaderView>
+#include <QItemSelectionModel>
 #include <QTableView>
+#include <QTransposeProxyModel>
 #include <QVBoxLayout>
+#include <algorithm>
+#include <unordered_set>
 
 namespace sup::gui
 {
 
-WaveformTableWidget::WaveformTableWidget(mvvm::ApplicationModel *model, QWidget *parent_widget)
-    : QWidget(parent_widget), m_table_view(new QTableView)
+namespace
+{
+
+//! Selection of a cell selects the whole column with x and y values of the point.
+const QItemSelectionModel::SelectionFlags kSelectPointFlags =
+    QItemSelectionModel::ClearAndSelect | QItemSelectionModel::Columns;
+
+}  // namespace
+
+WaveformTableWidget::WaveformTableWidget(QWidget *parent_widget)
+    : QWidget(parent_widget)
+    , m_table_view(new QTableView)
+    , m_table_model(new WaveformTableModel(this))
+    , m_proxy_model(new QTransposeProxyModel(this))
 {
   setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
   auto layout = new QHBoxLayout(this);
@@ -44,12 +59,17 @@ WaveformTableWidget::WaveformTableWidget(mvvm::ApplicationModel *model, QWidget
 
   layout->addWidget(m_table_view);
 
-  SetModel(model);
+  // points are shown as columns
+  m_proxy_model->setSourceModel(m_table_model);
+  m_table_view->setModel(m_proxy_model);
 
   m_table_view->setAlternatingRowColors(true);
   m_table_view->horizontalHeader()->setFixedHeight(mvvm::utils::UnitSize(0.75));
   m_table_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
 
+  connect(m_table_model, &WaveformTableModel::PointXEdited, this,
+          &WaveformTableWidget::PointXEdited);
+
   // the only way to set background color for this widget, but not down to children
   setObjectName("WaveformTableWidget");
   setStyleSheet("QWidget#WaveformTableWidget{background-color:white;}");
@@ -58,12 +78,6 @@ WaveformTableWidget::WaveformTableWidget(mvvm::ApplicationModel *model, QWidget
 
 WaveformTableWidget::~WaveformTableWidget() = default;
 
-void WaveformTableWidget::SetModel(mvvm::ApplicationModel *model)
-{
-  m_model = model;
-  m_component_provider = std::make_unique<WaveformTableComponentProvider>(model, m_table_view);
-}
-
 mvvm::LineSeriesItem *WaveformTableWidget::GetLineSeriesItem()
 {
   return m_current_line_series;
@@ -72,31 +86,48 @@ mvvm::LineSeriesItem *WaveformTableWidget::GetLineSeriesItem()
 void WaveformTableWidget::SetLineSeriesItem(mvvm::LineSeriesItem *line_series_item)
 {
   m_current_line_series = line_series_item;
-  m_component_provider->SetItem(line_series_item ? line_series_item->GetDataItem() : nullptr);
+  m_table_model->SetDataItem(line_series_item ? line_series_item->GetDataItem() : nullptr);
 }
 
 mvvm::PointItem *WaveformTableWidget::GetSelectedPoint()
 {
-  auto selected = m_component_provider->GetSelectedItem();
-  auto parent_struct = selected ? selected->GetParent() : nullptr;
-  return dynamic_cast<mvvm::PointItem *>(parent_struct);
+  const auto selected = m_table_view->selectionModel()->selectedIndexes();
+  return selected.empty() ? nullptr
+                          : m_table_model->GetPoint(m_proxy_model->mapToSource(selected.front()));
+}
+
+std::vector<mvvm::PointItem *> WaveformTableWidget::GetSelectedPoints()
+{
+  std::vector<int> rows;
+  for (const auto &index : m_table_view->selectionModel()->selectedIndexes())
+  {
+    rows.push_back(m_proxy_model->mapToSource(index).row());
+  }
+  std::sort(rows.begin(), rows.end());
+  (void)rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+  std::vector<mvvm::PointItem *> result;
+  result.reserve(rows.size());
+  for (auto row : rows)
+  {
+    if (auto point = m_table_model->GetPoint(m_table_model->index(row, 0)); point)
+    {
+      result.push_back(point);
+    }
+  }
+  return result;
 }
 
 void WaveformTableWidget::SetSelectedPoint(const mvvm::PointItem *item)
 {
   // enough to select only x, will select the whole column
-  auto points = item->GetAllItems();
-  if (!points.empty())
+  if (auto index = GetViewIndex(item); index.isValid())
   {
-    auto x_cell = points.at(0);
-    m_component_provider->SetSelectedItem(x_cell);
+    m_table_view->selectionModel()->select(index, kSelectPointFlags);
+    m_table_view->selectionModel()->setCurrentIndex(index, QItemSelectionModel::NoUpdate);
 
     // make sure cell is visible
-    auto indexes = m_component_provider->GetViewIndexes(x_cell);
-    if (!indexes.empty())
-    {
-      m_table_view->scrollTo(indexes.at(0));
-    }
+    m_table_view->scrollTo(index);
   }
 }
 
@@ -109,4 +140,17 @@ QSize WaveformTableWidget::sizeHint() const
   return {800, height};
 }
 
+QModelIndex WaveformTableWidget::GetViewIndex(const mvvm::PointItem *item) const
+{
+  auto data_item = m_table_model->GetDataItem();
+  if (!item || !data_item || item->GetParent() != data_item)
+  {
+    return {};
+  }
+
+  const auto source_index =
+      m_table_model->index(item->GetTagIndex().GetIndex(), WaveformTableModel::kXColumn);
+  return m_proxy_model->mapFromSource(source_index);
+}
+
 }  // namespace sup::gui
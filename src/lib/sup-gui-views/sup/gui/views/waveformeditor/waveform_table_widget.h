@@ -21,15 +21,15 @@
 #ifndef SUP_GUI_VIEWS_WAVEFORMEDITOR_WAVEFORM_TABLE_WIDGET_H_
 #define SUP_GUI_VIEWS_WAVEFORMEDITOR_WAVEFORM_TABLE_WIDGET_H_
 
+#include <QModelIndex>
 #include <QWidget>
-#include <memory>
+#include <vector>
 
 class QTableView;
+class QTransposeProxyModel;
 
 namespace mvvm
 {
-class ApplicationModel;
-class SessionItem;
 class LineSeriesItem;
 class PointItem;
 }  // namespace mvvm
@@ -37,13 +37,14 @@ class PointItem;
 namespace sup::gui
 {
 
-class WaveformTableComponentProvider;
+class WaveformTableModel;
 
 /**
  * @brief The WaveformTableWidget class represents a widget with little table with line series
  * points.
  *
- * Located at the bottom of WaveformEditor, right under 1D plot.
+ * Located at the bottom of WaveformEditor, right under 1D plot. Points are shown as columns, the
+ * table reads values on demand, so it opens instantly for waveforms of any size.
  */
 
 class WaveformTableWidget : public QWidget
@@ -51,11 +52,9 @@ class WaveformTableWidget : public QWidget
   Q_OBJECT
 
 public:
-  explicit WaveformTableWidget(mvvm::ApplicationModel* model, QWidget* parent_widget = nullptr);
+  explicit WaveformTableWidget(QWidget* parent_widget = nullptr);
   ~WaveformTableWidget() override;
 
-  void SetModel(mvvm::ApplicationModel* model);
-
   /**
    * @brief Returns current waveform being served by the table widget.
    */
@@ -76,6 +75,11 @@ public:
    */
   mvvm::PointItem* GetSelectedPoint();
 
+  /**
+   * @brief Returns all points with at least one selected cell, ordered as in the waveform.
+   */
+  std::vector<mvvm::PointItem*> GetSelectedPoints();
+
   /**
    * @brief Set point selected in table widget.
    *
@@ -87,11 +91,21 @@ public:
 
   QSize sizeHint() const override;
 
+signals:
+  /**
+   * @brief Reports that x value of the point was edited by the user in the table.
+   */
+  void PointXEdited(mvvm::PointItem* point);
+
 private:
-  QTableView* m_table_view{nullptr};
+  /**
+   * @brief Returns view index of the x cell of the given point.
+   */
+  QModelIndex GetViewIndex(const mvvm::PointItem* item) const;
 
-  mvvm::ApplicationModel* m_model{nullptr};
-  std::unique_ptr<WaveformTableComponentProvider> m_component_provider;
+  QTableView* m_table_view{nullptr};
+  WaveformTableModel* m_table_model{nullptr};
+  QTransposeProxyModel* m_proxy_model{nullptr};
 
   mvvm::LineSeriesItem* m_current_line_series{nullptr};
 };
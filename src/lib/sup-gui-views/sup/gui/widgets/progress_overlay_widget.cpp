@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "progress_overlay_widget.h"
+
+#include <mvvm/widgets/widget_utils.h>
+
+#include <QEvent>
+#include <QLabel>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+namespace sup::gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns the width of the panel with progress bar.
+ */
+int GetPanelWidth()
+{
+  return mvvm::utils::UnitSize(25);
+}
+
+}  // namespace
+
+ProgressOverlayWidget::ProgressOverlayWidget(QWidget *area)
+    : QFrame(area)
+    , m_area(area)
+    , m_label(new QLabel)
+    , m_progress_bar(new QProgressBar)
+    , m_cancel_button(new QPushButton("Cancel"))
+{
+  setAutoFillBackground(false);
+  setStyleSheet("sup--gui--ProgressOverlayWidget { background-color: rgba(0, 0, 0, 40); }");
+
+  auto panel = new QFrame;
+  panel->setFrameShape(QFrame::StyledPanel);
+  panel->setAutoFillBackground(true);
+  panel->setFixedWidth(GetPanelWidth());
+
+  m_progress_bar->setRange(0, 100);
+  m_label->setWordWrap(true);
+
+  auto panel_layout = new QVBoxLayout(panel);
+  panel_layout->addWidget(m_label);
+  panel_layout->addWidget(m_progress_bar);
+  panel_layout->addWidget(m_cancel_button, 0, Qt::AlignRight);
+
+  auto layout = new QVBoxLayout(this);
+  layout->addWidget(panel, 0, Qt::AlignCenter);
+
+  connect(m_cancel_button, &QPushButton::clicked, this,
+          [this]()
+          {
+            m_cancel_button->setEnabled(false);
+            emit CancelRequested();
+          });
+
+  m_area->installEventFilter(this);
+  hide();
+}
+
+ProgressOverlayWidget::~ProgressOverlayWidget() = default;
+
+void ProgressOverlayWidget::SetText(const QString &text)
+{
+  m_label->setText(text);
+}
+
+void ProgressOverlayWidget::SetProgress(int percentage)
+{
+  m_progress_bar->setValue(percentage);
+}
+
+void ProgressOverlayWidget::Start(const QString &text)
+{
+  SetText(text);
+  SetProgress(0);
+  m_cancel_button->setEnabled(true);
+  UpdateGeometry();
+  raise();
+  show();
+}
+
+bool ProgressOverlayWidget::eventFilter(QObject *obj, QEvent *event)
+{
+  if (obj == m_area && event->type() == QEvent::Resize)
+  {
+    UpdateGeometry();
+  }
+
+  return QFrame::eventFilter(obj, event);
+}
+
+void ProgressOverlayWidget::UpdateGeometry()
+{
+  setGeometry(m_area->rect());
+}
+
+}  // namespace sup::gui
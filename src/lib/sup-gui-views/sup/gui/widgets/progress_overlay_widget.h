@@ -0,0 +1,79 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_GUI_WIDGETS_PROGRESS_OVERLAY_WIDGET_H_
+#define SUP_GUI_WIDGETS_PROGRESS_OVERLAY_WIDGET_H_
+
+#include <QFrame>
+
+class QLabel;
+class QProgressBar;
+class QPushButton;
+
+namespace sup::gui
+{
+
+/**
+ * @brief The ProgressOverlayWidget class covers the area widget with a semi-transparent panel
+ * showing the progress of a long operation, and a button to cancel it.
+ *
+ * The overlay follows the size of the area widget and blocks the user input to it while visible.
+ */
+class ProgressOverlayWidget : public QFrame
+{
+  Q_OBJECT
+
+public:
+  explicit ProgressOverlayWidget(QWidget* area);
+  ~ProgressOverlayWidget() override;
+
+  /**
+   * @brief Sets the text describing the running operation.
+   */
+  void SetText(const QString& text);
+
+  /**
+   * @brief Sets the progress in percents.
+   */
+  void SetProgress(int percentage);
+
+  /**
+   * @brief Resets the progress, enables cancel button and shows the overlay on top of the area.
+   */
+  void Start(const QString& text);
+
+signals:
+  void CancelRequested();
+
+protected:
+  bool eventFilter(QObject* obj, QEvent* event) override;
+
+private:
+  void UpdateGeometry();
+
+  QWidget* m_area{nullptr};
+  QLabel* m_label{nullptr};
+  QProgressBar* m_progress_bar{nullptr};
+  QPushButton* m_cancel_button{nullptr};
+};
+
+}  // namespace sup::gui
+
+#endif  // SUP_GUI_WIDGETS_PROGRESS_OVERLAY_WIDGET_H_
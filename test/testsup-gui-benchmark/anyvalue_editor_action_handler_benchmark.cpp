@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/components/anyvalue_editor_action_handler.h>
+#include <sup/gui/components/anyvalue_editor_context.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/viewmodel/anyvalue_viewmodel.h>
+
+#include <mvvm/model/application_model.h>
+
+#include <sup/dto/anytype.h>
+
+#include <benchmark/benchmark.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of AnyValueEditorActionHandler when pasting thousands of siblings
+ * into the array shown by the view model.
+ */
+class AnyValueEditorActionHandlerBenchmark : public benchmark::Fixture
+{
+public:
+  AnyValueEditorActionHandlerBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Creates context with the given item selected and all notifications ignored.
+   */
+  static AnyValueEditorContext CreateContext(AnyValueItem* selected_item)
+  {
+    AnyValueEditorContext result;
+    result.selected_items = [selected_item]() { return std::vector<AnyValueItem*>{selected_item}; };
+    result.notify_request = [](auto) {};
+    result.send_message = [](const auto&) {};
+    return result;
+  }
+
+  /**
+   * @brief Creates scalars ready for insertion.
+   */
+  static std::vector<std::unique_ptr<mvvm::SessionItem>> CreateScalars(std::int64_t count)
+  {
+    std::vector<std::unique_ptr<mvvm::SessionItem>> result;
+    for (std::int64_t index = 0; index < count; ++index)
+    {
+      auto scalar = std::make_unique<AnyValueScalarItem>();
+      scalar->SetAnyTypeName(sup::dto::kInt32TypeName);
+      result.push_back(std::move(scalar));
+    }
+    return result;
+  }
+};
+
+//! Pasting siblings into the array one by one, each insertion is a separate undo command.
+
+BENCHMARK_DEFINE_F(AnyValueEditorActionHandlerBenchmark, PasteOneByOne)(benchmark::State& state)
+{
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    mvvm::ApplicationModel model;
+    model.SetUndoEnabled(true);
+    auto array_item = model.InsertItem<AnyValueArrayItem>();
+    const AnyValueViewModel viewmodel(&model, 0);
+    AnyValueEditorActionHandler handler(CreateContext(array_item), model.GetRootItem());
+    auto items = CreateScalars(state.range(0));
+    state.ResumeTiming();
+
+    for (auto& item : items)
+    {
+      std::vector<std::unique_ptr<mvvm::SessionItem>> batch;
+      batch.push_back(std::move(item));
+      (void)handler.InsertItems(std::move(batch), array_item, mvvm::TagIndex::Append());
+    }
+  }
+}
+
+//! Pasting siblings into the array with a single batch insertion.
+
+BENCHMARK_DEFINE_F(AnyValueEditorActionHandlerBenchmark, PasteBatch)(benchmark::State& state)
+{
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    mvvm::ApplicationModel model;
+    model.SetUndoEnabled(true);
+    auto array_item = model.InsertItem<AnyValueArrayItem>();
+    const AnyValueViewModel viewmodel(&model, 0);
+    AnyValueEditorActionHandler handler(CreateContext(array_item), model.GetRootItem());
+    auto items = CreateScalars(state.range(0));
+    state.ResumeTiming();
+
+    (void)handler.InsertItems(std::move(items), array_item, mvvm::TagIndex::Append());
+  }
+}
+
+BENCHMARK_REGISTER_F(AnyValueEditorActionHandlerBenchmark, PasteOneByOne)->Arg(1000)->Arg(5000);
+BENCHMARK_REGISTER_F(AnyValueEditorActionHandlerBenchmark, PasteBatch)->Arg(1000)->Arg(5000);
+
+}  // namespace sup::gui::test
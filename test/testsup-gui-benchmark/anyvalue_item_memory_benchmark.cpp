@@ -0,0 +1,189 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_utils.h>
+
+#include <mvvm/test/test_helper.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <benchmark/benchmark.h>
+#include <testutils/cmake_info.h>
+#include <unistd.h>
+
+#include <fstream>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing memory footprint of AnyValueItem trees with millions of leaves.
+ *
+ * The tree is built from an array containing copies of a heavy configuration. Resident memory is
+ * measured before and after the construction, thus each benchmark runs a single iteration.
+ */
+class AnyValueItemMemoryBenchmark : public benchmark::Fixture
+{
+public:
+  AnyValueItemMemoryBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Returns AnyValue with the array containing given number of copies of heavy
+   * configuration.
+   */
+  static sup::dto::AnyValue CreateScaledAnyValue(std::int64_t copy_count)
+  {
+    const auto file_path = ProjectResourceDir() + "/anyvalue-editor/cis-configuration.json";
+    const auto configuration = AnyValueFromJSONString(mvvm::test::GetTextFileContent(file_path));
+
+    sup::dto::AnyValue result = sup::dto::ArrayValue({configuration});
+    for (std::int64_t index = 1; index < copy_count; ++index)
+    {
+      result.AddElement(configuration);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns AnyValue with the array of float64 of the given size.
+   */
+  static sup::dto::AnyValue CreateFloatArray(std::int64_t size)
+  {
+    sup::dto::AnyValue result(static_cast<std::size_t>(size), sup::dto::Float64Type);
+    for (std::int64_t index = 0; index < size; ++index)
+    {
+      result[static_cast<std::size_t>(index)] = static_cast<double>(index) * 0.5;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Builds the item of a large array with the given function and reports memory per
+   * element.
+   */
+  template <typename T>
+  static void MeasureArray(benchmark::State& state, T create_item)
+  {
+    const auto anyvalue = CreateFloatArray(state.range(0));
+
+    for (auto dummy : state)
+    {
+      const auto memory_before = GetResidentMemory();
+      auto item = create_item(anyvalue);
+      const auto memory_after = GetResidentMemory();
+
+      state.PauseTiming();
+      state.counters["bytes_per_element"] = static_cast<double>(memory_after - memory_before)
+                                            / static_cast<double>(state.range(0));
+      item.reset();
+      state.ResumeTiming();
+    }
+  }
+
+  /**
+   * @brief Returns the number of scalars in the tree.
+   */
+  static std::int64_t GetLeafCount(const AnyValueItem& item)
+  {
+    if (item.IsScalar())
+    {
+      return 1;
+    }
+
+    std::int64_t result{0};
+    for (auto child : item.GetChildren())
+    {
+      result += GetLeafCount(*child);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns resident memory of the process in bytes.
+   */
+  static std::int64_t GetResidentMemory()
+  {
+    std::ifstream statm("/proc/self/statm");
+    std::int64_t total_pages{0};
+    std::int64_t resident_pages{0};
+    statm >> total_pages >> resident_pages;
+    return resident_pages * sysconf(_SC_PAGESIZE);
+  }
+
+  /**
+   * @brief Builds the tree with the given function and reports memory per leaf.
+   */
+  template <typename T>
+  static void MeasureTree(benchmark::State& state, T create_item)
+  {
+    const auto anyvalue = CreateScaledAnyValue(state.range(0));
+
+    for (auto dummy : state)
+    {
+      const auto memory_before = GetResidentMemory();
+      auto item = create_item(anyvalue);
+      const auto memory_after = GetResidentMemory();
+
+      state.PauseTiming();
+      const auto leaf_count = GetLeafCount(*item);
+      state.counters["leaves"] = static_cast<double>(leaf_count);
+      state.counters["bytes_per_leaf"] =
+          static_cast<double>(memory_after - memory_before) / static_cast<double>(leaf_count);
+      item.reset();
+      state.ResumeTiming();
+    }
+  }
+};
+
+//! Tree with regular scalars, each one owns a property item with the type.
+
+BENCHMARK_DEFINE_F(AnyValueItemMemoryBenchmark, RegularScalars)(benchmark::State& state)
+{
+  MeasureTree(state, [](const auto& anyvalue) { return CreateAnyValueItem(anyvalue); });
+}
+
+//! Array of float64 with every element represented by a scalar item.
+
+BENCHMARK_DEFINE_F(AnyValueItemMemoryBenchmark, RegularArray)(benchmark::State& state)
+{
+  MeasureArray(state, [](const auto& anyvalue) { return CreateAnyValueItem(anyvalue); });
+}
+
+//! Array of float64 with elements packed in a single buffer.
+
+BENCHMARK_DEFINE_F(AnyValueItemMemoryBenchmark, PackedArray)(benchmark::State& state)
+{
+  MeasureArray(state, [](const auto& anyvalue) { return CreatePackedAnyValueItem(anyvalue); });
+}
+
+BENCHMARK_REGISTER_F(AnyValueItemMemoryBenchmark, RegularScalars)
+    ->Arg(100)
+    ->Arg(500)
+    ->Iterations(1);
+BENCHMARK_REGISTER_F(AnyValueItemMemoryBenchmark, RegularArray)->Arg(100000)->Iterations(1);
+BENCHMARK_REGISTER_F(AnyValueItemMemoryBenchmark, PackedArray)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(1);
+
+}  // namespace sup::gui::test
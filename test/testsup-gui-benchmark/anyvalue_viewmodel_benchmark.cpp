@@ -0,0 +1,116 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/viewmodel/anyvalue_viewmodel.h>
+
+#include <mvvm/model/application_model.h>
+
+#include <sup/dto/anytype.h>
+
+#include <benchmark/benchmark.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of AnyValueViewModel when opening the tree with a huge array.
+ */
+class AnyValueViewModelBenchmark : public benchmark::Fixture
+{
+public:
+  AnyValueViewModelBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Inserts array with the given number of scalars into the model.
+   */
+  static void InsertArray(mvvm::ApplicationModel& model, std::int64_t size)
+  {
+    auto array_item = model.InsertItem<AnyValueArrayItem>();
+    for (std::int64_t index = 0; index < size; ++index)
+    {
+      auto scalar = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+      scalar->SetAnyTypeName(sup::dto::kInt32TypeName);
+    }
+  }
+};
+
+//! Opening the tree when all rows are built at once.
+
+BENCHMARK_DEFINE_F(AnyValueViewModelBenchmark, OpenTreeEager)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  InsertArray(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    AnyValueViewModel viewmodel(&model, 0);
+    benchmark::DoNotOptimize(viewmodel.rowCount());
+  }
+}
+
+//! Opening the tree and expanding the array, when rows are fetched page by page.
+
+BENCHMARK_DEFINE_F(AnyValueViewModelBenchmark, OpenTreeLazy)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  InsertArray(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    AnyValueViewModel viewmodel(&model);
+    viewmodel.fetchMore(viewmodel.index(0, 0));
+    benchmark::DoNotOptimize(viewmodel.rowCount(viewmodel.index(0, 0)));
+  }
+}
+
+//! Opening the tree and scrolling through the whole array, when rows are fetched page by page.
+
+BENCHMARK_DEFINE_F(AnyValueViewModelBenchmark, ScrollTreeLazy)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  InsertArray(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    AnyValueViewModel viewmodel(&model);
+    const auto array_index = viewmodel.index(0, 0);
+    while (viewmodel.canFetchMore(array_index))
+    {
+      viewmodel.fetchMore(array_index);
+    }
+    benchmark::DoNotOptimize(viewmodel.rowCount(array_index));
+  }
+}
+
+BENCHMARK_REGISTER_F(AnyValueViewModelBenchmark, OpenTreeEager)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+BENCHMARK_REGISTER_F(AnyValueViewModelBenchmark, OpenTreeLazy)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+BENCHMARK_REGISTER_F(AnyValueViewModelBenchmark, ScrollTreeLazy)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000);
+
+}  // namespace sup::gui::test
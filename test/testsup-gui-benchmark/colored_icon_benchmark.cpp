@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/style/colored_icon_cache.h>
+#include <sup/gui/style/style_helper.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QAction>
+#include <QMainWindow>
+#include <QPixmap>
+#include <QStringList>
+#include <QToolBar>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of colored icons rendering in a toolbar-heavy window.
+ */
+class ColoredIconBenchmark : public benchmark::Fixture
+{
+public:
+  ColoredIconBenchmark() { Unit(benchmark::kMicrosecond); }
+
+  /**
+   * @brief Populates the window with toolbars full of icons.
+   */
+  static void PopulateWindow(QMainWindow& window)
+  {
+    const QStringList icon_names = {
+        "animation-outline", "code-json", "dock-left", "dock-right", "file-tree-outline",
+        "magnify-minus-outline", "magnify-plus-outline", "menu", "plus-circle-outline",
+        "table-column-remove"};
+    const int toolbar_count = 10;
+
+    for (int index = 0; index < toolbar_count; ++index)
+    {
+      auto toolbar = window.addToolBar(QString("toolbar%1").arg(index));
+      toolbar->setIconSize(utils::ToolBarIconSize());
+      for (const auto& name : icon_names)
+      {
+        toolbar->addAction(utils::FindIcon(name), name);
+      }
+    }
+    window.resize(1600, 800);
+  }
+};
+
+//! Repaint of the window with icons served from the cache.
+
+BENCHMARK_F(ColoredIconBenchmark, PaintToolBarsCached)(benchmark::State& state)
+{
+  QMainWindow window;
+  PopulateWindow(window);
+  (void)window.grab();
+
+  for (auto dummy : state)
+  {
+    auto pixmap = window.grab();
+    benchmark::DoNotOptimize(pixmap);
+  }
+}
+
+//! Repaint of the window when icons have to be rasterized on every paint, as it was before the
+//! introduction of the cache.
+
+BENCHMARK_F(ColoredIconBenchmark, PaintToolBarsUncached)(benchmark::State& state)
+{
+  QMainWindow window;
+  PopulateWindow(window);
+
+  for (auto dummy : state)
+  {
+    ColoredIconCache::Instance().Clear();
+    auto pixmap = window.grab();
+    benchmark::DoNotOptimize(pixmap);
+  }
+}
+
+//! Creation of toolbars with icons found by name.
+
+BENCHMARK_F(ColoredIconBenchmark, CreateToolBars)(benchmark::State& state)
+{
+  for (auto dummy : state)
+  {
+    QMainWindow window;
+    PopulateWindow(window);
+  }
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/components/dto_composer_action_handler.h>
+#include <sup/gui/components/dto_composer_tasks.h>
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/container_item.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing latency of DtoComposerView container duplication, in the model, and in a
+ * background task.
+ */
+class DtoComposerDuplicationBenchmark : public benchmark::Fixture
+{
+public:
+  DtoComposerDuplicationBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Populates the model with a container holding a struct with the given number of leaves.
+   */
+  static void PopulateModel(mvvm::ApplicationModel& model, std::int64_t leaf_count)
+  {
+    sup::dto::AnyValue array(static_cast<std::size_t>(leaf_count - 1),
+                             sup::dto::SignedInteger32Type);
+    for (std::int64_t index = 0; index < leaf_count - 1; ++index)
+    {
+      array[static_cast<std::size_t>(index)] = static_cast<std::int32_t>(index);
+    }
+    const sup::dto::AnyValue anyvalue = {{"name", {sup::dto::StringType, "abc"}}, {"data", array}};
+
+    auto container = model.InsertItem<mvvm::ContainerItem>();
+    (void)model.InsertItem(CreateAnyValueItem(anyvalue), container, mvvm::TagIndex::Append());
+  }
+
+  /**
+   * @brief Removes the copy of the container to start the next iteration from the same state.
+   */
+  static void RemoveCopy(mvvm::ApplicationModel& model)
+  {
+    model.RemoveItem(model.GetRootItem()->GetItem(mvvm::TagIndex::Default(1)));
+  }
+};
+
+//! Duplication by copying items in the model, the GUI thread is blocked for the whole time.
+
+BENCHMARK_DEFINE_F(DtoComposerDuplicationBenchmark, DuplicateInModel)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  PopulateModel(model, state.range(0));
+  DtoComposerActionHandler action_handler(&model);
+
+  for (auto dummy : state)
+  {
+    action_handler.OnDuplicateContainer(0);
+
+    state.PauseTiming();
+    RemoveCopy(model);
+    state.ResumeTiming();
+  }
+  state.counters["leaves"] = static_cast<double>(state.range(0));
+}
+
+//! Snapshot of the container taken by the task on construction, the only part of the background
+//! duplication blocking the GUI thread before the insertion.
+
+BENCHMARK_DEFINE_F(DtoComposerDuplicationBenchmark, TaskSnapshot)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  PopulateModel(model, state.range(0));
+  DtoComposerActionHandler action_handler(&model);
+
+  for (auto dummy : state)
+  {
+    auto task = action_handler.CreateDuplicateTask(0);
+    benchmark::DoNotOptimize(task);
+
+    state.PauseTiming();
+    task.reset();
+    state.ResumeTiming();
+  }
+  state.counters["leaves"] = static_cast<double>(state.range(0));
+}
+
+//! Run of the task, which happens in a background thread.
+
+BENCHMARK_DEFINE_F(DtoComposerDuplicationBenchmark, TaskRun)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  PopulateModel(model, state.range(0));
+  DtoComposerActionHandler action_handler(&model);
+  TaskContext context{CancellationToken{}};
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    auto task = action_handler.CreateDuplicateTask(0);
+    state.ResumeTiming();
+
+    task->Run(context);
+
+    state.PauseTiming();
+    task.reset();
+    state.ResumeTiming();
+  }
+  state.counters["leaves"] = static_cast<double>(state.range(0));
+}
+
+//! Insertion of the ready container in the model, the GUI thread part after the task run.
+
+BENCHMARK_DEFINE_F(DtoComposerDuplicationBenchmark, TaskInsert)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  PopulateModel(model, state.range(0));
+  DtoComposerActionHandler action_handler(&model);
+  TaskContext context{CancellationToken{}};
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    auto task = action_handler.CreateDuplicateTask(0);
+    task->Run(context);
+    state.ResumeTiming();
+
+    action_handler.InsertDuplicatedContainer(*task);
+
+    state.PauseTiming();
+    RemoveCopy(model);
+    state.ResumeTiming();
+  }
+  state.counters["leaves"] = static_cast<double>(state.range(0));
+}
+
+//! Whole GUI thread latency of the background duplication: the snapshot of AnyValues taken on
+//! task construction, and the insertion of the ready container. The run itself isn't measured.
+
+BENCHMARK_DEFINE_F(DtoComposerDuplicationBenchmark, TaskGuiThread)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  PopulateModel(model, state.range(0));
+  DtoComposerActionHandler action_handler(&model);
+  TaskContext context{CancellationToken{}};
+
+  for (auto dummy : state)
+  {
+    auto task = action_handler.CreateDuplicateTask(0);
+
+    state.PauseTiming();
+    task->Run(context);
+    state.ResumeTiming();
+
+    action_handler.InsertDuplicatedContainer(*task);
+
+    state.PauseTiming();
+    task.reset();
+    RemoveCopy(model);
+    state.ResumeTiming();
+  }
+  state.counters["leaves"] = static_cast<double>(state.range(0));
+}
+
+BENCHMARK_REGISTER_F(DtoComposerDuplicationBenchmark, DuplicateInModel)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(3);
+BENCHMARK_REGISTER_F(DtoComposerDuplicationBenchmark, TaskSnapshot)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(3);
+BENCHMARK_REGISTER_F(DtoComposerDuplicationBenchmark, TaskRun)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(3);
+BENCHMARK_REGISTER_F(DtoComposerDuplicationBenchmark, TaskInsert)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(3);
+BENCHMARK_REGISTER_F(DtoComposerDuplicationBenchmark, TaskGuiThread)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Iterations(3);
+
+}  // namespace sup::gui::test
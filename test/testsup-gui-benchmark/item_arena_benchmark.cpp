@@ -0,0 +1,95 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/model/item_arena.h>
+
+#include <mvvm/test/test_helper.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <benchmark/benchmark.h>
+#include <testutils/cmake_info.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing arena allocation of AnyValueItem trees against the global heap.
+ */
+class ItemArenaBenchmark : public benchmark::Fixture
+{
+public:
+  ItemArenaBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Returns AnyValue with the array containing given number of copies of heavy
+   * configuration.
+   */
+  static sup::dto::AnyValue CreateScaledAnyValue(std::int64_t copy_count)
+  {
+    const auto file_path = ProjectResourceDir() + "/anyvalue-editor/cis-configuration.json";
+    const auto configuration = AnyValueFromJSONString(mvvm::test::GetTextFileContent(file_path));
+
+    sup::dto::AnyValue result = sup::dto::ArrayValue({configuration});
+    for (std::int64_t index = 1; index < copy_count; ++index)
+    {
+      result.AddElement(configuration);
+    }
+    return result;
+  }
+};
+
+//! Construction and destruction of the tree with items allocated one by one on the global heap.
+
+BENCHMARK_DEFINE_F(ItemArenaBenchmark, GlobalHeap)(benchmark::State& state)
+{
+  const auto anyvalue = CreateScaledAnyValue(state.range(0));
+
+  for (auto dummy : state)
+  {
+    auto item = CreateAnyValueItem(anyvalue);
+    item.reset();
+  }
+}
+
+//! Construction and destruction of the tree with items allocated in the arena.
+
+BENCHMARK_DEFINE_F(ItemArenaBenchmark, Arena)(benchmark::State& state)
+{
+  const auto anyvalue = CreateScaledAnyValue(state.range(0));
+
+  for (auto dummy : state)
+  {
+    std::unique_ptr<AnyValueItem> item;
+    {
+      const ItemArenaScope scope;
+      item = CreateAnyValueItem(anyvalue);
+    }
+    item.reset();
+  }
+}
+
+BENCHMARK_REGISTER_F(ItemArenaBenchmark, GlobalHeap)->Arg(1)->Arg(10);
+BENCHMARK_REGISTER_F(ItemArenaBenchmark, Arena)->Arg(1)->Arg(10);
+
+}  // namespace sup::gui::test
@@ -20,9 +20,16 @@
 
 #include <benchmark/benchmark.h>
 
+#include <QApplication>
+
 int main(int argc, char** argv)
 {
   benchmark::Initialize(&argc, argv);
+
+  // necessary for benchmarks rendering widgets and icons
+  QApplication app(argc, argv);
+  Q_UNUSED(app)
+
   benchmark::RunSpecifiedBenchmarks();
   benchmark::Shutdown();
 }
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/scalar_conversion_utils.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+namespace
+{
+
+const std::int64_t kArraySize = 10000;
+
+/**
+ * @brief Returns array of the given size with elements of the given type.
+ */
+sup::dto::AnyValue CreateArray(sup::dto::TypeCode type_code, std::int64_t size)
+{
+  return {static_cast<std::size_t>(size), sup::dto::AnyType(type_code), "array_t"};
+}
+
+}  // namespace
+
+//! Conversion of array elements to variants one by one, as done by visitor callbacks.
+
+template <sup::dto::TypeCode type_code>
+void ElementwiseToVariants(benchmark::State& state)
+{
+  const auto array = CreateArray(type_code, state.range(0));
+  const auto count = array.NumberOfElements();
+
+  for (auto dummy : state)
+  {
+    std::vector<mvvm::variant_t> variants;
+    variants.reserve(count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      variants.push_back(GetVariantFromScalar(array[index]));
+    }
+    benchmark::DoNotOptimize(variants.data());
+  }
+}
+
+//! Conversion of array elements to variants in a single typed loop.
+
+template <sup::dto::TypeCode type_code>
+void BulkToVariants(benchmark::State& state)
+{
+  const auto array = CreateArray(type_code, state.range(0));
+
+  for (auto dummy : state)
+  {
+    auto variants = GetVariantsFromScalarArray(array);
+    benchmark::DoNotOptimize(variants.data());
+  }
+}
+
+//! Conversion of variants to array elements one by one.
+
+template <sup::dto::TypeCode type_code>
+void ElementwiseFromVariants(benchmark::State& state)
+{
+  const auto array = CreateArray(type_code, state.range(0));
+  const auto variants = GetVariantsFromScalarArray(array);
+
+  for (auto dummy : state)
+  {
+    sup::dto::AnyValue result(variants.size(), sup::dto::AnyType(type_code), "array_t");
+    for (std::size_t index = 0; index < variants.size(); ++index)
+    {
+      result[index] = GetAnyValueFromScalar(variants[index]);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+//! Conversion of variants to array elements in a single typed loop.
+
+template <sup::dto::TypeCode type_code>
+void BulkFromVariants(benchmark::State& state)
+{
+  const auto array = CreateArray(type_code, state.range(0));
+  const auto variants = GetVariantsFromScalarArray(array);
+
+  for (auto dummy : state)
+  {
+    auto result = GetScalarArrayFromVariants(variants, "array_t");
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+//! Creation of array item from AnyValue.
+
+template <sup::dto::TypeCode type_code>
+void CreateArrayItem(benchmark::State& state)
+{
+  const auto array = CreateArray(type_code, state.range(0));
+
+  for (auto dummy : state)
+  {
+    auto item = CreateAnyValueItem(array);
+  }
+}
+
+//! Creation of AnyValue from array item.
+
+template <sup::dto::TypeCode type_code>
+void ExportArrayItem(benchmark::State& state)
+{
+  const auto item = CreateAnyValueItem(CreateArray(type_code, state.range(0)));
+
+  for (auto dummy : state)
+  {
+    auto anyvalue = CreateAnyValue(*item);
+  }
+}
+
+using sup::dto::TypeCode;
+
+#define REGISTER_FOR_NUMERIC_TYPE_CODES(func)                                                  \
+  BENCHMARK_TEMPLATE(func, TypeCode::Bool)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);    \
+  BENCHMARK_TEMPLATE(func, TypeCode::Char8)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);   \
+  BENCHMARK_TEMPLATE(func, TypeCode::Int8)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);    \
+  BENCHMARK_TEMPLATE(func, TypeCode::UInt8)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);   \
+  BENCHMARK_TEMPLATE(func, TypeCode::Int16)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);   \
+  BENCHMARK_TEMPLATE(func, TypeCode::UInt16)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);  \
+  BENCHMARK_TEMPLATE(func, TypeCode::Int32)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);   \
+  BENCHMARK_TEMPLATE(func, TypeCode::UInt32)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);  \
+  BENCHMARK_TEMPLATE(func, TypeCode::Int64)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);   \
+  BENCHMARK_TEMPLATE(func, TypeCode::UInt64)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);  \
+  BENCHMARK_TEMPLATE(func, TypeCode::Float32)->Arg(kArraySize)->Unit(benchmark::kMicrosecond); \
+  BENCHMARK_TEMPLATE(func, TypeCode::Float64)->Arg(kArraySize)->Unit(benchmark::kMicrosecond);
+
+REGISTER_FOR_NUMERIC_TYPE_CODES(ElementwiseToVariants)
+REGISTER_FOR_NUMERIC_TYPE_CODES(BulkToVariants)
+REGISTER_FOR_NUMERIC_TYPE_CODES(ElementwiseFromVariants)
+REGISTER_FOR_NUMERIC_TYPE_CODES(BulkFromVariants)
+REGISTER_FOR_NUMERIC_TYPE_CODES(CreateArrayItem)
+REGISTER_FOR_NUMERIC_TYPE_CODES(ExportArrayItem)
+
+}  // namespace sup::gui::test
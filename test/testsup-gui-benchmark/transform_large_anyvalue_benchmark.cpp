@@ -18,19 +18,25 @@
  * of the distribution package.
  *****************************************************************************/
 
+#include <sup/gui/core/json_validator.h>
 #include <sup/gui/model/anyvalue_conversion_utils.h>
 #include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_item_utils.h>
 #include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/viewmodel/anyvalue_viewmodel.h>
 
 #include <mvvm/model/application_model.h>
 #include <mvvm/test/test_helper.h>
 #include <mvvm/viewmodel/all_items_viewmodel.h>
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 
 #include <benchmark/benchmark.h>
 #include <testutils/cmake_info.h>
 
+#include <functional>
+
 namespace sup::gui::test
 {
 
@@ -48,6 +54,20 @@ public:
   {
     return ProjectResourceDir() + "/anyvalue-editor/cis-configuration.json";
   }
+
+  /**
+   * @brief Returns AnyValue with the array of float64 containing million elements.
+   */
+  static sup::dto::AnyValue CreateLargeFloatArray()
+  {
+    const std::size_t size{1000000};
+    sup::dto::AnyValue result(size, sup::dto::Float64Type);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+      result[index] = static_cast<double>(index) * 0.5;
+    }
+    return result;
+  }
 };
 
 BENCHMARK_F(TransformLargeAnyValueBenchmark, AnyValueFromJSONString)(benchmark::State& state)
@@ -60,6 +80,18 @@ BENCHMARK_F(TransformLargeAnyValueBenchmark, AnyValueFromJSONString)(benchmark::
   }
 }
 
+//! Syntax check of the same content, as done before the import.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, ValidateJSONString)(benchmark::State& state)
+{
+  const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(ValidateJSONString(json_content));
+  }
+}
+
 BENCHMARK_F(TransformLargeAnyValueBenchmark, CreateAnyValueItem)(benchmark::State& state)
 {
   const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
@@ -99,6 +131,21 @@ BENCHMARK_F(TransformLargeAnyValueBenchmark,
   }
 }
 
+BENCHMARK_F(TransformLargeAnyValueBenchmark,
+            InsertAnyValueItemWhenAnyValueViewModel)(benchmark::State& state)
+{
+  const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
+  const auto anyvalue = AnyValueFromJSONString(json_content);
+
+  for (auto dummy : state)
+  {
+    mvvm::ApplicationModel model;
+    AnyValueViewModel viewmodel(&model);
+    auto item = CreateAnyValueItem(anyvalue);
+    model.InsertItem(std::move(item), model.GetRootItem(), mvvm::TagIndex::Append());
+  }
+}
+
 BENCHMARK_F(TransformLargeAnyValueBenchmark, ExportItemToAnyValue)(benchmark::State& state)
 {
   const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
@@ -122,4 +169,102 @@ BENCHMARK_F(TransformLargeAnyValueBenchmark, AnyValueToJSONString)(benchmark::St
   }
 }
 
+//! Updating the data of one large tree from another with the same layout, when scalar types are
+//! compared for every leaf.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, UpdateAnyValueItemData)(benchmark::State& state)
+{
+  const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
+  const auto anyvalue = AnyValueFromJSONString(json_content);
+  const auto source = CreateAnyValueItem(anyvalue);
+  auto target = CreateAnyValueItem(anyvalue);
+
+  for (auto dummy : state)
+  {
+    UpdateAnyValueItemData(*source, *target);
+  }
+}
+
+//! Recursive traversal of the large tree collecting children in a vector at each level.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, TraverseWithGetChildren)(benchmark::State& state)
+{
+  const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
+  const auto item = CreateAnyValueItem(AnyValueFromJSONString(json_content));
+
+  std::function<int(const AnyValueItem&)> count_leaves = [&count_leaves](const auto& parent)
+  {
+    int result = parent.IsScalar() ? 1 : 0;
+    for (auto child : parent.GetChildren())
+    {
+      result += count_leaves(*child);
+    }
+    return result;
+  };
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(count_leaves(*item));
+  }
+}
+
+//! Recursive traversal of the large tree using non-allocating view on children.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, TraverseWithGetChildRange)(benchmark::State& state)
+{
+  const std::string json_content = mvvm::test::GetTextFileContent(GetTestJsonString());
+  const auto item = CreateAnyValueItem(AnyValueFromJSONString(json_content));
+
+  std::function<int(const AnyValueItem&)> count_leaves = [&count_leaves](const auto& parent)
+  {
+    int result = parent.IsScalar() ? 1 : 0;
+    for (auto child : parent.GetChildRange())
+    {
+      result += count_leaves(*child);
+    }
+    return result;
+  };
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(count_leaves(*item));
+  }
+}
+
+//! Conversion of the array with million elements to the item with element per scalar item.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, CreateRegularArrayItem)(benchmark::State& state)
+{
+  const auto anyvalue = CreateLargeFloatArray();
+
+  for (auto dummy : state)
+  {
+    auto item = CreateAnyValueItem(anyvalue);
+  }
+}
+
+//! Conversion of the array with million elements to the item with packed elements.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, CreatePackedArrayItem)(benchmark::State& state)
+{
+  const auto anyvalue = CreateLargeFloatArray();
+
+  for (auto dummy : state)
+  {
+    auto item = CreatePackedAnyValueItem(anyvalue);
+  }
+}
+
+//! Conversion of the item with packed million elements back to AnyValue.
+
+BENCHMARK_F(TransformLargeAnyValueBenchmark, ExportPackedArrayItem)(benchmark::State& state)
+{
+  const auto item = CreatePackedAnyValueItem(CreateLargeFloatArray());
+
+  for (auto dummy : state)
+  {
+    auto anyvalue = CreateAnyValue(*item);
+  }
+}
+
 }  // namespace sup::gui::test
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_envelope.h>
+#include <sup/gui/plotting/waveform_envelope_cache.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of waveform overview creation from the envelope, and by a direct
+ * pass over points.
+ */
+class WaveformEnvelopeBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformEnvelopeBenchmark() { Unit(benchmark::kMicrosecond); }
+
+  //! Number of bins in the overview, the width of a typical chart in pixels.
+  static constexpr std::size_t kBinCount = 1000;
+
+  /**
+   * @brief Populates the model with a data item of the given number of points.
+   */
+  static mvvm::LineSeriesDataItem* CreateDataItem(mvvm::ApplicationModel& model,
+                                                  std::int64_t point_count)
+  {
+    auto data_item = model.InsertItem<mvvm::LineSeriesDataItem>();
+    data_item->SetWaveform(GetWaveformPoints(
+        GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(point_count), 1.0, 1.0)));
+    return data_item;
+  }
+};
+
+//! Overview created by a pass over all points, as it is needed without the envelope.
+
+BENCHMARK_DEFINE_F(WaveformEnvelopeBenchmark, OverviewDirect)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    const auto points = data_item->GetWaveform();
+    std::vector<std::pair<double, double>> bins;
+    bins.reserve(kBinCount);
+    for (std::size_t bin = 0; bin < kBinCount; ++bin)
+    {
+      const auto begin = points.begin() + bin * points.size() / kBinCount;
+      const auto end = points.begin() + (bin + 1) * points.size() / kBinCount;
+      const auto [min_iter, max_iter] = std::minmax_element(
+          begin, end, [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+      bins.emplace_back(min_iter->second, max_iter->second);
+    }
+    benchmark::DoNotOptimize(bins);
+  }
+}
+
+//! Overview created from the cached envelope.
+
+BENCHMARK_DEFINE_F(WaveformEnvelopeBenchmark, OverviewCached)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+  WaveformEnvelopeCache cache(&model);
+  (void)cache.GetEnvelope(*data_item);
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(cache.GetEnvelope(*data_item).CreateOverview(kBinCount));
+  }
+}
+
+//! Change of a single point followed by a new overview, the envelope is updated in place.
+
+BENCHMARK_DEFINE_F(WaveformEnvelopeBenchmark, PointChangedCached)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+  WaveformEnvelopeCache cache(&model);
+  (void)cache.GetEnvelope(*data_item);
+
+  auto point = data_item->GetPoint(static_cast<int>(state.range(0) / 2));
+  double value{0.0};
+  for (auto dummy : state)
+  {
+    point->SetY(value);
+    value += 1.0;
+    benchmark::DoNotOptimize(cache.GetEnvelope(*data_item).CreateOverview(kBinCount));
+  }
+}
+
+//! Change of y values of all points followed by a single overview, as after a transform.
+
+BENCHMARK_DEFINE_F(WaveformEnvelopeBenchmark, BulkChangeCached)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+  WaveformEnvelopeCache cache(&model);
+  (void)cache.GetEnvelope(*data_item);
+
+  double value{0.0};
+  for (auto dummy : state)
+  {
+    for (int index = 0; index < data_item->GetPointCount(); ++index)
+    {
+      data_item->GetPoint(index)->SetY(value);
+    }
+    value += 1.0;
+    benchmark::DoNotOptimize(cache.GetEnvelope(*data_item).CreateOverview(kBinCount));
+  }
+}
+
+//! Creation of the envelope from y values.
+
+BENCHMARK_DEFINE_F(WaveformEnvelopeBenchmark, CreateEnvelope)(benchmark::State& state)
+{
+  const auto waveform =
+      GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(state.range(0)), 1.0, 1.0);
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(WaveformEnvelope(waveform.y));
+  }
+}
+
+BENCHMARK_REGISTER_F(WaveformEnvelopeBenchmark, OverviewDirect)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformEnvelopeBenchmark, OverviewCached)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformEnvelopeBenchmark, PointChangedCached)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformEnvelopeBenchmark, BulkChangeCached)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformEnvelopeBenchmark, CreateEnvelope)->Arg(100000)->Arg(1000000);
+
+}  // namespace sup::gui::test
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_file_utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+namespace sup::gui::test
+{
+
+namespace
+{
+
+/**
+ * @brief The size of chunks, as read by ImportWaveformTask.
+ */
+const std::size_t kChunkSize = 4 * 1024 * 1024;
+
+WaveformBuffer CreateWaveform(std::int64_t count)
+{
+  return GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(count), 1.0, 1.0);
+}
+
+std::string CreateFileContent(std::int64_t count, WaveformFileFormat format)
+{
+  const auto waveform = CreateWaveform(count);
+  WaveformFileOptions options;
+  options.format = format;
+  std::string result;
+  AppendWaveformToFileContent(waveform, 0, waveform.GetSize(), options, result);
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Testing throughput of waveform file parsing and formatting.
+ *
+ * Parsing is expected to run at least at 100 MB/s for CSV, and close to memory bandwidth for
+ * binary files, so import of a measured profile is limited by the disk.
+ */
+class WaveformFileBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformFileBenchmark() { Unit(benchmark::kMillisecond); }
+};
+
+//! Parsing of CSV with string streams, as a reference.
+
+BENCHMARK_DEFINE_F(WaveformFileBenchmark, ParseCsvStream)(benchmark::State& state)
+{
+  const auto content = CreateFileContent(state.range(0), WaveformFileFormat::kCsv);
+
+  for (auto dummy : state)
+  {
+    WaveformBuffer buffer;
+    std::istringstream input(content);
+    double x{0.0};
+    double y{0.0};
+    char delimiter{0};
+    while (input >> x >> delimiter >> y)
+    {
+      buffer.x.push_back(x);
+      buffer.y.push_back(y);
+    }
+    benchmark::DoNotOptimize(buffer.y.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(content.size()));
+}
+
+//! Parsing of CSV by chunks, as done by ImportWaveformTask.
+
+BENCHMARK_DEFINE_F(WaveformFileBenchmark, ParseCsv)(benchmark::State& state)
+{
+  const auto content = CreateFileContent(state.range(0), WaveformFileFormat::kCsv);
+
+  for (auto dummy : state)
+  {
+    WaveformCsvParser parser;
+    for (std::size_t pos = 0; pos < content.size(); pos += kChunkSize)
+    {
+      (void)parser.Feed(content.data() + pos, std::min(kChunkSize, content.size() - pos));
+    }
+    (void)parser.Finish();
+    auto buffer = parser.TakeBuffer();
+    benchmark::DoNotOptimize(buffer.y.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(content.size()));
+}
+
+BENCHMARK_DEFINE_F(WaveformFileBenchmark, ParseBinary)(benchmark::State& state)
+{
+  const auto content = CreateFileContent(state.range(0), WaveformFileFormat::kBinary);
+
+  for (auto dummy : state)
+  {
+    WaveformBinaryParser parser;
+    parser.Reserve(content.size());
+    for (std::size_t pos = 0; pos < content.size(); pos += kChunkSize)
+    {
+      parser.Feed(content.data() + pos, std::min(kChunkSize, content.size() - pos));
+    }
+    (void)parser.Finish();
+    auto buffer = parser.TakeBuffer();
+    benchmark::DoNotOptimize(buffer.y.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(content.size()));
+}
+
+BENCHMARK_DEFINE_F(WaveformFileBenchmark, FormatCsv)(benchmark::State& state)
+{
+  const auto waveform = CreateWaveform(state.range(0));
+  std::size_t content_size{0};
+
+  for (auto dummy : state)
+  {
+    std::string content;
+    AppendWaveformToFileContent(waveform, 0, waveform.GetSize(), {}, content);
+    content_size = content.size();
+    benchmark::DoNotOptimize(content.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(content_size));
+}
+
+BENCHMARK_REGISTER_F(WaveformFileBenchmark, ParseCsvStream)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformFileBenchmark, ParseCsv)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformFileBenchmark, ParseBinary)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformFileBenchmark, FormatCsv)->Arg(1000000);
+
+}  // namespace sup::gui::test
@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_editor_action_handler.h>
+#include <sup/gui/plotting/waveform_editor_context.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/chart_viewport_item.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/line_series_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of point lookup by x in sorted and unsorted modes of the waveform
+ * editor.
+ */
+class WaveformPointLookupBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformPointLookupBenchmark() { Unit(benchmark::kMicrosecond); }
+
+  /**
+   * @brief Populates the model with a waveform of the given number of points and returns the
+   * handler to edit it.
+   */
+  static std::unique_ptr<WaveformEditorActionHandler> CreateActionHandler(
+      mvvm::ApplicationModel& model, std::int64_t point_count)
+  {
+    auto data_item = model.InsertItem<mvvm::LineSeriesDataItem>();
+    auto viewport_item = model.InsertItem<mvvm::ChartViewportItem>();
+    auto line_series_item = model.InsertItem<mvvm::LineSeriesItem>(viewport_item);
+    line_series_item->SetDataItem(data_item);
+    data_item->SetWaveform(GetWaveformPoints(
+        GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(point_count), 1.0, 1.0)));
+
+    WaveformEditorContext context;
+    context.selected_waveform_callback = [line_series_item]() { return line_series_item; };
+    context.selected_point_callback = []() -> mvvm::PointItem* { return nullptr; };
+    return std::make_unique<WaveformEditorActionHandler>(context);
+  }
+};
+
+//! Lookup of the point nearest to cursor by scanning all points.
+
+BENCHMARK_DEFINE_F(WaveformPointLookupBenchmark, NearestUnsorted)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto handler = CreateActionHandler(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(handler->FindNearestPoint(0.5e-3 * state.range(0)));
+  }
+}
+
+//! Lookup of the point nearest to cursor by binary search.
+
+BENCHMARK_DEFINE_F(WaveformPointLookupBenchmark, NearestSorted)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto handler = CreateActionHandler(model, state.range(0));
+  handler->SetSortedMode(true);
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(handler->FindNearestPoint(0.5e-3 * state.range(0)));
+  }
+}
+
+//! Lookup of the points in a narrow x interval by binary search.
+
+BENCHMARK_DEFINE_F(WaveformPointLookupBenchmark, RangeSorted)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto handler = CreateActionHandler(model, state.range(0));
+  handler->SetSortedMode(true);
+  const double x_min = 0.5e-3 * state.range(0);
+
+  for (auto dummy : state)
+  {
+    auto points = handler->FindPointsInRange(x_min, x_min + 0.1);
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+
+BENCHMARK_REGISTER_F(WaveformPointLookupBenchmark, NearestUnsorted)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformPointLookupBenchmark, NearestSorted)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformPointLookupBenchmark, RangeSorted)->Arg(10000)->Arg(100000);
+
+}  // namespace sup::gui::test
@@ -0,0 +1,105 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_resampling.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+#include <sup/gui/tasks/thread_pool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of resampling of many waveforms on a common time base.
+ */
+class WaveformResamplingBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformResamplingBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Returns the given number of sine waves, x values of every fourth waveform are the same,
+   * so merged time base is four times larger than each of them.
+   */
+  static std::vector<WaveformBuffer> CreateWaveforms(std::int64_t count)
+  {
+    const std::size_t point_count = 10000;
+    std::vector<WaveformBuffer> result;
+    for (std::int64_t index = 0; index < count; ++index)
+    {
+      result.push_back(GenerateSine(static_cast<double>(index % 4) * 1.0e-4, 1.0e-3, point_count, 1.0,
+                                    1.0 + static_cast<double>(index)));
+    }
+    return result;
+  }
+};
+
+//! Creation of a time base from x values of all waveforms.
+
+BENCHMARK_DEFINE_F(WaveformResamplingBenchmark, MergedTimeBase)(benchmark::State& state)
+{
+  const auto waveforms = CreateWaveforms(state.range(0));
+
+  for (auto dummy : state)
+  {
+    auto time_base = CreateMergedTimeBase(waveforms);
+    benchmark::DoNotOptimize(time_base.data());
+  }
+}
+
+//! Resampling of all waveforms in the calling thread.
+
+BENCHMARK_DEFINE_F(WaveformResamplingBenchmark, ResampleSequential)(benchmark::State& state)
+{
+  const auto waveforms = CreateWaveforms(state.range(0));
+  const auto time_base = CreateMergedTimeBase(waveforms);
+
+  for (auto dummy : state)
+  {
+    auto values = ResampleWaveformsOnTimeBase(waveforms, time_base, InterpolationMode::kLinear);
+    benchmark::DoNotOptimize(values.data());
+  }
+}
+
+//! Resampling of all waveforms in the thread pool.
+
+BENCHMARK_DEFINE_F(WaveformResamplingBenchmark, ResampleParallel)(benchmark::State& state)
+{
+  const auto waveforms = CreateWaveforms(state.range(0));
+  const auto time_base = CreateMergedTimeBase(waveforms);
+  ThreadPool thread_pool;
+
+  for (auto dummy : state)
+  {
+    auto values = ResampleWaveformsOnTimeBase(waveforms, time_base, InterpolationMode::kLinear,
+                                              &thread_pool);
+    benchmark::DoNotOptimize(values.data());
+  }
+}
+
+BENCHMARK_REGISTER_F(WaveformResamplingBenchmark, MergedTimeBase)->Arg(200);
+BENCHMARK_REGISTER_F(WaveformResamplingBenchmark, ResampleSequential)->Arg(20)->Arg(200);
+BENCHMARK_REGISTER_F(WaveformResamplingBenchmark, ResampleParallel)->Arg(20)->Arg(200);
+
+}  // namespace sup::gui::test
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_table_model.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+#include <sup/gui/plotting/waveform_twocolumn_viewmodel.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QTransposeProxyModel>
+#include <cstdint>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of opening a waveform in a table.
+ */
+class WaveformTableBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformTableBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Inserts data item with the given number of points into the model.
+   */
+  static mvvm::LineSeriesDataItem* CreateDataItem(mvvm::ApplicationModel& model,
+                                                  std::int64_t point_count)
+  {
+    auto result = model.InsertItem<mvvm::LineSeriesDataItem>();
+    result->SetWaveform(GetWaveformPoints(
+        GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(point_count), 1.0, 1.0)));
+    return result;
+  }
+};
+
+//! Opening the waveform with the viewmodel, which creates view items for every point.
+
+BENCHMARK_DEFINE_F(WaveformTableBenchmark, OpenViewModel)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    WaveformTwoColumnViewModel viewmodel(&model);
+    QTransposeProxyModel proxy;
+    proxy.setSourceModel(&viewmodel);
+    viewmodel.SetRootSessionItem(data_item);
+    benchmark::DoNotOptimize(proxy.columnCount());
+  }
+}
+
+//! Opening the waveform with the table model, which reads values on demand.
+
+BENCHMARK_DEFINE_F(WaveformTableBenchmark, OpenTableModel)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = CreateDataItem(model, state.range(0));
+
+  for (auto dummy : state)
+  {
+    WaveformTableModel table_model;
+    QTransposeProxyModel proxy;
+    proxy.setSourceModel(&table_model);
+    table_model.SetDataItem(data_item);
+    benchmark::DoNotOptimize(proxy.columnCount());
+  }
+}
+
+BENCHMARK_REGISTER_F(WaveformTableBenchmark, OpenViewModel)->Arg(10000)->Arg(100000);
+BENCHMARK_REGISTER_F(WaveformTableBenchmark, OpenTableModel)->Arg(10000)->Arg(100000);
+
+}  // namespace sup::gui::test
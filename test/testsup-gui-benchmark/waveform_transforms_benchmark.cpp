@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/gui/plotting/waveform_editor_action_handler.h>
+#include <sup/gui/plotting/waveform_editor_context.h>
+#include <sup/gui/plotting/waveform_transforms.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/chart_viewport_item.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/line_series_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing performance of bulk waveform transforms.
+ */
+class WaveformTransformsBenchmark : public benchmark::Fixture
+{
+public:
+  WaveformTransformsBenchmark() { Unit(benchmark::kMillisecond); }
+
+  /**
+   * @brief Returns sine wave with the given number of points.
+   */
+  static WaveformBuffer CreateWaveform(std::int64_t count)
+  {
+    return GenerateSine(0.0, 1.0e-3, static_cast<std::size_t>(count), 1.0, 1.0);
+  }
+};
+
+//! Scaling of y values, as it would be done point by point over pairs.
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, ScalePairs)(benchmark::State& state)
+{
+  auto points = GetWaveformPoints(CreateWaveform(state.range(0)));
+
+  for (auto dummy : state)
+  {
+    for (auto& point : points)
+    {
+      point.second *= 1.001;
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+
+//! Scaling of y values stored in contiguous buffer.
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, ScaleBuffer)(benchmark::State& state)
+{
+  auto buffer = CreateWaveform(state.range(0));
+  const auto transform = CreateScaleTransform(1.001);
+
+  for (auto dummy : state)
+  {
+    transform(buffer, 0, buffer.GetSize());
+    benchmark::DoNotOptimize(buffer.y.data());
+  }
+}
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, Smooth)(benchmark::State& state)
+{
+  auto buffer = CreateWaveform(state.range(0));
+  const auto transform = CreateSmoothTransform(11);
+
+  for (auto dummy : state)
+  {
+    transform(buffer, 0, buffer.GetSize());
+    benchmark::DoNotOptimize(buffer.y.data());
+  }
+}
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, Resample)(benchmark::State& state)
+{
+  const auto buffer = CreateWaveform(state.range(0));
+
+  for (auto dummy : state)
+  {
+    auto result = ResampleWaveform(buffer, 0.7e-3);
+    benchmark::DoNotOptimize(result.y.data());
+  }
+}
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, GenerateSine)(benchmark::State& state)
+{
+  for (auto dummy : state)
+  {
+    auto result = CreateWaveform(state.range(0));
+    benchmark::DoNotOptimize(result.y.data());
+  }
+}
+
+//! Scaling of the waveform stored in the model with undo enabled, as done by the editor.
+
+BENCHMARK_DEFINE_F(WaveformTransformsBenchmark, ApplyToModel)(benchmark::State& state)
+{
+  mvvm::ApplicationModel model;
+  auto data_item = model.InsertItem<mvvm::LineSeriesDataItem>();
+  auto viewport_item = model.InsertItem<mvvm::ChartViewportItem>();
+  auto line_series_item = model.InsertItem<mvvm::LineSeriesItem>(viewport_item);
+  line_series_item->SetDataItem(data_item);
+  data_item->SetWaveform(GetWaveformPoints(CreateWaveform(state.range(0))));
+  model.SetUndoEnabled(true);
+
+  WaveformEditorContext context;
+  context.selected_waveform_callback = [line_series_item]() { return line_series_item; };
+  context.selected_point_callback = []() -> mvvm::PointItem* { return nullptr; };
+  WaveformEditorActionHandler handler(context);
+  const auto transform = CreateScaleTransform(1.001);
+
+  for (auto dummy : state)
+  {
+    handler.ApplyTransform(transform, "Scale");
+  }
+}
+
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, ScalePairs)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, ScaleBuffer)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, Smooth)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, Resample)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, GenerateSine)->Arg(1000000);
+BENCHMARK_REGISTER_F(WaveformTransformsBenchmark, ApplyToModel)->Arg(1000)->Arg(10000);
+
+}  // namespace sup::gui::test
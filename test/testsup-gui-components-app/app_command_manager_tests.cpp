@@ -115,4 +115,42 @@ TEST_F(AppCommandManagerTest, SetContextStack)
   EXPECT_EQ(command1->GetProxyAction()->GetAction(), &paste_action1);
 }
 
+//! Only commands with changed actions should be updated.
+TEST_F(AppCommandManagerTest, SetContextStackDiff)
+{
+  QAction copy_action("Copy");
+  QAction paste_action1("Paste");
+  QAction paste_action2("Paste");
+
+  const AppContext context1("Editor1");
+  const AppContext context2("Editor2");
+  const AppContext parent_context("Parent");
+
+  AppCommandManager manager;
+  auto copy_command = manager.RegisterAction(&copy_action, "Editor.Copy", parent_context);
+  auto paste_command = manager.RegisterAction(&paste_action1, "Editor.Paste", context1);
+  (void)manager.RegisterAction(&paste_action2, "Editor.Paste", context2);
+
+  EXPECT_EQ(manager.SetContextStack({context1, parent_context}), 2);
+  EXPECT_EQ(copy_command->GetProxyAction()->GetAction(), &copy_action);
+  EXPECT_EQ(paste_command->GetProxyAction()->GetAction(), &paste_action1);
+
+  // same stack, nothing to do
+  EXPECT_EQ(manager.SetContextStack({context1, parent_context}), 0);
+
+  // only paste command is rebound
+  EXPECT_EQ(manager.SetContextStack({context2, parent_context}), 1);
+  EXPECT_EQ(copy_command->GetProxyAction()->GetAction(), &copy_action);
+  EXPECT_EQ(paste_command->GetProxyAction()->GetAction(), &paste_action2);
+
+  // registration of a new action for the current context should be taken into account
+  QAction cut_action("Cut");
+  auto cut_command = manager.RegisterAction(&cut_action, "Editor.Cut", context2);
+  EXPECT_EQ(manager.SetContextStack({context2, parent_context}), 1);
+  EXPECT_EQ(cut_command->GetProxyAction()->GetAction(), &cut_action);
+
+  EXPECT_EQ(manager.SetContextStack({}), 3);
+  EXPECT_EQ(copy_command->GetProxyAction()->GetAction(), nullptr);
+}
+
 }  // namespace sup::gui::test
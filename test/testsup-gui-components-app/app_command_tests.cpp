@@ -155,4 +155,32 @@ TEST_F(AppCommandTest, SetEmptyContextStack)
   EXPECT_EQ(command.GetProxyAction()->GetAction(), nullptr);
 }
 
+//! Setting context stacks leading to the same action shouldn't touch the proxy action.
+TEST_F(AppCommandTest, SetSameContextStack)
+{
+  const QString expected_text("Default Text");
+  AppCommand command(expected_text);
+
+  QAction real_action("paste-from-widget");
+  const AppContext context("Editor.Paste");
+  command.AddOverrideAction(context, &real_action);
+
+  const AppContext parent_context("Parent");
+  const AppContext another_context("Another");
+
+  // initially proxy is not bound, stack without matching action doesn't change anything
+  EXPECT_FALSE(command.SetContextStack({another_context}));
+
+  EXPECT_TRUE(command.SetContextStack({context, parent_context}));
+  EXPECT_EQ(command.GetProxyAction()->GetAction(), &real_action);
+
+  // another stack leading to the same action
+  EXPECT_FALSE(command.SetContextStack({parent_context, context}));
+  EXPECT_EQ(command.GetProxyAction()->GetAction(), &real_action);
+
+  EXPECT_TRUE(command.SetContextStack({another_context}));
+  EXPECT_EQ(command.GetProxyAction()->GetAction(), nullptr);
+  EXPECT_EQ(command.GetProxyAction()->text(), expected_text);
+}
+
 }  // namespace sup::gui::test
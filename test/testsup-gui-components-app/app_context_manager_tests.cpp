@@ -68,4 +68,41 @@ TEST_F(AppContextManagerTest, RegisterContext)
   EXPECT_EQ(manager.GetNumberOfRegistrations(), 0);
 }
 
+//! Context stack of a widget hierarchy.
+TEST_F(AppContextManagerTest, GetContextStack)
+{
+  AppContextManager manager;
+  EXPECT_TRUE(manager.GetContextStack(nullptr).empty());
+
+  QWidget parent;
+  auto child = new QWidget(&parent);
+  auto grandchild = new QWidget(child);
+
+  EXPECT_TRUE(manager.GetContextStack(grandchild).empty());
+
+  // registration should invalidate cached stacks
+  auto parent_context = manager.RegisterWidgetUniqueId(&parent);
+  EXPECT_EQ(manager.GetContextStack(grandchild), std::vector<AppContext>({parent_context}));
+
+  auto grandchild_context = manager.RegisterWidgetUniqueId(grandchild);
+  const std::vector<AppContext> expected_stack({grandchild_context, parent_context});
+  EXPECT_EQ(manager.GetContextStack(grandchild), expected_stack);
+
+  // second call served from the cache
+  EXPECT_EQ(manager.GetContextStack(grandchild), expected_stack);
+
+  // changing the parent of the widget should be noticed
+  QWidget another_parent;
+  auto another_parent_context = manager.RegisterWidgetUniqueId(&another_parent);
+  EXPECT_EQ(manager.GetContextStack(grandchild), expected_stack);
+  grandchild->setParent(&another_parent);
+  EXPECT_EQ(manager.GetContextStack(grandchild),
+            std::vector<AppContext>({grandchild_context, another_parent_context}));
+
+  // unregistration should invalidate cached stacks
+  manager.UnregisterWidgetUniqueId(grandchild);
+  EXPECT_EQ(manager.GetContextStack(grandchild),
+            std::vector<AppContext>({another_parent_context}));
+}
+
 }  // namespace sup::gui::test
@@ -0,0 +1,169 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/style/colored_icon_cache.h"
+
+#include <sup/gui/style/colored_icon_engine.h>
+#include <sup/gui/style/style_helper.h>
+
+#include <gtest/gtest.h>
+
+#include <QApplication>
+#include <QPalette>
+
+namespace sup::gui::test
+{
+
+//! Testing ColoredIconCache class.
+
+class ColoredIconCacheTest : public ::testing::Test
+{
+public:
+  ColoredIconCacheTest() { ColoredIconCache::Instance().Clear(); }
+  ~ColoredIconCacheTest() override { ColoredIconCache::Instance().Clear(); }
+
+  static QString GetIconResourceName() { return ":/sup-gui-core/icons/menu.svg"; }
+};
+
+TEST_F(ColoredIconCacheTest, CreatePixmapKey)
+{
+  const QSize size(16, 16);
+  const QColor color(Qt::red);
+
+  const auto key =
+      ColoredIconCache::CreatePixmapKey("a", size, 1.0, QIcon::Normal, QIcon::On, color);
+  EXPECT_EQ(key,
+            ColoredIconCache::CreatePixmapKey("a", size, 1.0, QIcon::Normal, QIcon::On, color));
+
+  // every parameter should participate in the key
+  EXPECT_NE(key,
+            ColoredIconCache::CreatePixmapKey("b", size, 1.0, QIcon::Normal, QIcon::On, color));
+  EXPECT_NE(key, ColoredIconCache::CreatePixmapKey("a", QSize(16, 32), 1.0, QIcon::Normal,
+                                                   QIcon::On, color));
+  EXPECT_NE(key,
+            ColoredIconCache::CreatePixmapKey("a", size, 2.0, QIcon::Normal, QIcon::On, color));
+  EXPECT_NE(key,
+            ColoredIconCache::CreatePixmapKey("a", size, 1.0, QIcon::Active, QIcon::On, color));
+  EXPECT_NE(key,
+            ColoredIconCache::CreatePixmapKey("a", size, 1.0, QIcon::Normal, QIcon::Off, color));
+  EXPECT_NE(key, ColoredIconCache::CreatePixmapKey("a", size, 1.0, QIcon::Normal, QIcon::On,
+                                                   QColor(Qt::blue)));
+}
+
+TEST_F(ColoredIconCacheTest, InsertAndClear)
+{
+  auto& cache = ColoredIconCache::Instance();
+  EXPECT_EQ(cache.GetPixmapCount(), 0);
+  EXPECT_EQ(cache.GetIconCount(), 0);
+
+  QPixmap pixmap(QSize(8, 8));
+  cache.InsertPixmap("key", pixmap);
+  cache.InsertIcon("key", QIcon(pixmap));
+  EXPECT_EQ(cache.GetPixmapCount(), 1);
+  EXPECT_EQ(cache.GetIconCount(), 1);
+
+  QPixmap found_pixmap;
+  EXPECT_TRUE(cache.FindPixmap("key", found_pixmap));
+  EXPECT_EQ(found_pixmap.size(), QSize(8, 8));
+  EXPECT_FALSE(cache.FindPixmap("other", found_pixmap));
+  EXPECT_FALSE(cache.FindIcon("key").isNull());
+  EXPECT_TRUE(cache.FindIcon("other").isNull());
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetPixmapCount(), 0);
+  EXPECT_EQ(cache.GetIconCount(), 0);
+}
+
+//! Engine should render pixmap only once for the same size, mode and state.
+
+TEST_F(ColoredIconCacheTest, EnginePixmap)
+{
+  auto& cache = ColoredIconCache::Instance();
+
+  ColoredIconEngine engine(QIcon(GetIconResourceName()), QColor(Qt::red));
+  engine.SetIconPath(GetIconResourceName());
+  EXPECT_EQ(engine.GetIconPath(), GetIconResourceName());
+
+  const auto pixmap1 = engine.pixmap(QSize(16, 16), QIcon::Normal, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 1);
+
+  const auto pixmap2 = engine.pixmap(QSize(16, 16), QIcon::Normal, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 1);
+  EXPECT_EQ(pixmap1.cacheKey(), pixmap2.cacheKey());
+
+  // different size and mode produce new pixmaps
+  (void)engine.pixmap(QSize(32, 32), QIcon::Normal, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 2);
+  (void)engine.pixmap(QSize(32, 32), QIcon::Disabled, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 3);
+
+  // engine of the same icon and color shares the cache
+  ColoredIconEngine other_engine(QIcon(GetIconResourceName()), QColor(Qt::red));
+  other_engine.SetIconPath(GetIconResourceName());
+  (void)other_engine.pixmap(QSize(16, 16), QIcon::Normal, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 3);
+
+  // engine with another color renders its own pixmap
+  ColoredIconEngine blue_engine(QIcon(GetIconResourceName()), QColor(Qt::blue));
+  blue_engine.SetIconPath(GetIconResourceName());
+  (void)blue_engine.pixmap(QSize(16, 16), QIcon::Normal, QIcon::On);
+  EXPECT_EQ(cache.GetPixmapCount(), 4);
+}
+
+//! Icons returned by GetIcon should be shared.
+
+TEST_F(ColoredIconCacheTest, GetIcon)
+{
+  auto& cache = ColoredIconCache::Instance();
+
+  const auto icon1 = utils::GetIcon(GetIconResourceName(), IconColorFlavor::kForDarkThemes);
+  EXPECT_EQ(cache.GetIconCount(), 1);
+
+  const auto icon2 = utils::GetIcon(GetIconResourceName(), IconColorFlavor::kForDarkThemes);
+  EXPECT_EQ(cache.GetIconCount(), 1);
+  EXPECT_EQ(icon1.cacheKey(), icon2.cacheKey());
+
+  const auto icon3 = utils::GetIcon(GetIconResourceName(), IconColorFlavor::kForLightThemes);
+  EXPECT_EQ(cache.GetIconCount(), 2);
+  EXPECT_NE(icon1.cacheKey(), icon3.cacheKey());
+}
+
+//! Palette change should invalidate the cache.
+
+TEST_F(ColoredIconCacheTest, PaletteChange)
+{
+  auto& cache = ColoredIconCache::Instance();
+
+  const auto icon = utils::GetIcon(GetIconResourceName());
+  (void)icon.pixmap(QSize(16, 16));
+  EXPECT_EQ(cache.GetIconCount(), 1);
+
+  const auto palette = QApplication::palette();
+  QPalette new_palette(palette);
+  new_palette.setColor(QPalette::WindowText, Qt::green);
+  QApplication::setPalette(new_palette);
+
+  EXPECT_EQ(cache.GetIconCount(), 0);
+  EXPECT_EQ(cache.GetPixmapCount(), 0);
+
+  QApplication::setPalette(palette);
+}
+
+}  // namespace sup::gui::test
@@ -184,4 +184,48 @@ TEST_F(DtoComposerTabControllerTest, ReplaceRootItem)
   EXPECT_EQ(tab_widget.count(), 2);
 }
 
+//! Editors are created when their tabs become current for the first time.
+TEST_F(DtoComposerTabControllerTest, LazyEditorCreation)
+{
+  std::vector<mvvm::SessionItem*> requested_containers;
+  auto callback = [&requested_containers](mvvm::SessionItem* item)
+  {
+    requested_containers.push_back(item);
+    return std::make_unique<QWidget>();
+  };
+
+  auto container0 = m_model.InsertItem<mvvm::ContainerItem>();
+  auto container1 = m_model.InsertItem<mvvm::ContainerItem>();
+
+  QTabWidget tab_widget;
+  DtoComposerTabController controller(&m_model, callback, &tab_widget);
+
+  // only the current tab has an editor
+  EXPECT_EQ(tab_widget.count(), 2);
+  EXPECT_EQ(requested_containers, std::vector<mvvm::SessionItem*>({container0}));
+  ASSERT_NE(controller.GetEditorForItem(container0), nullptr);
+  EXPECT_EQ(controller.GetEditorForItem(container0)->parentWidget(),
+            controller.GetWidgetForItem(container0));
+  EXPECT_EQ(controller.GetEditorForItem(container1), nullptr);
+
+  // new container gets a tab without an editor
+  auto container2 = m_model.InsertItem<mvvm::ContainerItem>();
+  EXPECT_EQ(tab_widget.count(), 3);
+  EXPECT_EQ(controller.GetEditorForItem(container2), nullptr);
+
+  tab_widget.setCurrentIndex(2);
+  EXPECT_EQ(requested_containers, std::vector<mvvm::SessionItem*>({container0, container2}));
+  EXPECT_NE(controller.GetEditorForItem(container2), nullptr);
+
+  // editor is created only once
+  tab_widget.setCurrentIndex(0);
+  tab_widget.setCurrentIndex(2);
+  EXPECT_EQ(requested_containers.size(), 2);
+
+  // removal of the container without an editor
+  m_model.RemoveItem(container1);
+  EXPECT_EQ(tab_widget.count(), 2);
+  EXPECT_EQ(requested_containers.size(), 2);
+}
+
 }  // namespace sup::gui::test
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/viewmodel/scalar_array_table_model.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+
+#include <mvvm/model/application_model.h>
+
+#include <sup/dto/anytype.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QTest>
+
+namespace sup::gui::test
+{
+
+//! Testing ScalarArrayTableModel class in the presence of the event loop.
+
+class ScalarArrayTableModelTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Inserts packed array with the given number of int32 elements equal to their index.
+   */
+  AnyValueScalarArrayItem* InsertArray(int size)
+  {
+    auto result = m_model.InsertItem<AnyValueScalarArrayItem>();
+    ScalarArrayBuffer buffer(sup::dto::kInt32TypeName, static_cast<std::size_t>(size));
+    for (int index = 0; index < size; ++index)
+    {
+      buffer.SetElement(static_cast<std::size_t>(index), mvvm::variant_t(mvvm::int32{index}));
+    }
+    result->SetBuffer(buffer);
+    return result;
+  }
+
+  mvvm::ApplicationModel m_model;
+};
+
+//! Changes of the item made from outside are shown after returning to the event loop.
+
+TEST_F(ScalarArrayTableModelTest, ItemChangedFromOutside)
+{
+  auto array = InsertArray(3);
+
+  ScalarArrayTableModel view_model;
+  view_model.SetItem(array);
+
+  QSignalSpy spy_data_changed(&view_model, &QAbstractItemModel::dataChanged);
+  QSignalSpy spy_reset(&view_model, &QAbstractItemModel::modelReset);
+
+  // same number of elements, rows are kept
+  array->SetElement(2, mvvm::variant_t(mvvm::int32{42}));
+  EXPECT_TRUE(QTest::qWaitFor([&spy_data_changed]() { return spy_data_changed.count() > 0; }));
+  EXPECT_EQ(spy_reset.count(), 0);
+  EXPECT_EQ(view_model.data(view_model.index(2, 0)).toInt(), 42);
+
+  // different number of elements
+  array->SetBuffer(ScalarArrayBuffer(sup::dto::kInt32TypeName, 5));
+  EXPECT_TRUE(QTest::qWaitFor([&spy_reset]() { return spy_reset.count() > 0; }));
+  EXPECT_EQ(view_model.rowCount(), 5);
+
+  // removed item is forgotten
+  m_model.RemoveItem(array);
+  EXPECT_EQ(view_model.GetItem(), nullptr);
+  EXPECT_EQ(view_model.rowCount(), 0);
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,377 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/tasks/task_executor.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/tasks/i_task.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QTest>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief The SumTask class calculates a sum of integers and reports the progress.
+ */
+class SumTask : public ITask
+{
+public:
+  explicit SumTask(int count) : m_count(count) {}
+
+  void Run(TaskContext& context) override
+  {
+    for (int index = 1; index <= m_count; ++index)
+    {
+      if (context.IsCancelled())
+      {
+        return;
+      }
+      m_sum += index;
+      context.ReportProgress(index * 100 / m_count);
+    }
+  }
+
+  void Finalize() override { m_is_finalized = true; }
+
+  int m_count{0};
+  long m_sum{0};
+  bool m_is_finalized{false};
+};
+
+/**
+ * @brief The WaitTask class runs until cancelled or released.
+ */
+class WaitTask : public ITask
+{
+public:
+  explicit WaitTask(std::shared_ptr<std::atomic<bool>> is_released)
+      : m_is_released(std::move(is_released))
+  {
+  }
+
+  void Run(TaskContext& context) override
+  {
+    m_is_started = true;
+    while (!context.IsCancelled() && !m_is_released->load())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  std::shared_ptr<std::atomic<bool>> m_is_released;
+  std::atomic<bool> m_is_started{false};
+};
+
+/**
+ * @brief The ThrowingTask class throws on run.
+ */
+class ThrowingTask : public ITask
+{
+public:
+  void Run(TaskContext& context) override
+  {
+    (void)context;
+    throw std::runtime_error("failed");
+  }
+};
+
+/**
+ * @brief The RecordingTask class records its tag when run.
+ */
+class RecordingTask : public ITask
+{
+public:
+  RecordingTask(int tag, std::mutex& mutex, std::vector<int>& tags)
+      : m_tag(tag), m_mutex(mutex), m_tags(tags)
+  {
+  }
+
+  void Run(TaskContext& context) override
+  {
+    (void)context;
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_tags.push_back(m_tag);
+  }
+
+  int m_tag{0};
+  std::mutex& m_mutex;
+  std::vector<int>& m_tags;
+};
+
+//! Testing TaskExecutor class.
+
+class TaskExecutorTest : public ::testing::Test
+{
+public:
+  using task_id_t = TaskExecutor::task_id_t;
+
+  static bool WaitForFinished(const TaskExecutor& executor, task_id_t task_id)
+  {
+    return QTest::qWaitFor([&executor, task_id]() { return executor.IsFinished(task_id); },
+                           kTimeoutMsec);
+  }
+
+  static bool WaitForAllFinished(const TaskExecutor& executor)
+  {
+    return QTest::qWaitFor([&executor]() { return executor.GetActiveTaskCount() == 0; },
+                           kTimeoutMsec);
+  }
+
+  static bool WaitForStarted(const WaitTask& task)
+  {
+    return QTest::qWaitFor([&task]() { return task.m_is_started.load(); }, kTimeoutMsec);
+  }
+
+  static inline const int kTimeoutMsec = 30000;
+};
+
+TEST_F(TaskExecutorTest, InitialState)
+{
+  TaskExecutor executor(2);
+  EXPECT_EQ(executor.GetThreadCount(), 2);
+  EXPECT_EQ(executor.GetTaskCount(), 0);
+  EXPECT_EQ(executor.GetActiveTaskCount(), 0);
+  EXPECT_FALSE(executor.Cancel(42));
+  EXPECT_FALSE(executor.IsFinished(42));
+  EXPECT_EQ(executor.TakeResult(42), nullptr);
+  EXPECT_THROW(executor.GetStatus(42), RuntimeException);
+  EXPECT_THROW(executor.Submit({}), NullArgumentException);
+}
+
+TEST_F(TaskExecutorTest, RunTask)
+{
+  TaskExecutor executor(2);
+  QSignalSpy spy_status(&executor, &TaskExecutor::TaskStatusChanged);
+  QSignalSpy spy_finished(&executor, &TaskExecutor::TaskFinished);
+
+  auto task = std::make_unique<SumTask>(100);
+  auto task_ptr = task.get();
+  const auto task_id = executor.Submit(std::move(task));
+
+  EXPECT_EQ(executor.GetTaskCount(), 1);
+  EXPECT_EQ(executor.GetActiveTaskCount(), 1);
+
+  // result is not available until delivered to GUI thread
+  EXPECT_EQ(executor.TakeResult(task_id), nullptr);
+
+  ASSERT_TRUE(WaitForFinished(executor, task_id));
+  EXPECT_EQ(executor.GetStatus(task_id), TaskStatus::kCompleted);
+  EXPECT_EQ(executor.GetProgress(task_id), 100);
+  EXPECT_EQ(executor.GetActiveTaskCount(), 0);
+  EXPECT_FALSE(executor.Cancel(task_id));
+
+  // running and completed
+  ASSERT_EQ(spy_status.count(), 2);
+  EXPECT_EQ(spy_status.at(0).at(1).toInt(), static_cast<int>(TaskStatus::kRunning));
+  EXPECT_EQ(spy_status.at(1).at(1).toInt(), static_cast<int>(TaskStatus::kCompleted));
+
+  ASSERT_EQ(spy_finished.count(), 1);
+  EXPECT_EQ(spy_finished.at(0).at(0).value<quint64>(), task_id);
+  EXPECT_EQ(spy_finished.at(0).at(1).toInt(), static_cast<int>(TaskStatus::kCompleted));
+
+  // task was finalized in GUI thread
+  EXPECT_TRUE(task_ptr->m_is_finalized);
+
+  auto result = executor.TakeResult(task_id);
+  EXPECT_EQ(result.get(), task_ptr);
+  EXPECT_EQ(task_ptr->m_sum, 5050);
+  EXPECT_EQ(executor.GetTaskCount(), 0);
+}
+
+TEST_F(TaskExecutorTest, Progress)
+{
+  TaskExecutor executor(1);
+  QSignalSpy spy_progress(&executor, &TaskExecutor::TaskProgressChanged);
+
+  const auto task_id = executor.Submit(std::make_unique<SumTask>(1000));
+  ASSERT_TRUE(WaitForFinished(executor, task_id));
+
+  // progress notifications are merged, but the last one has the final value
+  ASSERT_GE(spy_progress.count(), 1);
+  EXPECT_LE(spy_progress.count(), 100);
+  EXPECT_EQ(spy_progress.at(spy_progress.count() - 1).at(1).toInt(), 100);
+}
+
+TEST_F(TaskExecutorTest, FailedTask)
+{
+  TaskExecutor executor(1);
+  QSignalSpy spy_finished(&executor, &TaskExecutor::TaskFinished);
+
+  const auto task_id = executor.Submit(std::make_unique<ThrowingTask>());
+  ASSERT_TRUE(WaitForFinished(executor, task_id));
+
+  EXPECT_EQ(executor.GetStatus(task_id), TaskStatus::kFailed);
+  ASSERT_EQ(spy_finished.count(), 1);
+  EXPECT_EQ(spy_finished.at(0).at(1).toInt(), static_cast<int>(TaskStatus::kFailed));
+  EXPECT_NE(executor.TakeResult(task_id), nullptr);
+}
+
+//! Cancelling running task and the task waiting in a queue.
+
+TEST_F(TaskExecutorTest, Cancel)
+{
+  TaskExecutor executor(1);
+  auto is_released = std::make_shared<std::atomic<bool>>(false);
+
+  auto running_task = std::make_unique<WaitTask>(is_released);
+  auto running_task_ptr = running_task.get();
+  const auto running_id = executor.Submit(std::move(running_task));
+
+  auto queued_task = std::make_unique<SumTask>(10);
+  auto queued_task_ptr = queued_task.get();
+  const auto queued_id = executor.Submit(std::move(queued_task));
+
+  ASSERT_TRUE(WaitForStarted(*running_task_ptr));
+  EXPECT_EQ(executor.GetStatus(queued_id), TaskStatus::kQueued);
+
+  EXPECT_TRUE(executor.Cancel(queued_id));
+  EXPECT_TRUE(executor.Cancel(running_id));
+
+  ASSERT_TRUE(WaitForAllFinished(executor));
+  EXPECT_EQ(executor.GetStatus(running_id), TaskStatus::kCancelled);
+  EXPECT_EQ(executor.GetStatus(queued_id), TaskStatus::kCancelled);
+
+  // queued task has never run, cancelled tasks are not finalized
+  EXPECT_EQ(queued_task_ptr->m_sum, 0);
+  EXPECT_FALSE(queued_task_ptr->m_is_finalized);
+}
+
+TEST_F(TaskExecutorTest, Priorities)
+{
+  TaskExecutor executor(1);
+  auto is_released = std::make_shared<std::atomic<bool>>(false);
+
+  auto blocking_task = std::make_unique<WaitTask>(is_released);
+  auto blocking_task_ptr = blocking_task.get();
+  (void)executor.Submit(std::move(blocking_task));
+  ASSERT_TRUE(WaitForStarted(*blocking_task_ptr));
+
+  std::mutex mutex;
+  std::vector<int> tags;
+  (void)executor.Submit(std::make_unique<RecordingTask>(0, mutex, tags), TaskPriority::kLow);
+  (void)executor.Submit(std::make_unique<RecordingTask>(1, mutex, tags), TaskPriority::kNormal);
+  (void)executor.Submit(std::make_unique<RecordingTask>(2, mutex, tags), TaskPriority::kHigh);
+
+  is_released->store(true);
+  ASSERT_TRUE(WaitForAllFinished(executor));
+
+  EXPECT_EQ(tags, std::vector<int>({2, 1, 0}));
+}
+
+//! Thousands of short tasks submitted at once.
+
+TEST_F(TaskExecutorTest, StressManyShortTasks)
+{
+  const int task_count = 5000;
+
+  TaskExecutor executor(4);
+  QSignalSpy spy_finished(&executor, &TaskExecutor::TaskFinished);
+
+  std::vector<task_id_t> task_ids;
+  for (int index = 0; index < task_count; ++index)
+  {
+    const auto priority = static_cast<TaskPriority>(index % kTaskPriorityCount);
+    task_ids.push_back(executor.Submit(std::make_unique<SumTask>(index % 100 + 1), priority));
+  }
+
+  ASSERT_TRUE(WaitForAllFinished(executor));
+  EXPECT_EQ(spy_finished.count(), task_count);
+  EXPECT_EQ(executor.GetTaskCount(), task_count);
+
+  for (std::size_t index = 0; index < task_ids.size(); ++index)
+  {
+    EXPECT_EQ(executor.GetStatus(task_ids[index]), TaskStatus::kCompleted);
+    auto task = executor.TakeResult(task_ids[index]);
+    ASSERT_NE(task, nullptr);
+    const long count = static_cast<long>(index % 100 + 1);
+    EXPECT_EQ(static_cast<SumTask*>(task.get())->m_sum, count * (count + 1) / 2);
+  }
+  EXPECT_EQ(executor.GetTaskCount(), 0);
+}
+
+//! Thousands of short tasks, half of them are cancelled while waiting in the queue.
+
+TEST_F(TaskExecutorTest, StressCancelHalfOfTasks)
+{
+  const int task_count = 5000;
+  const int thread_count = 4;
+
+  TaskExecutor executor(thread_count);
+
+  // occupying all threads, so that submitted tasks stay in the queue
+  auto is_released = std::make_shared<std::atomic<bool>>(false);
+  std::vector<const WaitTask*> blocking_tasks;
+  for (int index = 0; index < thread_count; ++index)
+  {
+    auto task = std::make_unique<WaitTask>(is_released);
+    blocking_tasks.push_back(task.get());
+    (void)executor.Submit(std::move(task), TaskPriority::kHigh);
+  }
+  for (auto task : blocking_tasks)
+  {
+    ASSERT_TRUE(WaitForStarted(*task));
+  }
+
+  std::vector<task_id_t> task_ids;
+  for (int index = 0; index < task_count; ++index)
+  {
+    task_ids.push_back(executor.Submit(std::make_unique<SumTask>(100)));
+    if (index % 2 == 1)
+    {
+      EXPECT_TRUE(executor.Cancel(task_ids.back()));
+    }
+  }
+  is_released->store(true);
+
+  ASSERT_TRUE(WaitForAllFinished(executor));
+
+  for (std::size_t index = 0; index < task_ids.size(); ++index)
+  {
+    const auto expected = index % 2 == 1 ? TaskStatus::kCancelled : TaskStatus::kCompleted;
+    EXPECT_EQ(executor.GetStatus(task_ids[index]), expected);
+  }
+}
+
+//! Destroying the executor while tasks are running and queued.
+
+TEST_F(TaskExecutorTest, DestroyWhileRunning)
+{
+  auto is_released = std::make_shared<std::atomic<bool>>(false);
+  auto executor = std::make_unique<TaskExecutor>(2);
+  for (int index = 0; index < 10; ++index)
+  {
+    (void)executor->Submit(std::make_unique<WaitTask>(is_released));
+  }
+
+  // tasks are cancelled and waited for
+  executor.reset();
+  EXPECT_FALSE(is_released->load());
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,175 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_table_model.h"
+
+#include <mvvm/commands/i_command_stack.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QTest>
+#include <QTransposeProxyModel>
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+Q_DECLARE_METATYPE(mvvm::PointItem*)
+#endif
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for WaveformTableModel class.
+ */
+class WaveformTableModelTest : public ::testing::Test
+{
+public:
+  WaveformTableModelTest()
+  {
+    m_data_item = m_model.InsertItem<mvvm::LineSeriesDataItem>();
+    m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}});
+  }
+
+  mvvm::ApplicationModel m_model;
+  mvvm::LineSeriesDataItem* m_data_item{nullptr};
+};
+
+TEST_F(WaveformTableModelTest, InitialState)
+{
+  WaveformTableModel table_model;
+  EXPECT_EQ(table_model.GetDataItem(), nullptr);
+  EXPECT_EQ(table_model.rowCount(), 0);
+  EXPECT_EQ(table_model.columnCount(), 2);
+  EXPECT_EQ(table_model.GetPoint(table_model.index(0, 0)), nullptr);
+}
+
+//! Values are read from points, edit role keeps full precision.
+TEST_F(WaveformTableModelTest, Data)
+{
+  WaveformTableModel table_model;
+  table_model.SetDataItem(m_data_item);
+
+  EXPECT_EQ(table_model.rowCount(), 3);
+  EXPECT_EQ(table_model.columnCount(), 2);
+  EXPECT_EQ(table_model.headerData(0, Qt::Horizontal).toString(), QString("x"));
+  EXPECT_EQ(table_model.headerData(1, Qt::Horizontal).toString(), QString("y"));
+
+  EXPECT_EQ(table_model.data(table_model.index(1, 0)).toDouble(), 2.0);
+  EXPECT_EQ(table_model.data(table_model.index(1, 1)).toDouble(), 20.0);
+  EXPECT_EQ(table_model.GetPoint(table_model.index(1, 1)), m_data_item->GetPoint(1));
+  EXPECT_TRUE(table_model.flags(table_model.index(1, 1)) & Qt::ItemIsEditable);
+
+  m_data_item->GetPoint(0)->SetX(0.1);
+  EXPECT_EQ(table_model.data(table_model.index(0, 0), Qt::EditRole).toString(), QString("0.1"));
+}
+
+//! Editing via transposed proxy, as it is done in the table widget, is undoable.
+TEST_F(WaveformTableModelTest, SetData)
+{
+  m_model.SetUndoEnabled(true);
+
+  WaveformTableModel table_model;
+  table_model.SetDataItem(m_data_item);
+  QTransposeProxyModel proxy;
+  proxy.setSourceModel(&table_model);
+
+  EXPECT_EQ(proxy.rowCount(), 2);
+  EXPECT_EQ(proxy.columnCount(), 3);
+
+  QSignalSpy spy_data_changed(&table_model, &WaveformTableModel::dataChanged);
+  QSignalSpy spy_x_edited(&table_model, &WaveformTableModel::PointXEdited);
+
+  EXPECT_TRUE(proxy.setData(proxy.index(1, 1), QString("42")));
+  EXPECT_EQ(m_data_item->GetPoint(1)->GetY(), 42.0);
+  EXPECT_EQ(spy_data_changed.count(), 1);
+  EXPECT_EQ(spy_x_edited.count(), 0);
+
+  // only edits of x are reported, changes from the model are not
+  EXPECT_TRUE(proxy.setData(proxy.index(0, 1), QString("5")));
+  EXPECT_EQ(spy_x_edited.count(), 1);
+  m_model.GetCommandStack()->Undo();
+  EXPECT_EQ(spy_x_edited.count(), 1);
+
+  // same value, or not a number, are ignored
+  EXPECT_FALSE(proxy.setData(proxy.index(1, 1), 42.0));
+  EXPECT_FALSE(proxy.setData(proxy.index(1, 1), QString("abc")));
+
+  m_model.GetCommandStack()->Undo();
+  EXPECT_EQ(m_data_item->GetPoint(1)->GetY(), 20.0);
+}
+
+//! Insertion and removal of points are reported as rows.
+TEST_F(WaveformTableModelTest, InsertRemovePoints)
+{
+  WaveformTableModel table_model;
+  table_model.SetDataItem(m_data_item);
+
+  QSignalSpy spy_inserted(&table_model, &WaveformTableModel::rowsInserted);
+  QSignalSpy spy_removed(&table_model, &WaveformTableModel::rowsRemoved);
+
+  m_data_item->InsertPoint(1, {1.5, 15.0});
+  ASSERT_EQ(spy_inserted.count(), 1);
+  EXPECT_EQ(spy_inserted.at(0).at(1).toInt(), 1);
+  EXPECT_EQ(table_model.rowCount(), 4);
+  EXPECT_EQ(table_model.data(table_model.index(1, 0)).toDouble(), 1.5);
+
+  m_data_item->RemovePoint(0);
+  ASSERT_EQ(spy_removed.count(), 1);
+  EXPECT_EQ(spy_removed.at(0).at(1).toInt(), 0);
+  EXPECT_EQ(table_model.rowCount(), 3);
+  EXPECT_EQ(table_model.data(table_model.index(0, 0)).toDouble(), 1.5);
+}
+
+//! Changes made outside of the table are reported with a single signal.
+TEST_F(WaveformTableModelTest, ExternalDataChange)
+{
+  WaveformTableModel table_model;
+  table_model.SetDataItem(m_data_item);
+
+  QSignalSpy spy_data_changed(&table_model, &WaveformTableModel::dataChanged);
+
+  m_data_item->GetPoint(0)->SetX(0.5);
+  m_data_item->GetPoint(2)->SetY(35.0);
+  EXPECT_EQ(spy_data_changed.count(), 0);
+
+  EXPECT_TRUE(QTest::qWaitFor([&spy_data_changed]() { return spy_data_changed.count() > 0; }));
+  EXPECT_EQ(spy_data_changed.count(), 1);
+  EXPECT_EQ(table_model.data(table_model.index(0, 0)).toDouble(), 0.5);
+  EXPECT_EQ(table_model.data(table_model.index(2, 1)).toDouble(), 35.0);
+}
+
+//! Removal of the data item clears the table.
+TEST_F(WaveformTableModelTest, RemoveDataItem)
+{
+  WaveformTableModel table_model;
+  table_model.SetDataItem(m_data_item);
+
+  QSignalSpy spy_reset(&table_model, &WaveformTableModel::modelReset);
+
+  m_model.RemoveItem(m_data_item);
+  EXPECT_EQ(spy_reset.count(), 1);
+  EXPECT_EQ(table_model.GetDataItem(), nullptr);
+  EXPECT_EQ(table_model.rowCount(), 0);
+}
+
+}  // namespace sup::gui::test
@@ -146,4 +146,40 @@ TEST_F(AnyValueEditorActionHandlerUndoRedoTest, UndoRedoForCopyAndPasteTwoFields
   EXPECT_EQ(parent->GetChildrenCount(), 4);
 }
 
+//! Batch insertion of many array elements should be undone with a single command.
+TEST_F(AnyValueEditorActionHandlerUndoRedoTest, UndoRedoForInsertItems)
+{
+  auto parent = m_model.InsertItem<AnyValueArrayItem>(GetContainer());
+  m_model.SetUndoEnabled(true);
+
+  auto handler = CreateActionHandler({parent});
+
+  const int element_count = 100;
+  EXPECT_CALL(m_mock_context, NotifyRequest(::testing::_)).Times(element_count);
+  EXPECT_CALL(m_mock_context, OnMessage(::testing::_)).Times(0);
+
+  std::vector<std::unique_ptr<mvvm::SessionItem>> items;
+  for (int index = 0; index < element_count; ++index)
+  {
+    auto item = std::make_unique<AnyValueScalarItem>();
+    item->SetAnyTypeName(sup::dto::kInt32TypeName);
+    items.push_back(std::move(item));
+  }
+
+  auto inserted = handler->InsertItems(std::move(items), parent, mvvm::TagIndex::Append());
+  ASSERT_EQ(inserted.size(), static_cast<std::size_t>(element_count));
+  EXPECT_EQ(parent->GetChildrenCount(), element_count);
+  EXPECT_EQ(parent->GetChildren().back(), inserted.back());
+  EXPECT_EQ(inserted.front()->GetDisplayName(), std::string("element0"));
+  EXPECT_EQ(inserted.back()->GetDisplayName(), std::string("element99"));
+
+  handler->Undo();
+  EXPECT_EQ(parent->GetChildrenCount(), 0);
+  EXPECT_FALSE(handler->CanUndo());
+
+  handler->Redo();
+  ASSERT_EQ(parent->GetChildrenCount(), element_count);
+  EXPECT_EQ(parent->GetChildren().back()->GetDisplayName(), std::string("element99"));
+}
+
 }  // namespace sup::gui::test
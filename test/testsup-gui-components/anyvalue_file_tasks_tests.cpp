@@ -0,0 +1,196 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/components/anyvalue_file_tasks.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <mvvm/test/test_helper.h>
+#include <mvvm/utils/file_utils.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+#include <testutils/folder_test.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for ImportAnyValueTask and ExportAnyValueTask classes.
+ */
+class AnyValueFileTasksTest : public test::FolderTest
+{
+public:
+  AnyValueFileTasksTest() : test::FolderTest("AnyValueFileTasksTest") {}
+
+  /**
+   * @brief Creates a file with JSON representation of a struct with a large array.
+   */
+  std::string CreateStructFile(const std::string& file_name)
+  {
+    sup::dto::AnyValue array = sup::dto::ArrayValue({{sup::dto::SignedInteger32Type, 0}});
+    for (int index = 1; index < 1000; ++index)
+    {
+      array.AddElement(sup::dto::AnyValue{sup::dto::SignedInteger32Type, index});
+    }
+    const sup::dto::AnyValue anyvalue = {{"name", {sup::dto::StringType, "abc"}}, {"data", array}};
+
+    const auto file_path = GetFilePath(file_name);
+    mvvm::test::CreateTextFile(file_path, AnyValueToJSONString(anyvalue));
+    return file_path;
+  }
+};
+
+//! Successful import of JSON file.
+TEST_F(AnyValueFileTasksTest, ImportFromFile)
+{
+  const auto file_path = CreateStructFile("ImportFromFile.json");
+
+  std::vector<int> progress;
+  TaskContext context(CancellationToken{}, [&progress](int value) { progress.push_back(value); });
+
+  ImportAnyValueTask task(file_path);
+  EXPECT_EQ(task.GetFileName(), file_path);
+  task.Run(context);
+
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  auto item = task.TakeItem();
+  ASSERT_NE(item.get(), nullptr);
+  EXPECT_EQ(item->GetChildren().size(), 2);
+  EXPECT_EQ(task.TakeItem(), nullptr);
+
+  // progress is growing and ends at 100
+  ASSERT_FALSE(progress.empty());
+  EXPECT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+  EXPECT_EQ(progress.back(), 100);
+}
+
+//! Cancelled import doesn't produce neither item, nor error.
+TEST_F(AnyValueFileTasksTest, CancelledImport)
+{
+  const auto file_path = CreateStructFile("CancelledImport.json");
+
+  CancellationToken token;
+  token.Cancel();
+  TaskContext context(token);
+
+  ImportAnyValueTask task(file_path);
+  task.Run(context);
+
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  EXPECT_EQ(task.TakeItem(), nullptr);
+}
+
+//! Import from non-existing or broken file reports an error instead of throwing.
+TEST_F(AnyValueFileTasksTest, ImportErrors)
+{
+  TaskContext context{CancellationToken{}};
+
+  ImportAnyValueTask non_existing_task(GetFilePath("NonExisting.json"));
+  EXPECT_NO_THROW(non_existing_task.Run(context));
+  EXPECT_FALSE(non_existing_task.GetErrorMessage().empty());
+  EXPECT_EQ(non_existing_task.TakeItem(), nullptr);
+
+  // huge broken file, error message shouldn't contain the whole content
+  const auto file_path = GetFilePath("BrokenFile.json");
+  mvvm::test::CreateTextFile(file_path, "{\"a\" : [" + std::string(100000, '1'));
+
+  ImportAnyValueTask broken_task(file_path);
+  EXPECT_NO_THROW(broken_task.Run(context));
+  EXPECT_FALSE(broken_task.GetErrorMessage().empty());
+  EXPECT_LT(broken_task.GetErrorMessage().size(), 2000);
+  EXPECT_EQ(broken_task.TakeItem(), nullptr);
+
+  // syntax error is reported with its location
+  const auto syntax_error_path = GetFilePath("SyntaxError.json");
+  mvvm::test::CreateTextFile(syntax_error_path, "{\n  \"a\" : [1, 2,, 3]\n}");
+
+  ImportAnyValueTask syntax_error_task(syntax_error_path);
+  syntax_error_task.Run(context);
+  EXPECT_NE(syntax_error_task.GetErrorMessage().find("line 2, column 15: expected value"),
+            std::string::npos);
+  EXPECT_EQ(syntax_error_task.TakeItem(), nullptr);
+}
+
+//! Successful export to JSON file.
+TEST_F(AnyValueFileTasksTest, ExportToFile)
+{
+  const auto file_path = GetFilePath("ExportToFile.json");
+  const sup::dto::AnyValue anyvalue{sup::dto::SignedInteger32Type, 42};
+
+  std::vector<int> progress;
+  TaskContext context(CancellationToken{}, [&progress](int value) { progress.push_back(value); });
+
+  ExportAnyValueTask task(anyvalue, file_path);
+  EXPECT_EQ(task.GetFileName(), file_path);
+  task.Run(context);
+
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  EXPECT_EQ(AnyValueFromJSONFile(file_path), anyvalue);
+  EXPECT_FALSE(mvvm::utils::IsExists(file_path + ".part"));
+  ASSERT_FALSE(progress.empty());
+  EXPECT_EQ(progress.back(), 100);
+}
+
+//! Cancelled export leaves existing file untouched.
+TEST_F(AnyValueFileTasksTest, CancelledExport)
+{
+  const auto file_path = GetFilePath("CancelledExport.json");
+  const sup::dto::AnyValue previous_value{sup::dto::SignedInteger32Type, 1};
+  mvvm::test::CreateTextFile(file_path, AnyValueToJSONString(previous_value));
+
+  CancellationToken token;
+  token.Cancel();
+  TaskContext context(token);
+
+  ExportAnyValueTask task(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}, file_path);
+  task.Run(context);
+
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  EXPECT_EQ(AnyValueFromJSONFile(file_path), previous_value);
+  EXPECT_FALSE(mvvm::utils::IsExists(file_path + ".part"));
+
+  // cancelled export of a new file doesn't create anything
+  const auto new_file_path = GetNewFilePath("CancelledExportV2.json");
+  ExportAnyValueTask new_task(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}, new_file_path);
+  new_task.Run(context);
+  EXPECT_FALSE(mvvm::utils::IsExists(new_file_path));
+}
+
+//! Export into non-existing directory reports an error.
+TEST_F(AnyValueFileTasksTest, ExportError)
+{
+  const auto file_path = GetFilePath("NonExistingDir/ExportError.json");
+  TaskContext context{CancellationToken{}};
+
+  ExportAnyValueTask task(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}, file_path);
+  EXPECT_NO_THROW(task.Run(context));
+  EXPECT_FALSE(task.GetErrorMessage().empty());
+  EXPECT_FALSE(mvvm::utils::IsExists(file_path));
+}
+
+}  // namespace sup::gui::test
@@ -54,6 +54,20 @@ public:
     // trying to set display name to first column
     return viewmodel.setData(indexes.at(0), QVariant::fromValue(QString("aaa")), Qt::EditRole);
   }
+
+  /**
+   * @brief Inserts array with the given number of scalars into the model.
+   */
+  static AnyValueArrayItem* InsertArray(mvvm::ApplicationModel& model, int size)
+  {
+    auto array_item = model.InsertItem<AnyValueArrayItem>();
+    for (int index = 0; index < size; ++index)
+    {
+      auto scalar = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+      scalar->SetAnyTypeName(sup::dto::kInt32TypeName);
+    }
+    return array_item;
+  }
 };
 
 //! Testing how a single scalar item looks in a view model.
@@ -372,4 +386,244 @@ TEST_F(AnyValueViewModelTest, AnyValueItemInTheContainer)
   EXPECT_EQ(viewmodel.data(item_type_index, Qt::DisplayRole), expected_variant);
 }
 
+//! Array which is not larger than the fetch page is built at once.
+
+TEST_F(AnyValueViewModelTest, SmallArrayIsNotPaged)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 2);
+
+  AnyValueViewModel viewmodel(&model, 2);
+  EXPECT_EQ(viewmodel.GetFetchPageSize(), 2);
+
+  auto array_index = viewmodel.index(0, 0);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+  EXPECT_TRUE(viewmodel.hasChildren(array_index));
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+  EXPECT_EQ(viewmodel.FindViews(array_item->GetChildren().at(1)).size(), 2);
+
+  // array grows beyond page size, new row appears immediately
+  (void)model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+  EXPECT_EQ(viewmodel.rowCount(array_index), 3);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+}
+
+//! Rows of array larger than the fetch page are built page by page on request.
+
+TEST_F(AnyValueViewModelTest, LargeArrayIsPaged)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 5);
+  auto children = array_item->GetChildren();
+
+  AnyValueViewModel viewmodel(&model, 2);
+  EXPECT_EQ(viewmodel.rowCount(), 1);
+
+  // array row exists, but its children aren't built
+  auto array_index = viewmodel.index(0, 0);
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(array_index), array_item);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 0);
+  EXPECT_TRUE(viewmodel.hasChildren(array_index));
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+  EXPECT_FALSE(viewmodel.canFetchMore(viewmodel.index(0, 1)));
+  EXPECT_TRUE(viewmodel.FindViews(children.at(0)).empty());
+
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(0, 0, array_index)), children.at(0));
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(1, 1, array_index)), children.at(1));
+  EXPECT_TRUE(viewmodel.FindViews(children.at(2)).empty());
+
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 4);
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 5);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+  EXPECT_TRUE(viewmodel.hasChildren(array_index));
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(4, 0, array_index)), children.at(4));
+
+  // fully fetched array shows new children immediately
+  auto new_item = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+  EXPECT_EQ(viewmodel.rowCount(array_index), 6);
+  EXPECT_EQ(viewmodel.FindViews(new_item).size(), 2);
+
+  // removal works as before
+  model.RemoveItem(children.at(0));
+  EXPECT_EQ(viewmodel.rowCount(array_index), 5);
+}
+
+//! Children inserted into partially fetched array are waiting for the next fetch.
+
+TEST_F(AnyValueViewModelTest, InsertIntoPartiallyFetchedArray)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 3);
+
+  AnyValueViewModel viewmodel(&model, 2);
+  auto array_index = viewmodel.index(0, 0);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+
+  auto new_item = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+  EXPECT_TRUE(viewmodel.FindViews(new_item).empty());
+
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 4);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+  EXPECT_EQ(viewmodel.FindViews(new_item).size(), 2);
+}
+
+//! Child inserted in the middle of partially fetched array gets its row immediately, next pages
+//! neither duplicate nor skip rows.
+
+TEST_F(AnyValueViewModelTest, InsertIntoMiddleOfPartiallyFetchedArray)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 5);
+
+  AnyValueViewModel viewmodel(&model, 2);
+  auto array_index = viewmodel.index(0, 0);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+
+  auto new_item = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Default(1));
+  EXPECT_EQ(viewmodel.rowCount(array_index), 3);
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(1, 0, array_index)), new_item);
+
+  viewmodel.fetchMore(array_index);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 6);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+
+  auto children = array_item->GetChildren();
+  for (int row = 0; row < viewmodel.rowCount(array_index); ++row)
+  {
+    EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(row, 0, array_index)),
+              children.at(row));
+    EXPECT_EQ(viewmodel.FindViews(children.at(row)).size(), 2);
+  }
+}
+
+//! Removal of the fetched child doesn't make the next child appear without fetch, next pages
+//! neither duplicate nor skip rows.
+
+TEST_F(AnyValueViewModelTest, RemoveFromPartiallyFetchedArray)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 5);
+
+  AnyValueViewModel viewmodel(&model, 2);
+  auto array_index = viewmodel.index(0, 0);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+
+  model.RemoveItem(array_item->GetChildren().at(0));
+  EXPECT_EQ(viewmodel.rowCount(array_index), 1);
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+
+  viewmodel.fetchMore(array_index);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 4);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+
+  auto children = array_item->GetChildren();
+  for (int row = 0; row < viewmodel.rowCount(array_index); ++row)
+  {
+    EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(row, 0, array_index)),
+              children.at(row));
+    EXPECT_EQ(viewmodel.FindViews(children.at(row)).size(), 2);
+  }
+}
+
+//! Fetching all pages necessary to reach an item deep inside of nested arrays.
+
+TEST_F(AnyValueViewModelTest, FetchItem)
+{
+  mvvm::ApplicationModel model;
+  auto array_item = InsertArray(model, 3);
+  auto inner_array = model.InsertItem<AnyValueArrayItem>(array_item, mvvm::TagIndex::Append());
+  for (int index = 0; index < 5; ++index)
+  {
+    (void)model.InsertItem<AnyValueScalarItem>(inner_array, mvvm::TagIndex::Append());
+  }
+  auto item = inner_array->GetChildren().at(2);
+
+  AnyValueViewModel viewmodel(&model, 2);
+  EXPECT_TRUE(viewmodel.FindViews(inner_array).empty());
+  EXPECT_TRUE(viewmodel.FindViews(item).empty());
+
+  viewmodel.FetchItem(item);
+  EXPECT_EQ(viewmodel.FindViews(inner_array).size(), 2);
+  EXPECT_EQ(viewmodel.FindViews(item).size(), 2);
+
+  // only pages up to the item were fetched
+  auto array_index = viewmodel.index(0, 0);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 4);
+  auto inner_array_index = viewmodel.GetIndexOfSessionItem(inner_array).at(0);
+  EXPECT_EQ(viewmodel.rowCount(inner_array_index), 4);
+  EXPECT_TRUE(viewmodel.canFetchMore(inner_array_index));
+}
+
+//! View model created without a model, as tree components do, follows insertions into and
+//! removals from a partially fetched array after the root item is set.
+
+TEST_F(AnyValueViewModelTest, PagedArrayAfterSetRootSessionItem)
+{
+  mvvm::ApplicationModel model;
+  auto container = model.InsertItem<mvvm::ContainerItem>();
+  auto array_item = model.InsertItem<AnyValueArrayItem>(container, mvvm::TagIndex::Append());
+  for (int index = 0; index < 5; ++index)
+  {
+    auto scalar = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Append());
+    scalar->SetAnyTypeName(sup::dto::kInt32TypeName);
+  }
+
+  AnyValueViewModel viewmodel(nullptr, 2);
+  viewmodel.SetRootSessionItem(container);
+
+  auto array_index = viewmodel.index(0, 0);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+
+  // inserting into the middle of exposed children
+  auto inserted = model.InsertItem<AnyValueScalarItem>(array_item, mvvm::TagIndex::Default(1));
+  EXPECT_EQ(viewmodel.rowCount(array_index), 3);
+  EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(1, 0, array_index)), inserted);
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+
+  // removing exposed child
+  model.RemoveItem(array_item->GetChildren().at(0));
+  EXPECT_EQ(viewmodel.rowCount(array_index), 2);
+  EXPECT_TRUE(viewmodel.canFetchMore(array_index));
+
+  viewmodel.fetchMore(array_index);
+  viewmodel.fetchMore(array_index);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 5);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+
+  auto children = array_item->GetChildren();
+  for (int row = 0; row < viewmodel.rowCount(array_index); ++row)
+  {
+    EXPECT_EQ(viewmodel.GetSessionItemFromIndex(viewmodel.index(row, 0, array_index)),
+              children.at(row));
+  }
+}
+
+//! Zero page size disables paging.
+
+TEST_F(AnyValueViewModelTest, ZeroFetchPageSize)
+{
+  mvvm::ApplicationModel model;
+  (void)InsertArray(model, 5);
+
+  AnyValueViewModel viewmodel(&model, 0);
+  auto array_index = viewmodel.index(0, 0);
+  EXPECT_EQ(viewmodel.rowCount(array_index), 5);
+  EXPECT_FALSE(viewmodel.canFetchMore(array_index));
+}
+
 }  // namespace sup::gui::test
@@ -20,8 +20,11 @@
 
 #include "sup/gui/components/dto_composer_action_handler.h"
 
+#include <sup/gui/components/dto_composer_tasks.h>
 #include <sup/gui/core/sup_gui_core_exceptions.h>
 #include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
 
 #include <mvvm/model/application_model.h>
 #include <mvvm/standarditems/container_item.h>
@@ -91,4 +94,72 @@ TEST_F(DtoComposerActionHandlerTest, OnDuplicateContainer)
   EXPECT_EQ(copied_scalar->Data<mvvm::int8>(), 42);
 }
 
+//! Duplication in a background task, the copy is inserted right after the source container.
+TEST_F(DtoComposerActionHandlerTest, DuplicateContainerInTask)
+{
+  auto container0 = m_model.InsertItem<mvvm::ContainerItem>();
+  auto container1 = m_model.InsertItem<mvvm::ContainerItem>();
+
+  auto scalar_item = container0->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+  scalar_item->SetAnyTypeName(sup::dto::kInt8TypeName);
+  scalar_item->SetData(mvvm::int8{42});
+
+  DtoComposerActionHandler action_handler(&m_model);
+  auto task = action_handler.CreateDuplicateTask(0);
+  ASSERT_NE(task, nullptr);
+
+  // containers are added meanwhile
+  auto container2 =
+      m_model.InsertItem<mvvm::ContainerItem>(m_model.GetRootItem(), mvvm::TagIndex::Default(0));
+
+  TaskContext context{CancellationToken{}};
+  task->Run(context);
+  action_handler.InsertDuplicatedContainer(*task);
+
+  ASSERT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 4);
+  auto copy = m_model.GetRootItem()->GetItem(mvvm::TagIndex::Default(2));
+  EXPECT_EQ(m_model.GetRootItem()->GetAllItems(),
+            std::vector<mvvm::SessionItem*>({container2, container0, copy, container1}));
+  auto copied_scalar = copy->GetItem<AnyValueScalarItem>(mvvm::TagIndex::Default(0));
+  ASSERT_NE(copied_scalar, nullptr);
+  EXPECT_EQ(copied_scalar->Data<mvvm::int8>(), 42);
+
+  // the container is taken already
+  action_handler.InsertDuplicatedContainer(*task);
+  EXPECT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 4);
+}
+
+//! The copy is appended, if the source container was removed while the task was running.
+TEST_F(DtoComposerActionHandlerTest, DuplicateRemovedContainerInTask)
+{
+  auto container0 = m_model.InsertItem<mvvm::ContainerItem>();
+  auto container1 = m_model.InsertItem<mvvm::ContainerItem>();
+  auto container2 = m_model.InsertItem<mvvm::ContainerItem>();
+
+  DtoComposerActionHandler action_handler(&m_model);
+  auto task = action_handler.CreateDuplicateTask(0);
+  ASSERT_NE(task, nullptr);
+  m_model.RemoveItem(container0);
+
+  TaskContext context{CancellationToken{}};
+  task->Run(context);
+  action_handler.InsertDuplicatedContainer(*task);
+
+  ASSERT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 3);
+  auto copy = m_model.GetRootItem()->GetItem(mvvm::TagIndex::Default(2));
+  EXPECT_EQ(m_model.GetRootItem()->GetAllItems(),
+            std::vector<mvvm::SessionItem*>({container1, container2, copy}));
+}
+
+//! Containers with items other than AnyValueItem are duplicated in the model only.
+TEST_F(DtoComposerActionHandlerTest, CreateDuplicateTaskForUnsupportedContainer)
+{
+  auto container = m_model.InsertItem<mvvm::ContainerItem>();
+  (void)m_model.InsertItem<mvvm::ContainerItem>(container);
+
+  DtoComposerActionHandler action_handler(&m_model);
+  EXPECT_EQ(action_handler.CreateDuplicateTask(0), nullptr);
+  EXPECT_EQ(action_handler.CreateDuplicateTask(1), nullptr);
+}
+
 }  // namespace sup::gui::test
@@ -0,0 +1,155 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/components/dto_composer_tasks.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <mvvm/standarditems/container_item.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for DuplicateContainerTask class.
+ */
+class DtoComposerTasksTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Returns a struct with a scalar and an array.
+   */
+  static sup::dto::AnyValue CreateStruct()
+  {
+    sup::dto::AnyValue array = sup::dto::ArrayValue({{sup::dto::SignedInteger32Type, 0}});
+    for (int index = 1; index < 100; ++index)
+    {
+      array.AddElement(sup::dto::AnyValue{sup::dto::SignedInteger32Type, index});
+    }
+    return {{"name", {sup::dto::StringType, "abc"}}, {"data", array}};
+  }
+};
+
+TEST_F(DtoComposerTasksTest, DuplicateContainer)
+{
+  mvvm::ContainerItem container;
+  (void)container.SetDisplayName("container");
+  auto item = container.InsertItem(CreateAnyValueItem(CreateStruct()), mvvm::TagIndex::Append());
+  (void)item->SetDisplayName("struct");
+  auto scalar = CreateAnyValueItem(sup::dto::AnyValue{sup::dto::SignedInteger8Type, 42});
+  (void)container.InsertItem(std::move(scalar), mvvm::TagIndex::Append());
+
+  ASSERT_TRUE(DuplicateContainerTask::CanDuplicate(container));
+  DuplicateContainerTask task(container);
+  EXPECT_EQ(task.GetSourceIdentifier(), container.GetIdentifier());
+
+  std::vector<int> progress;
+  TaskContext context(CancellationToken{}, [&progress](int value) { progress.push_back(value); });
+  task.Run(context);
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  EXPECT_EQ(progress, std::vector<int>({50, 100}));
+
+  auto copy = task.TakeContainer();
+  ASSERT_NE(copy, nullptr);
+  EXPECT_EQ(task.TakeContainer(), nullptr);
+  EXPECT_EQ(copy->GetDisplayName(), std::string("container"));
+  EXPECT_NE(copy->GetIdentifier(), container.GetIdentifier());
+  ASSERT_EQ(copy->GetSize(), 2);
+
+  auto struct_copy = copy->GetItem<AnyValueItem>(mvvm::TagIndex::Default(0));
+  EXPECT_EQ(struct_copy->GetDisplayName(), std::string("struct"));
+  EXPECT_EQ(CreateAnyValue(*struct_copy), CreateStruct());
+
+  auto scalar_copy = copy->GetItem<AnyValueItem>(mvvm::TagIndex::Default(1));
+  EXPECT_EQ(CreateAnyValue(*scalar_copy),
+            sup::dto::AnyValue(sup::dto::SignedInteger8Type, 42));
+}
+
+//! Snapshot is taken on construction, later changes of the source are not seen by the task.
+TEST_F(DtoComposerTasksTest, SnapshotOnConstruction)
+{
+  mvvm::ContainerItem container;
+  auto item = container.InsertItem(
+      CreateAnyValueItem(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 1}),
+      mvvm::TagIndex::Append());
+
+  DuplicateContainerTask task(container);
+  item->SetData(2);
+
+  TaskContext context{CancellationToken{}};
+  task.Run(context);
+
+  auto copy = task.TakeContainer();
+  ASSERT_EQ(copy->GetSize(), 1);
+  EXPECT_EQ(CreateAnyValue(*copy->GetItem<AnyValueItem>(mvvm::TagIndex::Default(0))),
+            sup::dto::AnyValue(sup::dto::SignedInteger32Type, 1));
+}
+
+TEST_F(DtoComposerTasksTest, DuplicateEmptyContainer)
+{
+  mvvm::ContainerItem container;
+
+  DuplicateContainerTask task(container);
+  TaskContext context{CancellationToken{}};
+  task.Run(context);
+
+  auto copy = task.TakeContainer();
+  ASSERT_NE(copy, nullptr);
+  EXPECT_EQ(copy->GetSize(), 0);
+}
+
+//! Container with items other than AnyValueItem can't be duplicated by the task.
+TEST_F(DtoComposerTasksTest, UnsupportedContainer)
+{
+  mvvm::ContainerItem container;
+  (void)container.InsertItem(std::make_unique<mvvm::ContainerItem>(), mvvm::TagIndex::Append());
+
+  EXPECT_FALSE(DuplicateContainerTask::CanDuplicate(container));
+  EXPECT_THROW(DuplicateContainerTask{container}, RuntimeException);
+}
+
+//! Cancelled duplication doesn't produce neither container, nor error.
+TEST_F(DtoComposerTasksTest, CancelledDuplication)
+{
+  mvvm::ContainerItem container;
+  (void)container.InsertItem(CreateAnyValueItem(CreateStruct()), mvvm::TagIndex::Append());
+
+  CancellationToken token;
+  token.Cancel();
+  TaskContext context(token);
+
+  DuplicateContainerTask task(container);
+  task.Run(context);
+
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  EXPECT_EQ(task.TakeContainer(), nullptr);
+}
+
+}  // namespace sup::gui::test
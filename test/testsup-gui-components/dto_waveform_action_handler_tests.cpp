@@ -20,13 +20,17 @@
 
 #include "sup/gui/components/dto_waveform_action_handler.h"
 
+#include <sup/gui/components/waveform_file_tasks.h>
 #include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/model/packed_waveform_item.h>
 
+#include <mvvm/commands/i_command_stack.h>
 #include <mvvm/model/application_model.h>
 #include <mvvm/standarditems/chart_viewport_item.h>
 #include <mvvm/standarditems/container_item.h>
 #include <mvvm/standarditems/line_series_data_item.h>
 #include <mvvm/standarditems/line_series_item.h>
+#include <mvvm/standarditems/point_item.h>
 #include <mvvm/test/test_helper.h>
 
 #include <gtest/gtest.h>
@@ -50,6 +54,7 @@ public:
   {
     m_waveform_container = m_model.InsertItem<mvvm::ChartViewportItem>();
     m_data_container = m_model.InsertItem<mvvm::ContainerItem>();
+    m_packed_container = m_model.InsertItem<mvvm::ContainerItem>();
   }
 
   /**
@@ -64,6 +69,7 @@ public:
     result.waveform_container = [this]() { return m_waveform_container; };
     result.data_container = [this]() { return m_data_container; };
     result.selected_waveform = [selected_waveform]() { return selected_waveform; };
+    result.packed_data_container = [this]() { return m_packed_container; };
 
     return result;
   }
@@ -92,6 +98,7 @@ public:
   mvvm::ApplicationModel m_model;
   mvvm::ChartViewportItem* m_waveform_container{nullptr};
   mvvm::ContainerItem* m_data_container{nullptr};
+  mvvm::ContainerItem* m_packed_container{nullptr};
 };
 
 TEST_F(DtoWaveformActionHandlerTest, AttemptToCreateHandlerWithoutCallbacks)
@@ -240,4 +247,231 @@ TEST_F(DtoWaveformActionHandlerTest, RemoveWaveformFromTheMiddle)
   EXPECT_EQ(GetDataContainer()->GetChildren(), std::vector<mvvm::SessionItem*>({data0, data2}));
 }
 
+//! Inserting imported waveform together with its data as one command.
+TEST_F(DtoWaveformActionHandlerTest, InsertImportedWaveform)
+{
+  m_model.SetUndoEnabled(true);
+  auto handler = CreateActionHandler(nullptr);
+
+  EXPECT_NE(handler->CreateImportTask("a.csv", {}), nullptr);
+
+  QSignalSpy spy_selection_request(handler.get(), &DtoWaveformActionHandler::SelectWaveformRequest);
+
+  const std::vector<std::pair<double, double>> points({{1.0, 10.0}, {2.0, 20.0}});
+  handler->InsertImportedWaveform(CreateWaveformBuffer(points), "profile");
+
+  ASSERT_EQ(GetWaveformContainer()->GetLineSeriesCount(), 1);
+  auto inserted_waveform = GetWaveformContainer()->GetLineSeries().at(0);
+  EXPECT_EQ(inserted_waveform->GetDisplayName(), "profile");
+  ASSERT_NE(inserted_waveform->GetDataItem(), nullptr);
+  EXPECT_EQ(inserted_waveform->GetDataItem()->GetWaveform(), points);
+  EXPECT_EQ(mvvm::test::GetSendItem<mvvm::LineSeriesItem*>(spy_selection_request),
+            inserted_waveform);
+
+  // single undo removes both waveform and its data
+  m_model.GetCommandStack()->Undo();
+  EXPECT_EQ(GetWaveformContainer()->GetLineSeriesCount(), 0);
+  EXPECT_TRUE(GetDataContainer()->IsEmpty());
+}
+
+TEST_F(DtoWaveformActionHandlerTest, CreateExportTask)
+{
+  auto handler = CreateActionHandler(nullptr);
+  EXPECT_FALSE(handler->CanExportWaveform());
+  EXPECT_EQ(handler->CreateExportTask("a.csv", {}), nullptr);
+
+  auto waveform =
+      m_model.InsertItem<mvvm::LineSeriesItem>(GetWaveformContainer(), mvvm::TagIndex::Append());
+  auto data =
+      m_model.InsertItem<mvvm::LineSeriesDataItem>(GetDataContainer(), mvvm::TagIndex::Append());
+  waveform->SetDataItem(data);
+
+  handler = CreateActionHandler(waveform);
+  EXPECT_TRUE(handler->CanExportWaveform());
+  EXPECT_NE(handler->CreateExportTask("a.csv", {}), nullptr);
+}
+
+TEST_F(DtoWaveformActionHandlerTest, CreateResampledExportTask)
+{
+  auto handler = CreateActionHandler(nullptr);
+  EXPECT_FALSE(handler->CanExportResampledWaveforms());
+  EXPECT_EQ(handler->CreateResampledExportTask("a.json", {}), nullptr);
+
+  // waveform without points is not exported
+  handler->InsertImportedWaveform(WaveformBuffer{}, "empty");
+  EXPECT_FALSE(handler->CanExportResampledWaveforms());
+
+  handler->InsertImportedWaveform(CreateWaveformBuffer({{1.0, 10.0}, {2.0, 20.0}}), "profile");
+  EXPECT_TRUE(handler->CanExportResampledWaveforms());
+  EXPECT_NE(handler->CreateResampledExportTask("a.json", {}), nullptr);
+}
+
+//! Points of hidden waveforms are packed, and restored when the waveform is displayed or
+//! selected.
+TEST_F(DtoWaveformActionHandlerTest, UpdatePackedWaveforms)
+{
+  auto handler = CreateActionHandler(nullptr);
+  EXPECT_TRUE(handler->CanPackWaveforms());
+
+  const std::vector<std::pair<double, double>> points0({{1.0, 10.0}, {2.0, 20.0}});
+  const std::vector<std::pair<double, double>> points1({{1.0, 11.0}, {1.5, 21.0}, {4.0, 31.0}});
+  handler->InsertImportedWaveform(CreateWaveformBuffer(points0), "waveform0");
+  handler->InsertImportedWaveform(CreateWaveformBuffer(points1), "waveform1");
+  auto waveform0 = GetWaveformContainer()->GetLineSeries().at(0);
+  auto waveform1 = GetWaveformContainer()->GetLineSeries().at(1);
+
+  // displayed waveforms stay as they are
+  handler->UpdatePackedWaveforms();
+  EXPECT_TRUE(m_packed_container->IsEmpty());
+
+  waveform0->SetDisplayed(false);
+  waveform1->SetDisplayed(false);
+
+  // selected waveform is not packed
+  handler = CreateActionHandler(waveform1);
+  handler->UpdatePackedWaveforms();
+  EXPECT_TRUE(handler->IsWaveformPacked(waveform0));
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform1));
+  EXPECT_EQ(waveform0->GetDataItem()->GetPointCount(), 0);
+  EXPECT_EQ(waveform1->GetDataItem()->GetWaveform(), points1);
+  ASSERT_EQ(m_packed_container->GetSize(), 1);
+  auto packed_item = m_packed_container->GetItem<PackedWaveformItem>(mvvm::TagIndex::First());
+  EXPECT_EQ(packed_item->GetDataItemIdentifier(), waveform0->GetDataItem()->GetIdentifier());
+
+  // packed points are still exported
+  EXPECT_TRUE(handler->CanExportResampledWaveforms());
+
+  // selection moves to another waveform
+  handler = CreateActionHandler(waveform0);
+  handler->UpdatePackedWaveforms();
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform0));
+  EXPECT_TRUE(handler->IsWaveformPacked(waveform1));
+  EXPECT_EQ(waveform0->GetDataItem()->GetWaveform(), points0);
+  EXPECT_EQ(waveform1->GetDataItem()->GetPointCount(), 0);
+  EXPECT_EQ(m_packed_container->GetSize(), 1);
+
+  // displayed waveform is unpacked
+  waveform1->SetDisplayed(true);
+  handler->UpdatePackedWaveforms();
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform1));
+  EXPECT_EQ(waveform1->GetDataItem()->GetWaveform(), points1);
+  EXPECT_TRUE(m_packed_container->IsEmpty());
+}
+
+//! Removal of the packed waveform removes its packed data.
+TEST_F(DtoWaveformActionHandlerTest, RemovePackedWaveform)
+{
+  auto handler = CreateActionHandler(nullptr);
+  handler->InsertImportedWaveform(CreateWaveformBuffer({{1.0, 10.0}, {2.0, 20.0}}), "waveform");
+  auto waveform = GetWaveformContainer()->GetLineSeries().at(0);
+  waveform->SetDisplayed(false);
+  handler->UpdatePackedWaveforms();
+  ASSERT_TRUE(handler->IsWaveformPacked(waveform));
+
+  handler = CreateActionHandler(waveform);
+  handler->RemoveWaveform();
+  EXPECT_EQ(GetWaveformContainer()->GetLineSeriesCount(), 0);
+  EXPECT_TRUE(GetDataContainer()->IsEmpty());
+  EXPECT_TRUE(m_packed_container->IsEmpty());
+}
+
+//! With undo enabled, nothing is packed, and waveforms packed before are unpacked without
+//! leaving a trace in the command history.
+TEST_F(DtoWaveformActionHandlerTest, PackWithUndoEnabled)
+{
+  const std::vector<std::pair<double, double>> points({{1.0, 10.0}, {2.0, 20.0}});
+  auto handler = CreateActionHandler(nullptr);
+  handler->InsertImportedWaveform(CreateWaveformBuffer(points), "waveform");
+  auto waveform = GetWaveformContainer()->GetLineSeries().at(0);
+  waveform->SetDisplayed(false);
+  handler->UpdatePackedWaveforms();
+  ASSERT_TRUE(handler->IsWaveformPacked(waveform));
+
+  m_model.SetUndoEnabled(true);
+  auto command_stack = m_model.GetCommandStack();
+  EXPECT_FALSE(handler->CanPackWaveforms());
+
+  handler->UpdatePackedWaveforms();
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform));
+  EXPECT_EQ(waveform->GetDataItem()->GetWaveform(), points);
+  EXPECT_TRUE(m_packed_container->IsEmpty());
+  EXPECT_EQ(command_stack->GetCommandCount(), 0);
+  EXPECT_FALSE(command_stack->CanUndo());
+}
+
+//! Selection of waveforms, and paging which follows it, leave the user's history unchanged.
+TEST_F(DtoWaveformActionHandlerTest, SelectionKeepsUserHistory)
+{
+  m_model.SetUndoEnabled(true);
+  auto command_stack = m_model.GetCommandStack();
+
+  auto handler = CreateActionHandler(nullptr);
+  handler->InsertImportedWaveform(CreateWaveformBuffer({{1.0, 10.0}, {2.0, 20.0}}), "waveform0");
+  handler->InsertImportedWaveform(CreateWaveformBuffer({{1.0, 11.0}, {2.0, 21.0}}), "waveform1");
+  auto waveform0 = GetWaveformContainer()->GetLineSeries().at(0);
+  auto waveform1 = GetWaveformContainer()->GetLineSeries().at(1);
+  waveform1->SetDisplayed(false);
+  const auto command_count = command_stack->GetCommandCount();
+
+  // selection of the first waveform
+  handler = CreateActionHandler(waveform0);
+  handler->UnpackWaveform(waveform0);
+  handler->UpdatePackedWaveforms();
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform1));
+  EXPECT_EQ(command_stack->GetCommandCount(), command_count);
+
+  // undo reverts the user's change, not the paging
+  command_stack->Undo();
+  EXPECT_TRUE(waveform1->IsDisplayed());
+
+  // selection of the second waveform keeps the redo
+  handler = CreateActionHandler(waveform1);
+  handler->UnpackWaveform(waveform1);
+  handler->UpdatePackedWaveforms();
+  EXPECT_EQ(command_stack->GetCommandCount(), command_count);
+  ASSERT_TRUE(command_stack->CanRedo());
+
+  command_stack->Redo();
+  EXPECT_FALSE(waveform1->IsDisplayed());
+  handler = CreateActionHandler(waveform0);
+  handler->UpdatePackedWaveforms();
+  EXPECT_FALSE(handler->IsWaveformPacked(waveform1));
+  EXPECT_EQ(waveform1->GetDataItem()->GetPointCount(), 2);
+  EXPECT_EQ(command_stack->GetCommandCount(), command_count);
+  EXPECT_FALSE(command_stack->CanRedo());
+}
+
+//! Statistics and overview of waveforms, packed ones included.
+TEST_F(DtoWaveformActionHandlerTest, WaveformStatisticsAndOverview)
+{
+  auto handler = CreateActionHandler(nullptr);
+  EXPECT_EQ(handler->GetWaveformStatistics(nullptr).count, 0);
+  EXPECT_TRUE(handler->CreateWaveformOverview(nullptr, 2).empty());
+
+  handler->InsertImportedWaveform(
+      CreateWaveformBuffer({{1.0, 10.0}, {2.0, 40.0}, {3.0, 20.0}, {4.0, 30.0}}), "waveform");
+  auto waveform = GetWaveformContainer()->GetLineSeries().at(0);
+
+  auto statistics = handler->GetWaveformStatistics(waveform);
+  EXPECT_EQ(statistics.count, 4);
+  EXPECT_DOUBLE_EQ(statistics.min_y, 10.0);
+  EXPECT_DOUBLE_EQ(statistics.max_y, 40.0);
+  EXPECT_DOUBLE_EQ(statistics.mean_y, 25.0);
+
+  using bins_t = std::vector<std::pair<double, double>>;
+  EXPECT_EQ(handler->CreateWaveformOverview(waveform, 2), bins_t({{10.0, 40.0}, {20.0, 30.0}}));
+
+  // change of the point is seen by the cached envelope
+  waveform->GetDataItem()->GetPoint(0)->SetY(50.0);
+  EXPECT_EQ(handler->CreateWaveformOverview(waveform, 2), bins_t({{40.0, 50.0}, {20.0, 30.0}}));
+  EXPECT_DOUBLE_EQ(handler->GetWaveformStatistics(waveform).mean_y, 35.0);
+
+  // packed waveform keeps its overview
+  waveform->SetDisplayed(false);
+  handler->UpdatePackedWaveforms();
+  ASSERT_TRUE(handler->IsWaveformPacked(waveform));
+  EXPECT_EQ(handler->CreateWaveformOverview(waveform, 2), bins_t({{40.0, 50.0}, {20.0, 30.0}}));
+  EXPECT_EQ(handler->GetWaveformStatistics(waveform).count, 4);
+}
+
 }  // namespace sup::gui::test
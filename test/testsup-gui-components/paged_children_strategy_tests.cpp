@@ -0,0 +1,216 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/viewmodel/paged_children_strategy.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+
+#include <gtest/gtest.h>
+
+namespace sup::gui::test
+{
+
+//! Testing PagedChildrenStrategy class.
+
+class PagedChildrenStrategyTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Test strategy reporting all children of AnyValueItem.
+   */
+  class TestStrategy : public mvvm::IChildrenStrategy
+  {
+  public:
+    std::vector<mvvm::SessionItem*> GetChildren(const mvvm::SessionItem* item) const override
+    {
+      std::vector<mvvm::SessionItem*> result;
+      if (auto anyvalue_item = dynamic_cast<const AnyValueItem*>(item); anyvalue_item)
+      {
+        for (auto child : anyvalue_item->GetChildren())
+        {
+          result.push_back(child);
+        }
+      }
+      return result;
+    }
+  };
+
+  static std::unique_ptr<PagedChildrenStrategy> CreateStrategy(int page_size)
+  {
+    return std::make_unique<PagedChildrenStrategy>(std::make_unique<TestStrategy>(), page_size);
+  }
+
+  /**
+   * @brief Creates array with the given number of scalars.
+   */
+  static std::unique_ptr<AnyValueArrayItem> CreateArray(int size)
+  {
+    auto result = std::make_unique<AnyValueArrayItem>();
+    for (int index = 0; index < size; ++index)
+    {
+      (void)result->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+    }
+    return result;
+  }
+};
+
+TEST_F(PagedChildrenStrategyTest, SmallParent)
+{
+  auto strategy = CreateStrategy(2);
+  EXPECT_EQ(strategy->GetPageSize(), 2);
+
+  auto array = CreateArray(2);
+  auto children = array->GetChildren();
+
+  // parent isn't known yet
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+
+  EXPECT_EQ(strategy->GetChildren(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(0), children.at(1)}));
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+  EXPECT_TRUE(strategy->FetchMore(array.get()).empty());
+  EXPECT_TRUE(strategy->IsExposed(array.get(), 1));
+
+  // parent which was once fully exposed stays so
+  (void)array->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+  EXPECT_EQ(strategy->GetChildren(array.get()).size(), 3);
+  EXPECT_TRUE(strategy->IsExposed(array.get(), 2));
+}
+
+TEST_F(PagedChildrenStrategyTest, LargeParent)
+{
+  auto strategy = CreateStrategy(2);
+
+  auto array = CreateArray(5);
+  auto children = array->GetChildren();
+
+  EXPECT_TRUE(strategy->GetChildren(array.get()).empty());
+  EXPECT_TRUE(strategy->CanFetchMore(array.get()));
+  EXPECT_FALSE(strategy->IsExposed(array.get(), 0));
+
+  EXPECT_EQ(strategy->FetchMore(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(0), children.at(1)}));
+  EXPECT_EQ(strategy->GetChildren(array.get()).size(), 2);
+  EXPECT_TRUE(strategy->IsExposed(array.get(), 1));
+  EXPECT_FALSE(strategy->IsExposed(array.get(), 2));
+
+  EXPECT_EQ(strategy->FetchMore(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(2), children.at(3)}));
+  EXPECT_TRUE(strategy->CanFetchMore(array.get()));
+
+  EXPECT_EQ(strategy->FetchMore(array.get()), std::vector<mvvm::SessionItem*>({children.at(4)}));
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+  EXPECT_EQ(strategy->GetChildren(array.get()).size(), 5);
+
+  // forgetting the parent, it will be paged again
+  strategy->Reset();
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+  EXPECT_TRUE(strategy->GetChildren(array.get()).empty());
+  EXPECT_TRUE(strategy->CanFetchMore(array.get()));
+}
+
+TEST_F(PagedChildrenStrategyTest, InsertIntoPartiallyExposedParent)
+{
+  auto strategy = CreateStrategy(2);
+
+  auto array = CreateArray(5);
+  (void)strategy->GetChildren(array.get());
+  (void)strategy->FetchMore(array.get());
+
+  // child inserted between exposed children becomes exposed too
+  auto middle_child = array->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Default(1));
+  strategy->OnChildInserted(array.get(), 1);
+  auto children = array->GetChildren();
+  EXPECT_EQ(strategy->GetChildren(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(0), middle_child, children.at(2)}));
+
+  // child inserted after exposed children waits for the next page
+  (void)array->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Default(4));
+  strategy->OnChildInserted(array.get(), 4);
+  EXPECT_EQ(strategy->GetChildren(array.get()).size(), 3);
+
+  // next page continues exactly after the last exposed child
+  children = array->GetChildren();
+  EXPECT_EQ(strategy->FetchMore(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(3), children.at(4)}));
+  EXPECT_EQ(strategy->FetchMore(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(5), children.at(6)}));
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+}
+
+TEST_F(PagedChildrenStrategyTest, RemoveFromPartiallyExposedParent)
+{
+  auto strategy = CreateStrategy(2);
+
+  auto array = CreateArray(5);
+  (void)strategy->GetChildren(array.get());
+  (void)strategy->FetchMore(array.get());
+
+  // removal of exposed child, next child doesn't become exposed silently
+  auto child = array->GetChildren().at(0);
+  strategy->OnAboutToRemoveItem(child);
+  (void)array->TakeItem(mvvm::TagIndex::Default(0));
+  strategy->OnChildRemoved(array.get(), 0);
+  auto children = array->GetChildren();
+  EXPECT_EQ(strategy->GetChildren(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(0)}));
+
+  // removal of not exposed child doesn't change exposed children
+  strategy->OnAboutToRemoveItem(children.at(2));
+  (void)array->TakeItem(mvvm::TagIndex::Default(2));
+  strategy->OnChildRemoved(array.get(), 2);
+  children = array->GetChildren();
+  EXPECT_EQ(strategy->GetChildren(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(0)}));
+
+  EXPECT_EQ(strategy->FetchMore(array.get()),
+            std::vector<mvvm::SessionItem*>({children.at(1), children.at(2)}));
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+}
+
+TEST_F(PagedChildrenStrategyTest, ForgetRemovedParent)
+{
+  auto strategy = CreateStrategy(2);
+
+  auto array = CreateArray(0);
+  auto inner_array = array->InsertItem<AnyValueArrayItem>(mvvm::TagIndex::Append());
+  for (int index = 0; index < 5; ++index)
+  {
+    (void)inner_array->InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+  }
+  (void)strategy->GetChildren(array.get());
+  (void)strategy->GetChildren(inner_array);
+  EXPECT_TRUE(strategy->CanFetchMore(inner_array));
+
+  // removal of the outer array forgets the inner one
+  strategy->OnAboutToRemoveItem(array.get());
+  EXPECT_FALSE(strategy->CanFetchMore(inner_array));
+}
+
+TEST_F(PagedChildrenStrategyTest, ZeroPageSize)
+{
+  auto strategy = CreateStrategy(0);
+
+  auto array = CreateArray(5);
+  EXPECT_EQ(strategy->GetChildren(array.get()).size(), 5);
+  EXPECT_FALSE(strategy->CanFetchMore(array.get()));
+}
+
+}  // namespace sup::gui::test
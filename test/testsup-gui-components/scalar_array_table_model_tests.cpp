@@ -0,0 +1,136 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/viewmodel/scalar_array_table_model.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+
+#include <mvvm/model/application_model.h>
+
+#include <sup/dto/anytype.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+
+namespace sup::gui::test
+{
+
+//! Testing ScalarArrayTableModel class.
+
+class ScalarArrayTableModelTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Inserts packed array with the given number of int32 elements equal to their index.
+   */
+  AnyValueScalarArrayItem* InsertArray(int size)
+  {
+    auto result = m_model.InsertItem<AnyValueScalarArrayItem>();
+    ScalarArrayBuffer buffer(sup::dto::kInt32TypeName, static_cast<std::size_t>(size));
+    for (int index = 0; index < size; ++index)
+    {
+      buffer.SetElement(static_cast<std::size_t>(index), mvvm::variant_t(mvvm::int32{index}));
+    }
+    result->SetBuffer(buffer);
+    return result;
+  }
+
+  mvvm::ApplicationModel m_model;
+};
+
+TEST_F(ScalarArrayTableModelTest, InitialState)
+{
+  const ScalarArrayTableModel view_model;
+  EXPECT_EQ(view_model.GetItem(), nullptr);
+  EXPECT_EQ(view_model.rowCount(), 0);
+  EXPECT_EQ(view_model.columnCount(), 1);
+  EXPECT_FALSE(view_model.canFetchMore(QModelIndex()));
+}
+
+TEST_F(ScalarArrayTableModelTest, SmallArray)
+{
+  auto array = InsertArray(3);
+
+  ScalarArrayTableModel view_model;
+  view_model.SetItem(array);
+  EXPECT_EQ(view_model.GetItem(), array);
+  EXPECT_EQ(view_model.rowCount(), 3);
+  EXPECT_FALSE(view_model.canFetchMore(QModelIndex()));
+
+  EXPECT_EQ(view_model.data(view_model.index(2, 0)).toInt(), 2);
+  EXPECT_EQ(view_model.headerData(2, Qt::Vertical).toInt(), 2);
+  EXPECT_TRUE(view_model.flags(view_model.index(2, 0)) & Qt::ItemIsEditable);
+
+  view_model.SetItem(nullptr);
+  EXPECT_EQ(view_model.rowCount(), 0);
+}
+
+//! Rows of large arrays are reported page by page.
+
+TEST_F(ScalarArrayTableModelTest, FetchMore)
+{
+  auto array = InsertArray(25);
+
+  ScalarArrayTableModel view_model(10);
+  view_model.SetItem(array);
+  EXPECT_EQ(view_model.rowCount(), 10);
+  EXPECT_TRUE(view_model.canFetchMore(QModelIndex()));
+
+  QSignalSpy spy_inserted(&view_model, &QAbstractItemModel::rowsInserted);
+
+  view_model.fetchMore(QModelIndex());
+  EXPECT_EQ(view_model.rowCount(), 20);
+  EXPECT_EQ(spy_inserted.count(), 1);
+
+  view_model.fetchMore(QModelIndex());
+  EXPECT_EQ(view_model.rowCount(), 25);
+  EXPECT_FALSE(view_model.canFetchMore(QModelIndex()));
+  EXPECT_EQ(view_model.data(view_model.index(24, 0)).toInt(), 24);
+
+  // refresh starts from the first page again
+  view_model.Refresh();
+  EXPECT_EQ(view_model.rowCount(), 10);
+}
+
+//! Edited element is written back to the item, values out of range are rejected.
+
+TEST_F(ScalarArrayTableModelTest, SetData)
+{
+  auto array = InsertArray(3);
+
+  ScalarArrayTableModel view_model;
+  view_model.SetItem(array);
+
+  QSignalSpy spy_data_changed(&view_model, &QAbstractItemModel::dataChanged);
+
+  EXPECT_TRUE(view_model.setData(view_model.index(1, 0), QVariant(42), Qt::EditRole));
+  EXPECT_EQ(view_model.data(view_model.index(1, 0)).toInt(), 42);
+  EXPECT_EQ(array->GetBuffer().GetElement(1), mvvm::variant_t(mvvm::int32{42}));
+  EXPECT_EQ(spy_data_changed.count(), 1);
+
+  EXPECT_FALSE(view_model.setData(view_model.index(1, 0), QVariant(qlonglong{1} << 40),
+                                  Qt::EditRole));
+  EXPECT_FALSE(view_model.setData(view_model.index(1, 0), QVariant("abc"), Qt::EditRole));
+  EXPECT_EQ(array->GetBuffer().GetElement(1), mvvm::variant_t(mvvm::int32{42}));
+  EXPECT_EQ(spy_data_changed.count(), 1);
+}
+
+}  // namespace sup::gui::test
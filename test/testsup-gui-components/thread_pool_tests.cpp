@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/tasks/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+//! Testing ThreadPool class.
+
+class ThreadPoolTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Submits a job which blocks the thread until the returned flag is set.
+   */
+  static std::shared_ptr<std::atomic<bool>> BlockThread(ThreadPool& pool)
+  {
+    auto is_released = std::make_shared<std::atomic<bool>>(false);
+    auto is_started = std::make_shared<std::atomic<bool>>(false);
+    pool.Submit(
+        [is_released, is_started]()
+        {
+          is_started->store(true);
+          while (!is_released->load())
+          {
+            std::this_thread::yield();
+          }
+        },
+        TaskPriority::kHigh);
+
+    while (!is_started->load())
+    {
+      std::this_thread::yield();
+    }
+    return is_released;
+  }
+};
+
+TEST_F(ThreadPoolTest, InitialState)
+{
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.GetThreadCount(), 3);
+  EXPECT_EQ(pool.GetPendingCount(), 0);
+
+  ThreadPool default_pool;
+  EXPECT_GE(default_pool.GetThreadCount(), 1);
+
+  // nothing to wait for
+  pool.WaitForIdle();
+}
+
+TEST_F(ThreadPoolTest, ManyShortJobs)
+{
+  const int job_count = 10000;
+  std::atomic<int> counter{0};
+
+  ThreadPool pool(4);
+  for (int index = 0; index < job_count; ++index)
+  {
+    pool.Submit([&counter]() { ++counter; });
+  }
+  pool.WaitForIdle();
+
+  EXPECT_EQ(counter.load(), job_count);
+  EXPECT_EQ(pool.GetPendingCount(), 0);
+}
+
+//! Jobs submitted from pool threads, so that idle threads have to steal them.
+
+TEST_F(ThreadPoolTest, NestedJobs)
+{
+  const int job_count = 100;
+  std::atomic<int> counter{0};
+
+  ThreadPool pool(4);
+  for (int index = 0; index < job_count; ++index)
+  {
+    pool.Submit(
+        [&counter, &pool, job_count]()
+        {
+          for (int nested_index = 0; nested_index < job_count; ++nested_index)
+          {
+            pool.Submit([&counter]() { ++counter; });
+          }
+          ++counter;
+        });
+  }
+  pool.WaitForIdle();
+
+  EXPECT_EQ(counter.load(), job_count * job_count + job_count);
+}
+
+TEST_F(ThreadPoolTest, Priorities)
+{
+  ThreadPool pool(1);
+  auto is_released = BlockThread(pool);
+
+  std::mutex mutex;
+  std::vector<TaskPriority> order;
+  auto record = [&mutex, &order](TaskPriority priority)
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(priority);
+  };
+
+  for (auto priority : {TaskPriority::kLow, TaskPriority::kNormal, TaskPriority::kHigh})
+  {
+    pool.Submit([record, priority]() { record(priority); }, priority);
+  }
+  EXPECT_EQ(pool.GetPendingCount(), 4);
+
+  is_released->store(true);
+  pool.WaitForIdle();
+
+  const std::vector<TaskPriority> expected(
+      {TaskPriority::kHigh, TaskPriority::kNormal, TaskPriority::kLow});
+  EXPECT_EQ(order, expected);
+}
+
+TEST_F(ThreadPoolTest, ThrowingJob)
+{
+  std::atomic<int> counter{0};
+
+  ThreadPool pool(1);
+  pool.Submit([]() { throw std::runtime_error("failed"); });
+  pool.Submit([&counter]() { ++counter; });
+  pool.WaitForIdle();
+
+  EXPECT_EQ(counter.load(), 1);
+}
+
+//! Destroying the pool while jobs are still queued, they are run before threads are joined.
+
+TEST_F(ThreadPoolTest, DestroyWithQueuedJobs)
+{
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool(2);
+    for (int index = 0; index < 1000; ++index)
+    {
+      pool.Submit(
+          [&counter, &pool, index]()
+          {
+            if (index % 10 == 0)
+            {
+              pool.Submit([&counter]() { ++counter; });
+            }
+            ++counter;
+          });
+    }
+  }
+  EXPECT_EQ(counter.load(), 1100);
+}
+
+}  // namespace sup::gui::test
@@ -131,4 +131,58 @@ TEST_F(WaveformDisplayControllerTest, DisplaySelectedMode)
   EXPECT_FALSE(waveform1->IsDisplayed());
 }
 
+//! In DisplaySelected mode, only inserted waveform gets its display status updated.
+TEST_F(WaveformDisplayControllerTest, InsertWaveformInDisplaySelectedMode)
+{
+  mvvm::ApplicationModel model;
+  auto viewport = model.InsertItem<mvvm::ChartViewportItem>();
+
+  auto waveform0 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+  auto waveform1 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+
+  WaveformDisplayController controller(viewport);
+  controller.SetDisplayMode(WaveformDisplayMode::kDisplaySelected);
+  controller.SetSelected(waveform0);
+
+  // user shows another waveform via property editor
+  waveform1->SetDisplayed(true);
+
+  // new waveform is hidden, display status of others stays as it was
+  auto waveform2 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+  EXPECT_TRUE(waveform0->IsDisplayed());
+  EXPECT_TRUE(waveform1->IsDisplayed());
+  EXPECT_FALSE(waveform2->IsDisplayed());
+
+  // waveform inserted elsewhere is ignored
+  auto other_viewport = model.InsertItem<mvvm::ChartViewportItem>();
+  auto waveform3 =
+      model.InsertItem<mvvm::LineSeriesItem>(other_viewport, mvvm::TagIndex::Append());
+  EXPECT_TRUE(waveform3->IsDisplayed());
+}
+
+//! Removal of selected waveform resets the selection.
+TEST_F(WaveformDisplayControllerTest, RemoveSelectedWaveform)
+{
+  mvvm::ApplicationModel model;
+  auto viewport = model.InsertItem<mvvm::ChartViewportItem>();
+
+  auto waveform0 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+  auto waveform1 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+
+  WaveformDisplayController controller(viewport);
+  controller.SetDisplayMode(WaveformDisplayMode::kDisplaySelected);
+  controller.SetSelected(waveform0);
+
+  model.RemoveItem(waveform0);
+  EXPECT_FALSE(waveform1->IsDisplayed());
+
+  auto waveform2 = model.InsertItem<mvvm::LineSeriesItem>(viewport, mvvm::TagIndex::Append());
+  EXPECT_FALSE(waveform2->IsDisplayed());
+
+  // switching to DisplayAll mode shows everything
+  controller.SetDisplayMode(WaveformDisplayMode::kDisplayAll);
+  EXPECT_TRUE(waveform1->IsDisplayed());
+  EXPECT_TRUE(waveform2->IsDisplayed());
+}
+
 }  // namespace sup::gui::test
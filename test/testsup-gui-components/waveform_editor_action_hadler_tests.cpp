@@ -22,7 +22,9 @@
 
 #include <sup/gui/plotting/waveform_editor_context.h>
 #include <sup/gui/plotting/waveform_helper.h>
+#include <sup/gui/plotting/waveform_transforms.h>
 
+#include <mvvm/commands/i_command_stack.h>
 #include <mvvm/model/application_model.h>
 #include <mvvm/standarditems/chart_viewport_item.h>
 #include <mvvm/standarditems/line_series_data_item.h>
@@ -32,6 +34,7 @@
 #include <gtest/gtest.h>
 
 #include <QSignalSpy>
+#include <algorithm>
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 Q_DECLARE_METATYPE(mvvm::SessionItem*)
@@ -256,4 +259,250 @@ TEST_F(WaveformEditorActionHandlerTest, AddBeforeNonEmptyLineSeriesWHenNothinIsS
   EXPECT_EQ(y, 10.0);
 }
 
+//! Scaling the whole waveform and undoing it in one step.
+
+TEST_F(WaveformEditorActionHandlerTest, ApplyTransformToWholeWaveform)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}});
+  m_model.SetUndoEnabled(true);
+
+  // a single point selected, transform is applied to all points
+  auto action_handler = CreateActionHandler(m_line_series_item, m_data_item->GetPoint(1));
+
+  action_handler->ApplyTransform(CreateScaleTransform(2.0), "Scale");
+
+  std::vector<std::pair<double, double>> expected({{1.0, 20.0}, {2.0, 40.0}, {3.0, 60.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  // single undo restores all points
+  m_model.GetCommandStack()->Undo();
+  expected = {{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+}
+
+//! Offset applied to the range of selected points.
+
+TEST_F(WaveformEditorActionHandlerTest, ApplyTransformToSelectedRange)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+  m_model.SetUndoEnabled(true);
+
+  auto context = CreateContext(m_line_series_item, m_data_item->GetPoint(1));
+  auto selected_points = std::vector<mvvm::PointItem*>{m_data_item->GetPoint(2),
+                                                       m_data_item->GetPoint(1)};
+  context.selected_points_callback = [selected_points]() { return selected_points; };
+  WaveformEditorActionHandler action_handler(context);
+
+  action_handler.ApplyTransform(CreateOffsetTransform(1.0), "Offset");
+
+  std::vector<std::pair<double, double>> expected(
+      {{1.0, 10.0}, {2.0, 21.0}, {3.0, 31.0}, {4.0, 40.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  m_model.GetCommandStack()->Undo();
+  expected = {{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+}
+
+//! Resampling changes the number of points and can be undone in one step.
+
+TEST_F(WaveformEditorActionHandlerTest, ApplyResampleTransform)
+{
+  m_data_item->SetWaveform({{0.0, 0.0}, {2.0, 20.0}});
+  m_model.SetUndoEnabled(true);
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+
+  action_handler->ApplyTransform(CreateResampleTransform(0.5), "Resample");
+
+  std::vector<std::pair<double, double>> expected(
+      {{0.0, 0.0}, {0.5, 5.0}, {1.0, 10.0}, {1.5, 15.0}, {2.0, 20.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  m_model.GetCommandStack()->Undo();
+  expected = {{0.0, 0.0}, {2.0, 20.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+}
+
+//! Replacing waveform with generated points.
+
+TEST_F(WaveformEditorActionHandlerTest, ReplaceWaveform)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}});
+  m_model.SetUndoEnabled(true);
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+
+  action_handler->ReplaceWaveform(GenerateRamp(0.0, 1.0, 3, 0.0, 2.0), "Ramp");
+
+  std::vector<std::pair<double, double>> expected({{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  m_model.GetCommandStack()->Undo();
+  expected = {{1.0, 10.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+}
+
+//! Switching sorted mode on sorts points as a single command.
+
+TEST_F(WaveformEditorActionHandlerTest, SetSortedMode)
+{
+  m_data_item->SetWaveform({{3.0, 30.0}, {1.0, 10.0}, {2.0, 20.0}});
+  m_model.SetUndoEnabled(true);
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  EXPECT_FALSE(action_handler->IsSortedMode());
+
+  action_handler->SetSortedMode(true);
+  EXPECT_TRUE(action_handler->IsSortedMode());
+  std::vector<std::pair<double, double>> expected({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  m_model.GetCommandStack()->Undo();
+  expected = {{3.0, 30.0}, {1.0, 10.0}, {2.0, 20.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+}
+
+//! Points are inserted according to x value in sorted mode, and appended otherwise.
+
+TEST_F(WaveformEditorActionHandlerTest, InsertPoint)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {3.0, 30.0}});
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  QSignalSpy spy_selection_request(action_handler.get(),
+                                   &WaveformEditorActionHandler::SelectItemRequest);
+
+  action_handler->InsertPoint(2.0, 20.0);
+  std::vector<std::pair<double, double>> expected({{1.0, 10.0}, {3.0, 30.0}, {2.0, 20.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+  EXPECT_EQ(GetSendItem(spy_selection_request), m_data_item->GetPoint(2));
+
+  m_data_item->SetWaveform({{1.0, 10.0}, {3.0, 30.0}});
+  action_handler->SetSortedMode(true);
+  action_handler->InsertPoint(2.0, 20.0);
+  expected = {{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}};
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+  EXPECT_EQ(GetSendItem(spy_selection_request), m_data_item->GetPoint(1));
+}
+
+//! Adding a point after selected one in sorted mode, when default x of a new point is beyond the
+//! next point.
+
+TEST_F(WaveformEditorActionHandlerTest, AddAfterInSortedMode)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {1.05, 20.0}});
+
+  auto action_handler = CreateActionHandler(m_line_series_item, m_data_item->GetPoint(0));
+  action_handler->SetSortedMode(true);
+  action_handler->OnAddColumnAfterRequest();
+
+  ASSERT_EQ(m_data_item->GetPointCount(), 3);
+  auto waveform = m_data_item->GetWaveform();
+  EXPECT_TRUE(std::is_sorted(waveform.begin(), waveform.end()));
+}
+
+//! Lookup of points by x in sorted and unsorted modes.
+
+TEST_F(WaveformEditorActionHandlerTest, FindPoints)
+{
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  EXPECT_EQ(action_handler->FindNearestPoint(1.0), nullptr);
+  EXPECT_TRUE(action_handler->FindPointsInRange(0.0, 1.0).empty());
+
+  m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+  for (auto sorted_mode : {false, true})
+  {
+    action_handler->SetSortedMode(sorted_mode);
+    EXPECT_EQ(action_handler->FindNearestPoint(2.8), m_data_item->GetPoint(2));
+    EXPECT_EQ(action_handler->FindPointsInRange(1.5, 3.0),
+              std::vector<mvvm::PointItem*>({m_data_item->GetPoint(1), m_data_item->GetPoint(2)}));
+  }
+}
+
+//! Points out of order in sorted mode, e.g. after undo of the sorting, are looked up linearly.
+
+TEST_F(WaveformEditorActionHandlerTest, FindPointsAfterUndoOfSorting)
+{
+  m_data_item->SetWaveform({{4.0, 40.0}, {1.0, 10.0}, {3.0, 30.0}, {2.0, 20.0}});
+  m_model.SetUndoEnabled(true);
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  action_handler->SetSortedMode(true);
+  EXPECT_EQ(action_handler->FindNearestPoint(2.8)->GetX(), 3.0);
+
+  m_model.GetCommandStack()->Undo();
+  ASSERT_TRUE(action_handler->IsSortedMode());
+  EXPECT_EQ(action_handler->FindNearestPoint(2.8), m_data_item->GetPoint(2));
+  EXPECT_EQ(action_handler->FindPointsInRange(1.5, 3.0),
+            std::vector<mvvm::PointItem*>({m_data_item->GetPoint(2), m_data_item->GetPoint(3)}));
+
+  // there is no sorted place for the new point, it is appended
+  action_handler->InsertPoint(2.5, 25.0);
+  EXPECT_EQ(m_data_item->GetPoint(4)->GetX(), 2.5);
+
+  // the point can't be put in order among unsorted points
+  auto point = m_data_item->GetPoint(0);
+  action_handler->RestoreSortedOrder(*point);
+  EXPECT_EQ(m_data_item->GetPoint(0), point);
+}
+
+//! Sorted inserts and changes of y values keep points sorted, change of x breaking the order is
+//! noticed.
+
+TEST_F(WaveformEditorActionHandlerTest, SortedOrderAfterChanges)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {3.0, 30.0}});
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  action_handler->SetSortedMode(true);
+
+  action_handler->InsertPoint(2.0, 20.0);
+  m_data_item->GetPoint(0)->SetY(100.0);
+  action_handler->InsertPoint(0.5, 5.0);
+  std::vector<std::pair<double, double>> expected(
+      {{0.5, 5.0}, {1.0, 100.0}, {2.0, 20.0}, {3.0, 30.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  // points are out of order, the new point is appended
+  m_data_item->GetPoint(0)->SetX(5.0);
+  action_handler->InsertPoint(1.5, 15.0);
+  EXPECT_EQ(m_data_item->GetPoint(4)->GetX(), 1.5);
+}
+
+//! Point with edited x value is moved to its place.
+
+TEST_F(WaveformEditorActionHandlerTest, RestoreSortedOrder)
+{
+  m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+
+  auto action_handler = CreateActionHandler(m_line_series_item, nullptr);
+  QSignalSpy spy_selection_request(action_handler.get(),
+                                   &WaveformEditorActionHandler::SelectItemRequest);
+
+  auto point = m_data_item->GetPoint(0);
+  point->SetX(3.5);
+
+  // nothing happens in unsorted mode
+  action_handler->RestoreSortedOrder(*point);
+  EXPECT_EQ(m_data_item->GetPoint(0), point);
+  EXPECT_EQ(spy_selection_request.count(), 0);
+
+  point->SetX(1.0);
+  action_handler->SetSortedMode(true);
+
+  point->SetX(3.5);
+  action_handler->RestoreSortedOrder(*point);
+  EXPECT_EQ(m_data_item->GetPoint(2), point);
+  EXPECT_EQ(GetSendItem(spy_selection_request), point);
+
+  std::vector<std::pair<double, double>> expected(
+      {{2.0, 20.0}, {3.0, 30.0}, {3.5, 10.0}, {4.0, 40.0}});
+  EXPECT_EQ(m_data_item->GetWaveform(), expected);
+
+  // point in place isn't moved
+  action_handler->RestoreSortedOrder(*point);
+  EXPECT_EQ(spy_selection_request.count(), 0);
+}
+
 }  // namespace sup::gui::test
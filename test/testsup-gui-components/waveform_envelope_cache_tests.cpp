@@ -0,0 +1,155 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_envelope_cache.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/container_item.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <gtest/gtest.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for WaveformEnvelopeCache class.
+ */
+class WaveformEnvelopeCacheTest : public ::testing::Test
+{
+public:
+  WaveformEnvelopeCacheTest()
+  {
+    m_container = m_model.InsertItem<mvvm::ContainerItem>();
+    m_data_item = m_model.InsertItem<mvvm::LineSeriesDataItem>(m_container);
+    m_data_item->SetWaveform({{1.0, 10.0}, {2.0, 40.0}, {3.0, 20.0}, {4.0, 30.0}});
+  }
+
+  mvvm::ApplicationModel m_model;
+  mvvm::ContainerItem* m_container{nullptr};
+  mvvm::LineSeriesDataItem* m_data_item{nullptr};
+};
+
+TEST_F(WaveformEnvelopeCacheTest, InitialState)
+{
+  EXPECT_THROW(WaveformEnvelopeCache(nullptr), NullArgumentException);
+
+  const WaveformEnvelopeCache cache(&m_model);
+  EXPECT_EQ(cache.GetModel(), &m_model);
+  EXPECT_EQ(cache.GetSize(), 0);
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), nullptr);
+}
+
+TEST_F(WaveformEnvelopeCacheTest, GetEnvelope)
+{
+  WaveformEnvelopeCache cache(&m_model);
+
+  const auto& envelope = cache.GetEnvelope(*m_data_item);
+  EXPECT_EQ(envelope.GetSize(), 4);
+  EXPECT_EQ(envelope.GetMinMax(0, 4), std::make_pair(10.0, 40.0));
+  EXPECT_EQ(cache.GetSize(), 1);
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), &envelope);
+
+  // second request is served from the cache
+  EXPECT_EQ(&cache.GetEnvelope(*m_data_item), &envelope);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+//! Change of y value updates the envelope in place, change of x doesn't affect it.
+TEST_F(WaveformEnvelopeCacheTest, PointChanged)
+{
+  WaveformEnvelopeCache cache(&m_model);
+  const auto& envelope = cache.GetEnvelope(*m_data_item);
+
+  m_data_item->GetPoint(0)->SetX(0.0);
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), &envelope);
+  EXPECT_EQ(envelope.GetMinMax(0, 4), std::make_pair(10.0, 40.0));
+
+  m_data_item->GetPoint(2)->SetY(-5.0);
+  m_data_item->GetPoint(3)->SetY(-6.0);
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), &envelope);
+
+  EXPECT_EQ(envelope.GetMinMax(2, 4), std::make_pair(-6.0, -5.0));
+  EXPECT_EQ(envelope.GetMinMax(0, 4), std::make_pair(-6.0, 40.0));
+  EXPECT_DOUBLE_EQ(envelope.GetStatistics().mean_y, 9.75);
+}
+
+//! Insertion and removal of points drops the envelope.
+TEST_F(WaveformEnvelopeCacheTest, PointsInsertedAndRemoved)
+{
+  WaveformEnvelopeCache cache(&m_model);
+
+  (void)cache.GetEnvelope(*m_data_item);
+  m_model.InsertItem<mvvm::PointItem>(m_data_item, mvvm::TagIndex::Append())->SetY(100.0);
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), nullptr);
+  EXPECT_EQ(cache.GetEnvelope(*m_data_item).GetMinMax(0, 5), std::make_pair(10.0, 100.0));
+
+  m_model.RemoveItem(m_data_item->GetPoint(4));
+  EXPECT_EQ(cache.FindEnvelope(m_data_item), nullptr);
+  EXPECT_EQ(cache.GetEnvelope(*m_data_item).GetSize(), 4);
+}
+
+//! Removal of the data item, or of its parent, removes the envelope.
+TEST_F(WaveformEnvelopeCacheTest, DataItemRemoved)
+{
+  WaveformEnvelopeCache cache(&m_model);
+
+  auto other_data_item = m_model.InsertItem<mvvm::LineSeriesDataItem>(m_container);
+  (void)cache.GetEnvelope(*m_data_item);
+  (void)cache.GetEnvelope(*other_data_item);
+  EXPECT_EQ(cache.GetSize(), 2);
+
+  m_model.RemoveItem(other_data_item);
+  EXPECT_EQ(cache.GetSize(), 1);
+  EXPECT_NE(cache.FindEnvelope(m_data_item), nullptr);
+
+  m_model.RemoveItem(m_container);
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+//! Envelope of values stored outside of points.
+TEST_F(WaveformEnvelopeCacheTest, InsertEnvelope)
+{
+  WaveformEnvelopeCache cache(&m_model);
+
+  auto other_data_item = m_model.InsertItem<mvvm::LineSeriesDataItem>(m_container);
+  const auto& envelope = cache.InsertEnvelope(other_data_item, WaveformEnvelope({1.0, 2.0}));
+  EXPECT_EQ(cache.FindEnvelope(other_data_item), &envelope);
+  EXPECT_EQ(&cache.GetEnvelope(*other_data_item), &envelope);
+
+  other_data_item->SetWaveform({{1.0, 5.0}});
+  EXPECT_EQ(cache.GetEnvelope(*other_data_item).GetSize(), 1);
+}
+
+TEST_F(WaveformEnvelopeCacheTest, ModelReset)
+{
+  WaveformEnvelopeCache cache(&m_model);
+  (void)cache.GetEnvelope(*m_data_item);
+
+  m_model.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+}  // namespace sup::gui::test
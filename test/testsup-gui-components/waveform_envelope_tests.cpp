@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_envelope.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for WaveformEnvelope class.
+ */
+class WaveformEnvelopeTest : public ::testing::Test
+{
+public:
+  using bins_t = std::vector<std::pair<double, double>>;
+};
+
+TEST_F(WaveformEnvelopeTest, InitialState)
+{
+  const WaveformEnvelope envelope;
+  EXPECT_EQ(envelope.GetSize(), 0);
+  EXPECT_EQ(envelope.GetLevelCount(), 0);
+  EXPECT_EQ(envelope.GetStatistics().count, 0);
+  EXPECT_TRUE(envelope.CreateOverview(10).empty());
+  EXPECT_THROW(envelope.GetMinMax(0, 1), RuntimeException);
+}
+
+TEST_F(WaveformEnvelopeTest, SinglePoint)
+{
+  const WaveformEnvelope envelope({42.0});
+  EXPECT_EQ(envelope.GetSize(), 1);
+  EXPECT_EQ(envelope.GetLevelCount(), 1);
+  EXPECT_EQ(envelope.GetMinMax(0, 1), std::make_pair(42.0, 42.0));
+
+  const auto statistics = envelope.GetStatistics();
+  EXPECT_EQ(statistics.count, 1);
+  EXPECT_DOUBLE_EQ(statistics.min_y, 42.0);
+  EXPECT_DOUBLE_EQ(statistics.max_y, 42.0);
+  EXPECT_DOUBLE_EQ(statistics.mean_y, 42.0);
+}
+
+TEST_F(WaveformEnvelopeTest, GetMinMax)
+{
+  const WaveformEnvelope envelope({3.0, 1.0, 4.0, 1.0, 5.0, 9.0, 2.0});
+  EXPECT_EQ(envelope.GetLevelCount(), 4);
+
+  EXPECT_EQ(envelope.GetMinMax(0, 7), std::make_pair(1.0, 9.0));
+  EXPECT_EQ(envelope.GetMinMax(0, 1), std::make_pair(3.0, 3.0));
+  EXPECT_EQ(envelope.GetMinMax(2, 3), std::make_pair(4.0, 4.0));
+  EXPECT_EQ(envelope.GetMinMax(2, 5), std::make_pair(1.0, 5.0));
+  EXPECT_EQ(envelope.GetMinMax(6, 7), std::make_pair(2.0, 2.0));
+  EXPECT_EQ(envelope.GetMinMax(4, 7), std::make_pair(2.0, 9.0));
+
+  EXPECT_THROW(envelope.GetMinMax(2, 2), RuntimeException);
+  EXPECT_THROW(envelope.GetMinMax(0, 8), RuntimeException);
+}
+
+//! Every range of points should give the same result as a direct pass over values.
+TEST_F(WaveformEnvelopeTest, GetMinMaxOfAllRanges)
+{
+  std::vector<double> values;
+  for (int index = 0; index < 37; ++index)
+  {
+    values.push_back(static_cast<double>((index * 17) % 23) - 11.0);
+  }
+  const WaveformEnvelope envelope(values);
+
+  for (std::size_t begin = 0; begin < values.size(); ++begin)
+  {
+    for (std::size_t end = begin + 1; end <= values.size(); ++end)
+    {
+      const auto [min_iter, max_iter] =
+          std::minmax_element(values.begin() + begin, values.begin() + end);
+      EXPECT_EQ(envelope.GetMinMax(begin, end), std::make_pair(*min_iter, *max_iter));
+    }
+  }
+}
+
+TEST_F(WaveformEnvelopeTest, GetStatistics)
+{
+  const WaveformEnvelope envelope({1.0, -2.0, 4.0, 5.0});
+
+  const auto statistics = envelope.GetStatistics();
+  EXPECT_EQ(statistics.count, 4);
+  EXPECT_DOUBLE_EQ(statistics.min_y, -2.0);
+  EXPECT_DOUBLE_EQ(statistics.max_y, 5.0);
+  EXPECT_DOUBLE_EQ(statistics.mean_y, 2.0);
+}
+
+TEST_F(WaveformEnvelopeTest, CreateOverview)
+{
+  const WaveformEnvelope envelope({3.0, 1.0, 4.0, 1.0, 5.0, 9.0});
+
+  EXPECT_EQ(envelope.CreateOverview(1), bins_t({{1.0, 9.0}}));
+  EXPECT_EQ(envelope.CreateOverview(2), bins_t({{1.0, 4.0}, {1.0, 9.0}}));
+  EXPECT_EQ(envelope.CreateOverview(4), bins_t({{3.0, 3.0}, {1.0, 4.0}, {1.0, 1.0}, {5.0, 9.0}}));
+
+  // number of bins is limited by the number of points
+  EXPECT_EQ(envelope.CreateOverview(10).size(), 6);
+  EXPECT_TRUE(envelope.CreateOverview(0).empty());
+}
+
+TEST_F(WaveformEnvelopeTest, SetValue)
+{
+  WaveformEnvelope envelope({3.0, 1.0, 4.0, 1.0, 5.0});
+
+  envelope.SetValue(4, -1.0);
+  EXPECT_EQ(envelope.GetMinMax(0, 5), std::make_pair(-1.0, 4.0));
+  EXPECT_EQ(envelope.GetMinMax(0, 4), std::make_pair(1.0, 4.0));
+
+  envelope.SetValue(1, 10.0);
+  EXPECT_EQ(envelope.GetMinMax(0, 2), std::make_pair(3.0, 10.0));
+  EXPECT_EQ(envelope.GetMinMax(2, 5), std::make_pair(-1.0, 4.0));
+  EXPECT_DOUBLE_EQ(envelope.GetStatistics().mean_y, 17.0 / 5.0);
+
+  EXPECT_THROW(envelope.SetValue(5, 0.0), RuntimeException);
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,175 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/components/waveform_file_tasks.h"
+
+#include <sup/gui/model/anyvalue_utils.h>
+#include <sup/gui/tasks/cancellation_token.h>
+#include <sup/gui/tasks/task_context.h>
+
+#include <mvvm/test/test_helper.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+#include <testutils/folder_test.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for ImportWaveformTask, ExportWaveformTask and ExportResampledWaveformsTask classes.
+ */
+class WaveformFileTasksTest : public test::FolderTest
+{
+public:
+  WaveformFileTasksTest() : test::FolderTest("WaveformFileTasksTest") {}
+
+  static WaveformBuffer CreateWaveform() { return GenerateRamp(0.0, 0.5, 1000, 0.0, 1.0); }
+
+  static WaveformFileOptions CreateOptions(WaveformFileFormat format)
+  {
+    WaveformFileOptions result;
+    result.format = format;
+    return result;
+  }
+
+  static bool IsFileExist(const std::string& file_path)
+  {
+    return static_cast<bool>(std::ifstream(file_path));
+  }
+};
+
+//! Exporting waveform and importing it back, for both file formats.
+TEST_F(WaveformFileTasksTest, ExportAndImport)
+{
+  for (auto format : {WaveformFileFormat::kCsv, WaveformFileFormat::kBinary})
+  {
+    const auto file_path = GetFilePath(format == WaveformFileFormat::kCsv ? "a.csv" : "a.bin");
+    const auto options = CreateOptions(format);
+
+    std::vector<int> progress;
+    TaskContext context(CancellationToken{}, [&progress](int value) { progress.push_back(value); });
+
+    ExportWaveformTask export_task(CreateWaveform(), file_path, options);
+    EXPECT_EQ(export_task.GetFileName(), file_path);
+    export_task.Run(context);
+    EXPECT_TRUE(export_task.GetErrorMessage().empty());
+    EXPECT_FALSE(IsFileExist(file_path + ".part"));
+
+    ImportWaveformTask import_task(file_path, options);
+    EXPECT_EQ(import_task.GetFileName(), file_path);
+    import_task.Run(context);
+    EXPECT_TRUE(import_task.GetErrorMessage().empty());
+    EXPECT_EQ(GetWaveformPoints(import_task.TakeWaveform()), GetWaveformPoints(CreateWaveform()));
+
+    // progress is growing and ends at 100 for each of tasks
+    ASSERT_FALSE(progress.empty());
+    EXPECT_EQ(progress.back(), 100);
+  }
+}
+
+//! Cancelled tasks don't produce neither result, nor error.
+TEST_F(WaveformFileTasksTest, CancelledTasks)
+{
+  const auto file_path = GetFilePath("CancelledTasks.csv");
+  mvvm::test::CreateTextFile(file_path, "1,2\n");
+
+  CancellationToken token;
+  token.Cancel();
+  TaskContext context(token);
+
+  ImportWaveformTask import_task(file_path, CreateOptions(WaveformFileFormat::kCsv));
+  import_task.Run(context);
+  EXPECT_TRUE(import_task.GetErrorMessage().empty());
+  EXPECT_EQ(import_task.TakeWaveform().GetSize(), 0);
+
+  // target file is untouched
+  ExportWaveformTask export_task(CreateWaveform(), file_path,
+                                 CreateOptions(WaveformFileFormat::kCsv));
+  export_task.Run(context);
+  EXPECT_TRUE(export_task.GetErrorMessage().empty());
+  std::ifstream input(file_path);
+  std::stringstream content;
+  content << input.rdbuf();
+  EXPECT_EQ(content.str(), "1,2\n");
+}
+
+//! Import from non-existing or broken file reports an error instead of throwing.
+TEST_F(WaveformFileTasksTest, ImportErrors)
+{
+  TaskContext context{CancellationToken{}};
+
+  ImportWaveformTask missing_task(GetFilePath("non-existing.csv"),
+                                  CreateOptions(WaveformFileFormat::kCsv));
+  missing_task.Run(context);
+  EXPECT_FALSE(missing_task.GetErrorMessage().empty());
+
+  const auto file_path = GetFilePath("ImportErrors.csv");
+  mvvm::test::CreateTextFile(file_path, "x,y\n1,2\n3,abc\n");
+  ImportWaveformTask broken_task(file_path, CreateOptions(WaveformFileFormat::kCsv));
+  broken_task.Run(context);
+  EXPECT_NE(broken_task.GetErrorMessage().find("line 3"), std::string::npos);
+
+  ImportWaveformTask binary_task(file_path, CreateOptions(WaveformFileFormat::kBinary));
+  binary_task.Run(context);
+  EXPECT_FALSE(binary_task.GetErrorMessage().empty());
+}
+
+//! Two waveforms with different x values are written as a single struct on merged time base.
+TEST_F(WaveformFileTasksTest, ExportResampled)
+{
+  const auto file_path = GetFilePath("ExportResampled.json");
+
+  std::vector<int> progress;
+  TaskContext context(CancellationToken{}, [&progress](int value) { progress.push_back(value); });
+
+  std::vector<WaveformBuffer> waveforms{CreateWaveformBuffer({{0.0, 0.0}, {2.0, 2.0}}),
+                                        CreateWaveformBuffer({{1.0, 10.0}, {3.0, 30.0}})};
+  ExportResampledWaveformsTask task(waveforms, {"a", "b"}, file_path, {});
+  EXPECT_EQ(task.GetFileName(), file_path);
+  task.Run(context);
+  EXPECT_TRUE(task.GetErrorMessage().empty());
+  ASSERT_FALSE(progress.empty());
+  EXPECT_EQ(progress.back(), 100);
+  EXPECT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+
+  const auto anyvalue = AnyValueFromJSONFile(file_path);
+  ASSERT_EQ(anyvalue["time"].NumberOfElements(), 4);
+  EXPECT_EQ(anyvalue["time"][3].As<double>(), 3.0);
+  EXPECT_EQ(anyvalue["a"][1].As<double>(), 1.0);
+  EXPECT_EQ(anyvalue["a"][3].As<double>(), 2.0);
+  EXPECT_EQ(anyvalue["b"][0].As<double>(), 10.0);
+  EXPECT_EQ(anyvalue["b"][2].As<double>(), 20.0);
+
+  // wrong time step is reported as an error
+  WaveformResamplingOptions options;
+  options.dt = -1.0;
+  ExportResampledWaveformsTask failed_task(waveforms, {"a", "b"}, file_path, options);
+  failed_task.Run(context);
+  EXPECT_FALSE(failed_task.GetErrorMessage().empty());
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_file_utils.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+
+namespace sup::gui::test
+{
+
+using points_t = std::vector<std::pair<double, double>>;
+
+//! Testing parsers and writers from waveform_file_utils.h
+
+class WaveformFileUtilsTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Parses text with CSV parser, feeding it in chunks of given size.
+   */
+  static points_t ParseCsv(const std::string& text, std::size_t chunk_size,
+                           const WaveformFileOptions& options = {})
+  {
+    WaveformCsvParser parser(options);
+    for (std::size_t pos = 0; pos < text.size(); pos += chunk_size)
+    {
+      const auto size = std::min(chunk_size, text.size() - pos);
+      if (!parser.Feed(text.data() + pos, size))
+      {
+        break;
+      }
+    }
+    if (!parser.Finish())
+    {
+      throw RuntimeException(parser.GetErrorMessage());
+    }
+    return GetWaveformPoints(parser.TakeBuffer());
+  }
+
+  static WaveformFileOptions CreateCsvOptions(char delimiter, std::size_t x_column,
+                                              std::size_t y_column)
+  {
+    WaveformFileOptions result;
+    result.delimiter = delimiter;
+    result.x_column = x_column;
+    result.y_column = y_column;
+    return result;
+  }
+};
+
+TEST_F(WaveformFileUtilsTest, GetWaveformFileOptions)
+{
+  EXPECT_EQ(GetWaveformFileOptions("a.csv").format, WaveformFileFormat::kCsv);
+  EXPECT_EQ(GetWaveformFileOptions("a.csv").delimiter, ',');
+  EXPECT_EQ(GetWaveformFileOptions("/path.bin/a").format, WaveformFileFormat::kCsv);
+  EXPECT_EQ(GetWaveformFileOptions("a.BIN").format, WaveformFileFormat::kBinary);
+  EXPECT_EQ(GetWaveformFileOptions("a.f64").format, WaveformFileFormat::kBinary);
+  EXPECT_EQ(GetWaveformFileOptions("a.tsv").delimiter, '\t');
+}
+
+//! Parsing of simple CSV fed in chunks of different size.
+
+TEST_F(WaveformFileUtilsTest, ParseCsvInChunks)
+{
+  const std::string text("time,value\n# comment\n1.0,10\n\n 2.5 , -2e3 \r\n+3,0.125");
+  const points_t expected({{1.0, 10.0}, {2.5, -2000.0}, {3.0, 0.125}});
+
+  for (std::size_t chunk_size : {1, 2, 3, 7, 100})
+  {
+    EXPECT_EQ(ParseCsv(text, chunk_size), expected);
+  }
+
+  EXPECT_TRUE(ParseCsv("", 10).empty());
+}
+
+TEST_F(WaveformFileUtilsTest, ParseCsvColumnsAndDelimiters)
+{
+  EXPECT_EQ(ParseCsv("a;b;c\n1;2;3\n4;5;6\n", 4, CreateCsvOptions(';', 2, 0)),
+            points_t({{3.0, 1.0}, {6.0, 4.0}}));
+
+  // consecutive whitespace delimiters are merged
+  EXPECT_EQ(ParseCsv("  1 \t 2\n3\t\t4\n", 3, CreateCsvOptions('\t', 0, 1)),
+            points_t({{1.0, 2.0}, {3.0, 4.0}}));
+  EXPECT_EQ(ParseCsv("1   2\n3 4\n", 3, CreateCsvOptions(' ', 0, 1)),
+            points_t({{1.0, 2.0}, {3.0, 4.0}}));
+
+  // empty field in the middle is not skipped for comma delimiter
+  EXPECT_EQ(ParseCsv("1,,2\n", 3, CreateCsvOptions(',', 0, 2)), points_t({{1.0, 2.0}}));
+}
+
+TEST_F(WaveformFileUtilsTest, ParseCsvErrors)
+{
+  // only the first unparsable line is taken as a header
+  EXPECT_THROW(ParseCsv("x,y\nx,y\n", 5), RuntimeException);
+  EXPECT_THROW(ParseCsv("1,2\n3\n", 5), RuntimeException);
+  EXPECT_THROW(ParseCsv("1,2\n3,4abc\n", 5), RuntimeException);
+  EXPECT_THROW(ParseCsv("1,2\n3,4\n5", 5), RuntimeException);
+
+  WaveformCsvParser parser;
+  const std::string text("1,2\n3,4\nbroken line\n5,6\n");
+  EXPECT_FALSE(parser.Feed(text.data(), text.size()));
+  EXPECT_FALSE(parser.Finish());
+  EXPECT_EQ(parser.GetErrorMessage(), "line 3: can't read x and y from 'broken line'");
+
+  // further chunks are ignored
+  EXPECT_FALSE(parser.Feed("7,8\n", 4));
+}
+
+//! Binary content split between chunks at any byte.
+
+TEST_F(WaveformFileUtilsTest, ParseBinaryInChunks)
+{
+  const auto buffer = CreateWaveformBuffer({{1.0, -1.0}, {2.0, 0.5}, {3.0, 1e100}});
+  WaveformFileOptions options;
+  options.format = WaveformFileFormat::kBinary;
+
+  std::string content;
+  AppendWaveformToFileContent(buffer, 0, buffer.GetSize(), options, content);
+  ASSERT_EQ(content.size(), 48);
+
+  // first value is stored as little-endian float64
+  const char expected_bytes[] = {0, 0, 0, 0, 0, 0, '\xf0', '\x3f'};
+  EXPECT_EQ(std::memcmp(content.data(), expected_bytes, sizeof(expected_bytes)), 0);
+
+  for (std::size_t chunk_size : {1, 5, 16, 17, 100})
+  {
+    WaveformBinaryParser parser;
+    for (std::size_t pos = 0; pos < content.size(); pos += chunk_size)
+    {
+      parser.Feed(content.data() + pos, std::min(chunk_size, content.size() - pos));
+    }
+    EXPECT_TRUE(parser.Finish());
+    EXPECT_EQ(GetWaveformPoints(parser.TakeBuffer()), GetWaveformPoints(buffer));
+  }
+
+  // space for all points is reserved once from the size of the whole input
+  WaveformBinaryParser reserved_parser;
+  reserved_parser.Reserve(content.size());
+  reserved_parser.Feed(content.data(), 20);
+  reserved_parser.Feed(content.data() + 20, content.size() - 20);
+  EXPECT_TRUE(reserved_parser.Finish());
+  const auto reserved_buffer = reserved_parser.TakeBuffer();
+  EXPECT_GE(reserved_buffer.x.capacity(), 3U);
+  EXPECT_EQ(GetWaveformPoints(reserved_buffer), GetWaveformPoints(buffer));
+
+  WaveformBinaryParser parser;
+  parser.Feed(content.data(), content.size() - 1);
+  EXPECT_FALSE(parser.Finish());
+  EXPECT_FALSE(parser.GetErrorMessage().empty());
+}
+
+//! Values written to CSV are read back without loss.
+
+TEST_F(WaveformFileUtilsTest, CsvRoundTrip)
+{
+  const auto buffer = CreateWaveformBuffer({{0.1, 1.0 / 3.0},
+                                            {-1e-300, std::numeric_limits<double>::max()},
+                                            {std::numeric_limits<double>::lowest(), 42.0}});
+  WaveformFileOptions options;
+  options.delimiter = ';';
+
+  std::string content;
+  AppendWaveformToFileContent(buffer, 0, 1, options, content);
+  EXPECT_EQ(content, "0.1;0.3333333333333333\n");
+
+  AppendWaveformToFileContent(buffer, 1, 10, options, content);
+  EXPECT_EQ(GetWaveformPoints(ParseWaveformFileContent(content, options)),
+            GetWaveformPoints(buffer));
+
+  EXPECT_THROW(ParseWaveformFileContent("1;2\n3", options), RuntimeException);
+}
+
+}  // namespace sup::gui::test
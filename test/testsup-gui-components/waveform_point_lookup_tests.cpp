@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_point_lookup.h"
+
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/point_item.h>
+
+#include <gtest/gtest.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing functions from waveform_point_lookup.h
+ */
+class WaveformPointLookupTest : public ::testing::Test
+{
+};
+
+TEST_F(WaveformPointLookupTest, IsSortedByX)
+{
+  mvvm::LineSeriesDataItem data_item;
+  EXPECT_TRUE(IsSortedByX(data_item));
+
+  data_item.SetWaveform({{1.0, 10.0}, {1.0, 20.0}, {3.0, 30.0}});
+  EXPECT_TRUE(IsSortedByX(data_item));
+
+  data_item.SetWaveform({{1.0, 10.0}, {3.0, 30.0}, {2.0, 20.0}});
+  EXPECT_FALSE(IsSortedByX(data_item));
+}
+
+TEST_F(WaveformPointLookupTest, FindInsertIndexByX)
+{
+  mvvm::LineSeriesDataItem data_item;
+  EXPECT_EQ(FindInsertIndexByX(data_item, 1.0), 0);
+
+  data_item.SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {2.0, 30.0}, {4.0, 40.0}});
+  EXPECT_EQ(FindInsertIndexByX(data_item, 0.0), 0);
+  EXPECT_EQ(FindInsertIndexByX(data_item, 1.5), 1);
+
+  // after all points with the same x
+  EXPECT_EQ(FindInsertIndexByX(data_item, 2.0), 3);
+  EXPECT_EQ(FindInsertIndexByX(data_item, 5.0), 4);
+}
+
+TEST_F(WaveformPointLookupTest, FindNearestPointIndex)
+{
+  mvvm::LineSeriesDataItem data_item;
+  EXPECT_EQ(FindNearestPointIndex(data_item, 1.0), -1);
+
+  data_item.SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {4.0, 40.0}});
+  EXPECT_EQ(FindNearestPointIndex(data_item, -10.0), 0);
+  EXPECT_EQ(FindNearestPointIndex(data_item, 1.4), 0);
+  EXPECT_EQ(FindNearestPointIndex(data_item, 1.5), 0);
+  EXPECT_EQ(FindNearestPointIndex(data_item, 1.6), 1);
+  EXPECT_EQ(FindNearestPointIndex(data_item, 3.5), 2);
+  EXPECT_EQ(FindNearestPointIndex(data_item, 10.0), 2);
+}
+
+TEST_F(WaveformPointLookupTest, FindPointRangeByX)
+{
+  mvvm::LineSeriesDataItem data_item;
+  EXPECT_EQ(FindPointRangeByX(data_item, 0.0, 1.0), std::make_pair(0, 0));
+
+  data_item.SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+  EXPECT_EQ(FindPointRangeByX(data_item, 2.0, 3.0), std::make_pair(1, 3));
+  EXPECT_EQ(FindPointRangeByX(data_item, 1.5, 3.5), std::make_pair(1, 3));
+  EXPECT_EQ(FindPointRangeByX(data_item, 0.0, 10.0), std::make_pair(0, 4));
+
+  // no points in the interval
+  auto [begin, end] = FindPointRangeByX(data_item, 2.1, 2.9);
+  EXPECT_EQ(begin, end);
+  std::tie(begin, end) = FindPointRangeByX(data_item, 3.0, 2.0);
+  EXPECT_EQ(begin, end);
+}
+
+TEST_F(WaveformPointLookupTest, FindSortedPosition)
+{
+  mvvm::LineSeriesDataItem data_item;
+  data_item.SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+
+  // point in place
+  EXPECT_EQ(FindSortedPosition(data_item, *data_item.GetPoint(1)), 1);
+  data_item.GetPoint(1)->SetX(2.5);
+  EXPECT_EQ(FindSortedPosition(data_item, *data_item.GetPoint(1)), 1);
+
+  // point has to go to the beginning
+  data_item.GetPoint(2)->SetX(0.0);
+  EXPECT_EQ(FindSortedPosition(data_item, *data_item.GetPoint(2)), 0);
+
+  // point has to go to the end, index is counted without the point itself
+  data_item.SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}, {4.0, 40.0}});
+  data_item.GetPoint(0)->SetX(5.0);
+  EXPECT_EQ(FindSortedPosition(data_item, *data_item.GetPoint(0)), 3);
+  data_item.GetPoint(0)->SetX(2.5);
+  EXPECT_EQ(FindSortedPosition(data_item, *data_item.GetPoint(0)), 1);
+}
+
+}  // namespace sup::gui::test
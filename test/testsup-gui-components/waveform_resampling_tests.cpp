@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_resampling.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+#include <sup/gui/tasks/thread_pool.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+namespace sup::gui::test
+{
+
+using values_t = std::vector<double>;
+
+//! Testing functions from waveform_resampling.h
+
+class WaveformResamplingTest : public ::testing::Test
+{
+public:
+  static WaveformBuffer CreateWaveform(const std::vector<std::pair<double, double>>& points)
+  {
+    return CreateWaveformBuffer(points);
+  }
+};
+
+TEST_F(WaveformResamplingTest, CreateMergedTimeBase)
+{
+  EXPECT_TRUE(CreateMergedTimeBase({}).empty());
+
+  const auto waveform0 = CreateWaveform({{0.0, 0.0}, {1.0, 0.0}, {3.0, 0.0}});
+  const auto waveform1 = CreateWaveform({{0.5, 0.0}, {1.0, 0.0}, {4.0, 0.0}});
+  const auto unsorted = CreateWaveform({{2.0, 0.0}, {-1.0, 0.0}});
+
+  EXPECT_EQ(CreateMergedTimeBase({waveform0, waveform1, unsorted}),
+            values_t({-1.0, 0.0, 0.5, 1.0, 2.0, 3.0, 4.0}));
+}
+
+TEST_F(WaveformResamplingTest, CreateUniformTimeBase)
+{
+  const auto waveform0 = CreateWaveform({{1.0, 0.0}, {2.0, 0.0}});
+  const auto waveform1 = CreateWaveform({{0.0, 0.0}, {1.5, 0.0}});
+
+  // the last value is always at the end of the range
+  EXPECT_EQ(CreateUniformTimeBase({waveform0, waveform1}, 0.5),
+            values_t({0.0, 0.5, 1.0, 1.5, 2.0}));
+  EXPECT_EQ(CreateUniformTimeBase({waveform0, waveform1}, 0.8), values_t({0.0, 0.8, 1.6, 2.0}));
+
+  EXPECT_TRUE(CreateUniformTimeBase({WaveformBuffer{}}, 0.5).empty());
+  EXPECT_THROW(CreateUniformTimeBase({waveform0}, 0.0), RuntimeException);
+  EXPECT_THROW(CreateUniformTimeBase({waveform0}, 1e-12), RuntimeException);
+}
+
+TEST_F(WaveformResamplingTest, InterpolationModes)
+{
+  const auto waveform = CreateWaveform({{0.0, 0.0}, {1.0, 10.0}, {2.0, 0.0}});
+  const values_t time_base({-1.0, 0.0, 0.4, 0.5, 0.6, 1.0, 1.75, 2.0, 3.0});
+
+  EXPECT_EQ(ResampleOnTimeBase(waveform, time_base, InterpolationMode::kLinear),
+            values_t({0.0, 0.0, 4.0, 5.0, 6.0, 10.0, 2.5, 0.0, 0.0}));
+  EXPECT_EQ(ResampleOnTimeBase(waveform, time_base, InterpolationMode::kZeroOrderHold),
+            values_t({0.0, 0.0, 0.0, 0.0, 0.0, 10.0, 10.0, 0.0, 0.0}));
+  EXPECT_EQ(ResampleOnTimeBase(waveform, time_base, InterpolationMode::kNearest),
+            values_t({0.0, 0.0, 0.0, 0.0, 10.0, 10.0, 0.0, 0.0, 0.0}));
+
+  // single point waveform is a constant
+  EXPECT_EQ(
+      ResampleOnTimeBase(CreateWaveform({{1.0, 5.0}}), {0.0, 2.0}, InterpolationMode::kLinear),
+      values_t({5.0, 5.0}));
+
+  EXPECT_THROW(ResampleOnTimeBase(WaveformBuffer{}, time_base, InterpolationMode::kLinear),
+               RuntimeException);
+}
+
+//! Unsorted waveforms are evaluated as if their points were sorted by x.
+
+TEST_F(WaveformResamplingTest, ResampleUnsortedWaveform)
+{
+  const auto sorted = CreateWaveform({{0.0, 0.0}, {1.0, 10.0}, {2.0, 0.0}});
+  const auto unsorted = CreateWaveform({{2.0, 0.0}, {0.0, 0.0}, {1.0, 10.0}});
+  const values_t time_base({-1.0, 0.5, 1.0, 1.75, 3.0});
+
+  EXPECT_EQ(ResampleOnTimeBase(unsorted, time_base, InterpolationMode::kLinear),
+            ResampleOnTimeBase(sorted, time_base, InterpolationMode::kLinear));
+  EXPECT_EQ(ResampleWaveformsOnTimeBase({sorted, unsorted}, time_base, InterpolationMode::kLinear),
+            std::vector<values_t>(2, ResampleOnTimeBase(sorted, time_base,
+                                                        InterpolationMode::kLinear)));
+
+  // points with equal x keep their order, the step is taken at the later point
+  const auto step = CreateWaveform({{1.0, 1.0}, {0.0, 0.0}, {1.0, 2.0}});
+  EXPECT_EQ(ResampleOnTimeBase(step, {0.0, 1.0, 2.0}, InterpolationMode::kZeroOrderHold),
+            values_t({0.0, 2.0, 2.0}));
+  EXPECT_EQ(ResampleOnTimeBase(step, {0.5}, InterpolationMode::kLinear), values_t({0.5}));
+}
+
+//! Parallel evaluation of many waveforms gives the same result as sequential one.
+
+TEST_F(WaveformResamplingTest, ParallelResampling)
+{
+  std::vector<WaveformBuffer> waveforms;
+  for (int index = 0; index < 10; ++index)
+  {
+    waveforms.push_back(GenerateSine(0.01 * index, 0.37, 1000, 1.0, 0.01 * (index + 1)));
+  }
+  const auto time_base = CreateUniformTimeBase(waveforms, 0.001);
+  ASSERT_GT(time_base.size(), 300000);
+
+  const auto sequential =
+      ResampleWaveformsOnTimeBase(waveforms, time_base, InterpolationMode::kLinear);
+  ASSERT_EQ(sequential.size(), waveforms.size());
+  for (std::size_t index = 0; index < waveforms.size(); ++index)
+  {
+    EXPECT_EQ(sequential[index],
+              ResampleOnTimeBase(waveforms[index], time_base, InterpolationMode::kLinear));
+  }
+
+  ThreadPool thread_pool(4);
+  EXPECT_EQ(ResampleWaveformsOnTimeBase(waveforms, time_base, InterpolationMode::kLinear,
+                                        &thread_pool),
+            sequential);
+
+  // validation errors are reported before any job is started
+  waveforms.emplace_back();
+  EXPECT_THROW(ResampleWaveformsOnTimeBase(waveforms, time_base, InterpolationMode::kLinear,
+                                           &thread_pool),
+               RuntimeException);
+  EXPECT_THROW(ResampleWaveformsOnTimeBase({}, {1.0, 0.0}, InterpolationMode::kLinear),
+               RuntimeException);
+}
+
+TEST_F(WaveformResamplingTest, CreateResampledAnyValue)
+{
+  const values_t time_base({0.0, 1.0});
+  const std::vector<std::string> names({"a.b", "", "time", "a_b"});
+  const std::vector<values_t> values({{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}, {7.0, 8.0}});
+
+  auto anyvalue = CreateResampledAnyValue(time_base, names, values, "waveforms_t");
+
+  EXPECT_EQ(anyvalue.MemberNames(),
+            std::vector<std::string>({"time", "a_b", "waveform1", "time_2", "a_b_3"}));
+  ASSERT_EQ(anyvalue["time"].NumberOfElements(), 2);
+  EXPECT_EQ(anyvalue["time"][1].As<double>(), 1.0);
+  EXPECT_EQ(anyvalue["a_b_3"][0].As<double>(), 7.0);
+
+  EXPECT_THROW(CreateResampledAnyValue(time_base, {"a"}, {}), RuntimeException);
+  EXPECT_THROW(CreateResampledAnyValue(time_base, {"a"}, {{1.0}}), RuntimeException);
+}
+
+}  // namespace sup::gui::test
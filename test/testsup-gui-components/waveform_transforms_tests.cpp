@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/plotting/waveform_transforms.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace sup::gui::test
+{
+
+using points_t = std::vector<std::pair<double, double>>;
+
+//! Testing kernels and transforms from waveform_transforms.h
+
+class WaveformTransformsTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Applies transform to the range of given points and returns the result.
+   */
+  static points_t Apply(const waveform_transform_t& transform, const points_t& points,
+                        std::size_t begin, std::size_t end)
+  {
+    auto buffer = CreateWaveformBuffer(points);
+    transform(buffer, begin, end);
+    return GetWaveformPoints(buffer);
+  }
+};
+
+TEST_F(WaveformTransformsTest, CreateWaveformBuffer)
+{
+  EXPECT_EQ(CreateWaveformBuffer({}).GetSize(), 0);
+
+  const points_t points({{1.0, 10.0}, {2.0, 20.0}});
+  auto buffer = CreateWaveformBuffer(points);
+  EXPECT_EQ(buffer.x, std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(buffer.y, std::vector<double>({10.0, 20.0}));
+  EXPECT_EQ(GetWaveformPoints(buffer), points);
+}
+
+TEST_F(WaveformTransformsTest, ScaleOffsetAndClampValues)
+{
+  std::vector<double> values({-2.0, 1.0, 3.0});
+
+  ScaleValues(values.data(), values.size(), 2.0);
+  EXPECT_EQ(values, std::vector<double>({-4.0, 2.0, 6.0}));
+
+  OffsetValues(values.data(), values.size(), 1.0);
+  EXPECT_EQ(values, std::vector<double>({-3.0, 3.0, 7.0}));
+
+  ClampValues(values.data(), values.size(), 0.0, 5.0);
+  EXPECT_EQ(values, std::vector<double>({0.0, 3.0, 5.0}));
+
+  EXPECT_THROW(ClampValues(values.data(), values.size(), 1.0, 0.0), RuntimeException);
+}
+
+TEST_F(WaveformTransformsTest, SmoothValues)
+{
+  std::vector<double> values({0.0, 3.0, 6.0, 0.0});
+
+  // window of one point doesn't change anything
+  SmoothValues(values.data(), values.size(), 1);
+  EXPECT_EQ(values, std::vector<double>({0.0, 3.0, 6.0, 0.0}));
+
+  // window is shrunk at the edges
+  SmoothValues(values.data(), values.size(), 3);
+  EXPECT_EQ(values, std::vector<double>({1.5, 3.0, 3.0, 3.0}));
+
+  // empty values
+  EXPECT_NO_THROW(SmoothValues(nullptr, 0, 3));
+}
+
+TEST_F(WaveformTransformsTest, ResampleWaveform)
+{
+  auto buffer = CreateWaveformBuffer({{0.0, 0.0}, {1.0, 10.0}, {3.0, 30.0}});
+
+  // the last point is included even if it doesn't fit into the step
+  auto result = ResampleWaveform(buffer, 0.8);
+  const points_t expected({{0.0, 0.0}, {0.8, 8.0}, {1.6, 16.0}, {2.4, 24.0}, {3.0, 30.0}});
+  auto points = GetWaveformPoints(result);
+  ASSERT_EQ(points.size(), expected.size());
+  for (std::size_t index = 0; index < points.size(); ++index)
+  {
+    EXPECT_DOUBLE_EQ(points[index].first, expected[index].first);
+    EXPECT_DOUBLE_EQ(points[index].second, expected[index].second);
+  }
+
+  // single point stays as it is
+  EXPECT_EQ(GetWaveformPoints(ResampleWaveform(CreateWaveformBuffer({{1.0, 2.0}}), 0.1)),
+            points_t({{1.0, 2.0}}));
+
+  EXPECT_THROW(ResampleWaveform(buffer, 0.0), RuntimeException);
+  EXPECT_THROW(ResampleWaveform(buffer, -1.0), RuntimeException);
+  EXPECT_THROW(ResampleWaveform(CreateWaveformBuffer({{1.0, 0.0}, {0.0, 0.0}}), 0.1),
+               RuntimeException);
+  EXPECT_THROW(ResampleWaveform(buffer, 1e-12), RuntimeException);
+}
+
+TEST_F(WaveformTransformsTest, Generators)
+{
+  EXPECT_EQ(GetWaveformPoints(GenerateRamp(1.0, 0.5, 3, 0.0, 10.0)),
+            points_t({{1.0, 0.0}, {1.5, 5.0}, {2.0, 10.0}}));
+  EXPECT_EQ(GetWaveformPoints(GenerateRamp(1.0, 0.5, 1, 0.0, 10.0)), points_t({{1.0, 0.0}}));
+  EXPECT_EQ(GenerateRamp(1.0, 0.5, 0, 0.0, 10.0).GetSize(), 0);
+
+  EXPECT_EQ(GetWaveformPoints(GenerateStep(0.0, 1.0, 4, 2.0, -1.0, 1.0)),
+            points_t({{0.0, -1.0}, {1.0, -1.0}, {2.0, 1.0}, {3.0, 1.0}}));
+
+  // quarter of the period per step
+  auto sine = GenerateSine(0.0, 0.25, 5, 2.0, 1.0, 0.0, 1.0);
+  const std::vector<double> expected_y({1.0, 3.0, 1.0, -1.0, 1.0});
+  ASSERT_EQ(sine.GetSize(), expected_y.size());
+  for (std::size_t index = 0; index < expected_y.size(); ++index)
+  {
+    EXPECT_NEAR(sine.y[index], expected_y[index], 1e-12);
+  }
+
+  EXPECT_THROW(GenerateRamp(0.0, 0.0, 3, 0.0, 1.0), RuntimeException);
+}
+
+TEST_F(WaveformTransformsTest, TransformsInRange)
+{
+  const points_t points({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}});
+
+  EXPECT_EQ(Apply(CreateScaleTransform(2.0), points, 0, 3),
+            points_t({{1.0, 20.0}, {2.0, 40.0}, {3.0, 60.0}}));
+  EXPECT_EQ(Apply(CreateOffsetTransform(1.0), points, 1, 2),
+            points_t({{1.0, 10.0}, {2.0, 21.0}, {3.0, 30.0}}));
+  EXPECT_EQ(Apply(CreateTimeShiftTransform(0.5), points, 1, 3),
+            points_t({{1.0, 10.0}, {2.5, 20.0}, {3.5, 30.0}}));
+  EXPECT_EQ(Apply(CreateClampTransform(15.0, 25.0), points, 0, 3),
+            points_t({{1.0, 15.0}, {2.0, 20.0}, {3.0, 25.0}}));
+  EXPECT_EQ(Apply(CreateSmoothTransform(3), points, 0, 2),
+            points_t({{1.0, 15.0}, {2.0, 15.0}, {3.0, 30.0}}));
+
+  // empty range is allowed
+  EXPECT_EQ(Apply(CreateScaleTransform(2.0), points, 1, 1), points);
+
+  EXPECT_THROW(Apply(CreateScaleTransform(2.0), points, 2, 1), RuntimeException);
+  EXPECT_THROW(Apply(CreateScaleTransform(2.0), points, 0, 4), RuntimeException);
+  EXPECT_THROW(CreateClampTransform(1.0, 0.0), RuntimeException);
+  EXPECT_THROW(CreateResampleTransform(0.0), RuntimeException);
+}
+
+//! Resampling of the range keeps points outside of it.
+
+TEST_F(WaveformTransformsTest, ResampleTransform)
+{
+  const points_t points({{0.0, 0.0}, {1.0, 10.0}, {2.0, 20.0}, {5.0, 0.0}});
+
+  EXPECT_EQ(Apply(CreateResampleTransform(0.5), points, 0, 3),
+            points_t({{0.0, 0.0},
+                      {0.5, 5.0},
+                      {1.0, 10.0},
+                      {1.5, 15.0},
+                      {2.0, 20.0},
+                      {5.0, 0.0}}));
+}
+
+}  // namespace sup::gui::test
@@ -23,7 +23,9 @@
 #include <sup/gui/model/anyvalue_conversion_utils.h>
 #include <sup/gui/model/anyvalue_item.h>
 #include <sup/gui/model/anyvalue_item_constants.h>
+#include <sup/gui/model/scalar_conversion_utils.h>
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_helper.h>
 
@@ -411,4 +413,97 @@ TEST_F(AnyValueItemBuilderTest, ArrayWithTwoStructureElements)
   EXPECT_EQ(grandchild3->Data<mvvm::uint8>(), 43);
 }
 
+//! Building items with arrays of numeric scalars packed into a buffer.
+TEST_F(AnyValueItemBuilderTest, PackedScalarArrays)
+{
+  const sup::dto::AnyValue numbers = sup::dto::ArrayValue(
+      {{sup::dto::Float64Type, 1.5}, {sup::dto::Float64Type, 2.5}, {sup::dto::Float64Type, 3.5}},
+      "numbers_t");
+  const sup::dto::AnyValue names =
+      sup::dto::ArrayValue({{sup::dto::StringType, "a"}, {sup::dto::StringType, "b"}});
+  const sup::dto::AnyValue anyvalue = {{"numbers", numbers},
+                                       {"names", names},
+                                       {"flag", {sup::dto::BooleanType, true}}};
+
+  AnyValueItemBuilder builder(/*pack_scalar_arrays*/ true);
+  sup::dto::SerializeAnyValue(anyvalue, builder);
+  auto item = builder.MoveAnyValueItem();
+
+  ASSERT_EQ(item->GetChildrenCount(), 3);
+
+  // array of numbers is packed
+  auto packed = dynamic_cast<AnyValueScalarArrayItem*>(item->GetChildren().at(0));
+  ASSERT_NE(packed, nullptr);
+  EXPECT_EQ(packed->GetDisplayName(), "numbers");
+  EXPECT_EQ(packed->GetAnyTypeName(), "numbers_t");
+  EXPECT_EQ(packed->GetElementTypeName(), sup::dto::kFloat64TypeName);
+  EXPECT_EQ(packed->GetElementCount(), 3U);
+  EXPECT_EQ(packed->GetChildrenCount(), 0);
+  EXPECT_EQ(packed->GetBuffer().GetElement(2), mvvm::variant_t(3.5));
+
+  // array of strings is regular, next siblings are in place
+  auto regular = item->GetChildren().at(1);
+  EXPECT_EQ(regular->GetType(), AnyValueArrayItem::GetStaticType());
+  EXPECT_EQ(regular->GetDisplayName(), "names");
+  EXPECT_EQ(regular->GetChildrenCount(), 2);
+  EXPECT_EQ(item->GetChildren().at(2)->GetDisplayName(), "flag");
+
+  // round trip
+  EXPECT_EQ(CreateAnyValue(*item), anyvalue);
+  EXPECT_EQ(CreateAnyValue(*CreatePackedAnyValueItem(anyvalue)), anyvalue);
+  EXPECT_EQ(CreateAnyValue(*CreatePackedAnyValueItem(numbers)), numbers);
+
+  // arrays below the minimum size are regular
+  auto small_arrays_item = CreatePackedAnyValueItem(anyvalue, /*min_array_size*/ 4);
+  EXPECT_EQ(small_arrays_item->GetChildren().at(0)->GetType(), AnyValueArrayItem::GetStaticType());
+  EXPECT_EQ(small_arrays_item->GetChildren().at(0)->GetChildrenCount(), 3);
+  EXPECT_EQ(CreateAnyValue(*small_arrays_item), anyvalue);
+}
+
+//! Building items from arrays of every numeric type, which are converted in bulk.
+TEST_F(AnyValueItemBuilderTest, NumericArraysInBulk)
+{
+  sup::dto::AnyValue anyvalue = sup::dto::EmptyStruct("struct_t");
+  for (const auto& name : GetScalarTypeNames())
+  {
+    const auto type_code = GetScalarTypeCode(name);
+    if (type_code != sup::dto::TypeCode::String)
+    {
+      anyvalue.AddMember(name, sup::dto::AnyValue(3, sup::dto::AnyType(type_code), name + "_t"));
+    }
+  }
+  anyvalue.AddMember("flag", {sup::dto::BooleanType, true});
+
+  auto item = GetAnyValueItem(anyvalue);
+  ASSERT_EQ(item->GetChildrenCount(), 13);
+
+  for (auto array : item->GetChildRange())
+  {
+    if (array->IsScalar())
+    {
+      continue;
+    }
+
+    ASSERT_EQ(array->GetChildrenCount(), 3);
+    const auto element_type_name = array->GetDisplayName();
+    EXPECT_EQ(array->GetAnyTypeName(), element_type_name + "_t");
+
+    const auto children = array->GetChildRange();
+    for (std::size_t index = 0; index < children.GetSize(); ++index)
+    {
+      EXPECT_EQ(children[index]->GetType(), AnyValueScalarItem::GetStaticType());
+      EXPECT_EQ(children[index]->GetDisplayName(),
+                constants::kElementNamePrefix + std::to_string(index));
+      EXPECT_EQ(children[index]->GetAnyTypeName(), element_type_name);
+      EXPECT_EQ(GetScalarTypeName(children[index]->Data()), element_type_name);
+    }
+  }
+
+  // next sibling is in place
+  EXPECT_EQ(item->GetChildRange()[12]->GetDisplayName(), "flag");
+
+  // round trip
+  EXPECT_EQ(CreateAnyValue(*item), anyvalue);
+}
+
 }  // namespace sup::gui::test
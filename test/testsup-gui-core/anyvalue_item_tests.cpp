@@ -20,6 +20,7 @@
 
 #include "sup/gui/model/anyvalue_item.h"
 
+#include <sup/gui/core/sup_gui_core_exceptions.h>
 #include <sup/gui/model/anyvalue_item_constants.h>
 #include <sup/gui/model/scalartype_property_item.h>
 
@@ -178,12 +179,52 @@ TEST_F(AnyValueItemTest, AddScalarField)
   EXPECT_EQ(item.GetChildrenCount(), 1);
 }
 
+//! Non-allocating view on children.
+
+TEST_F(AnyValueItemTest, GetChildRange)
+{
+  {
+    const AnyValueScalarItem item;
+    EXPECT_TRUE(item.GetChildRange().IsEmpty());
+    EXPECT_EQ(item.GetChildRange().begin(), item.GetChildRange().end());
+  }
+
+  {
+    AnyValueArrayItem item;
+    EXPECT_TRUE(item.GetChildRange().IsEmpty());
+
+    auto child0 = item.InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+    auto child1 = item.InsertItem<AnyValueStructItem>(mvvm::TagIndex::Append());
+    auto child2 = item.InsertItem<AnyValueArrayItem>(mvvm::TagIndex::Append());
+
+    const auto range = item.GetChildRange();
+    EXPECT_FALSE(range.IsEmpty());
+    EXPECT_EQ(range.GetSize(), 3);
+    EXPECT_EQ(item.GetChildrenCount(), 3);
+    EXPECT_EQ(range[0], child0);
+    EXPECT_EQ(range[1], child1);
+    EXPECT_EQ(range[2], child2);
+
+    const std::vector<AnyValueItem*> expected({child0, child1, child2});
+    EXPECT_EQ(std::vector<AnyValueItem*>(range.begin(), range.end()), expected);
+    EXPECT_EQ(item.GetChildren(), expected);
+
+    std::vector<AnyValueItem*> children;
+    for (auto child : item.GetChildRange())
+    {
+      children.push_back(child);
+    }
+    EXPECT_EQ(children, expected);
+  }
+}
+
 TEST_F(AnyValueItemTest, Clone)
 {
   EXPECT_TRUE(mvvm::test::IsCloneImplemented<AnyValueEmptyItem>());
   EXPECT_TRUE(mvvm::test::IsCloneImplemented<AnyValueScalarItem>());
   EXPECT_TRUE(mvvm::test::IsCloneImplemented<AnyValueStructItem>());
   EXPECT_TRUE(mvvm::test::IsCloneImplemented<AnyValueArrayItem>());
+  EXPECT_TRUE(mvvm::test::IsCloneImplemented<AnyValueScalarArrayItem>());
 }
 
 TEST_F(AnyValueItemTest, SetNewScalarTypeNameViaPropertyItem)
@@ -212,4 +253,78 @@ TEST_F(AnyValueItemTest, SetNewScalarTypeNameViaPropertyItem)
   EXPECT_TRUE(mvvm::utils::HasTag(item, constants::kAnyValueTypeTag));
 }
 
+//! Packed array keeps elements in the buffer and doesn't have children.
+TEST_F(AnyValueItemTest, AnyValueScalarArrayItem)
+{
+  AnyValueScalarArrayItem item;
+  EXPECT_TRUE(item.IsArray());
+  EXPECT_FALSE(item.IsScalar());
+  EXPECT_FALSE(item.IsStruct());
+  EXPECT_EQ(item.GetDisplayName(), constants::kArrayTypeName);
+  EXPECT_EQ(item.GetAnyTypeName(), std::string());
+  EXPECT_EQ(item.GetElementTypeName(), std::string());
+  EXPECT_EQ(item.GetElementCount(), 0U);
+  EXPECT_TRUE(item.GetBuffer().IsEmpty());
+  EXPECT_EQ(item.GetChildrenCount(), 0);
+  EXPECT_TRUE(item.GetChildren().empty());
+
+  item.SetAnyTypeName("my_array_t");
+  EXPECT_EQ(item.GetAnyTypeName(), "my_array_t");
+
+  ScalarArrayBuffer buffer(sup::dto::kUInt8TypeName, 4);
+  buffer.SetElement(3, mvvm::variant_t(mvvm::uint8{255}));
+  item.SetBuffer(buffer);
+  EXPECT_EQ(item.GetElementTypeName(), sup::dto::kUInt8TypeName);
+  EXPECT_EQ(item.GetElementCount(), 4U);
+  EXPECT_EQ(item.GetBuffer(), buffer);
+  EXPECT_EQ(item.GetChildrenCount(), 0);
+
+  // clone preserves elements
+  auto clone = item.Clone();
+  EXPECT_EQ(dynamic_cast<AnyValueScalarArrayItem&>(*clone).GetBuffer(), buffer);
+}
+
+//! Single elements are kept as edits next to the buffer.
+TEST_F(AnyValueItemTest, AnyValueScalarArrayItemSetElement)
+{
+  AnyValueScalarArrayItem item;
+  item.SetBuffer(ScalarArrayBuffer(sup::dto::kInt32TypeName, 1000));
+
+  item.SetElement(1, mvvm::variant_t(mvvm::int32{42}));
+  item.SetElement(999, mvvm::variant_t(mvvm::int32{-1}));
+  item.SetElement(1, mvvm::variant_t(mvvm::int32{43}));
+  EXPECT_EQ(item.GetElementCount(), 1000U);
+
+  auto buffer = item.GetBuffer();
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(mvvm::int32{0}));
+  EXPECT_EQ(buffer.GetElement(1), mvvm::variant_t(mvvm::int32{43}));
+  EXPECT_EQ(buffer.GetElement(999), mvvm::variant_t(mvvm::int32{-1}));
+
+  // two edits of 12 bytes each
+  EXPECT_EQ(DecodeBase64(item.Property<std::string>(constants::kScalarArrayEditsTag)).size(), 24U);
+
+  // wrong type, wrong index
+  EXPECT_THROW(item.SetElement(0, mvvm::variant_t(1.0)), RuntimeException);
+  EXPECT_THROW(item.SetElement(1000, mvvm::variant_t(mvvm::int32{1})), RuntimeException);
+
+  // many edits are merged into the buffer
+  for (int index = 0; index < 1000; ++index)
+  {
+    item.SetElement(static_cast<std::size_t>(index), mvvm::variant_t(mvvm::int32{index}));
+  }
+  EXPECT_LE(DecodeBase64(item.Property<std::string>(constants::kScalarArrayEditsTag)).size(),
+            256U * 12U);
+  buffer = item.GetBuffer();
+  for (int index = 0; index < 1000; ++index)
+  {
+    const auto element_index = static_cast<std::size_t>(index);
+    EXPECT_EQ(buffer.GetElement(element_index), mvvm::variant_t(mvvm::int32{index}));
+  }
+
+  // new buffer drops edits
+  item.SetBuffer(ScalarArrayBuffer(sup::dto::kInt32TypeName, 2));
+  EXPECT_TRUE(item.Property<std::string>(constants::kScalarArrayEditsTag).empty());
+  EXPECT_EQ(item.GetBuffer(), ScalarArrayBuffer(sup::dto::kInt32TypeName, 2));
+}
+
 }  // namespace sup::gui::test
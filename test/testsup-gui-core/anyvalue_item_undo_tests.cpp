@@ -20,6 +20,7 @@
 
 #include "sup/gui/model/anyvalue_item.h"
 
+#include <sup/gui/model/anyvalue_item_constants.h>
 #include <sup/gui/model/scalartype_property_item.h>
 
 #include <mvvm/commands/i_command_stack.h>
@@ -72,4 +73,53 @@ TEST_F(AnyValueItemTest, ChangeScalarType)
   EXPECT_EQ(scalar->Data<std::string>(), std::string());
 }
 
+//! Replacing elements of the packed array is a single undoable command.
+TEST_F(AnyValueItemTest, SetScalarArrayBuffer)
+{
+  mvvm::ApplicationModel model;
+
+  auto array = model.InsertItem<AnyValueScalarArrayItem>();
+  const ScalarArrayBuffer initial_buffer(sup::dto::kInt8TypeName, 2);
+  array->SetBuffer(initial_buffer);
+
+  model.SetUndoEnabled(true);
+  auto commands = model.GetCommandStack();
+
+  ScalarArrayBuffer buffer(sup::dto::kFloat32TypeName, 3);
+  buffer.SetElement(0, mvvm::variant_t(mvvm::float32{1.5}));
+  array->SetBuffer(buffer);
+  EXPECT_EQ(array->GetBuffer(), buffer);
+  EXPECT_EQ(commands->GetCommandCount(), 1U);
+
+  commands->Undo();
+  EXPECT_EQ(array->GetBuffer(), initial_buffer);
+
+  commands->Redo();
+  EXPECT_EQ(array->GetBuffer(), buffer);
+}
+
+//! Changing a single element of the packed array doesn't store the whole array in the command.
+TEST_F(AnyValueItemTest, SetScalarArrayElement)
+{
+  mvvm::ApplicationModel model;
+
+  auto array = model.InsertItem<AnyValueScalarArrayItem>();
+  const ScalarArrayBuffer initial_buffer(sup::dto::kFloat64TypeName, 100000);
+  array->SetBuffer(initial_buffer);
+
+  model.SetUndoEnabled(true);
+  auto commands = model.GetCommandStack();
+
+  array->SetElement(10, mvvm::variant_t(1.5));
+  EXPECT_EQ(commands->GetCommandCount(), 1U);
+  EXPECT_EQ(array->GetBuffer().GetElement(10), mvvm::variant_t(1.5));
+  EXPECT_EQ(array->Property<std::string>(constants::kScalarArrayDataTag), initial_buffer.ToText());
+
+  commands->Undo();
+  EXPECT_EQ(array->GetBuffer(), initial_buffer);
+
+  commands->Redo();
+  EXPECT_EQ(array->GetBuffer().GetElement(10), mvvm::variant_t(1.5));
+}
+
 }  // namespace sup::gui::test
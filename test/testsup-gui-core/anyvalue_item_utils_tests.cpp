@@ -235,6 +235,32 @@ TEST_F(AnyValueItemUtilsTest, UpdateAnyValueItemDataFromStructWithNestedField)
   EXPECT_EQ(target_scalar1->Data<bool>(), true);
 }
 
+//! Testing UpdateAnyValueItemData method. Updating packed array from another packed array.
+TEST_F(AnyValueItemUtilsTest, UpdateAnyValueItemDataFromScalarArray)
+{
+  ScalarArrayBuffer buffer(sup::dto::kInt32TypeName, 2);
+  buffer.SetElement(1, mvvm::variant_t(mvvm::int32{42}));
+
+  AnyValueStructItem source;
+  auto source_array = source.InsertItem<AnyValueScalarArrayItem>(mvvm::TagIndex::Append());
+  source_array->SetBuffer(buffer);
+
+  AnyValueStructItem target;
+  auto target_array = target.InsertItem<AnyValueScalarArrayItem>(mvvm::TagIndex::Append());
+  target_array->SetBuffer(ScalarArrayBuffer(sup::dto::kInt32TypeName, 2));
+
+  EXPECT_NO_THROW(UpdateAnyValueItemData(source, target));
+  EXPECT_EQ(target_array->GetBuffer(), buffer);
+
+  // arrays of different length
+  source_array->SetBuffer(ScalarArrayBuffer(sup::dto::kInt32TypeName, 3));
+  EXPECT_THROW(UpdateAnyValueItemData(source, target), RuntimeException);
+
+  // regular array can't update packed one
+  AnyValueArrayItem regular_array;
+  EXPECT_THROW(UpdateAnyValueItemData(regular_array, *target_array), RuntimeException);
+}
+
 TEST_F(AnyValueItemUtilsTest, IsSuitableScalarType)
 {
   {  // empty array
@@ -264,7 +290,7 @@ TEST_F(AnyValueItemUtilsTest, GetAnyValueItemTypes)
 {
   const auto types = GetAnyValueItemTypes();
 
-  EXPECT_EQ(types.size(), 4);
+  EXPECT_EQ(types.size(), 5);
 
   EXPECT_NE(std::find(types.begin(), types.end(), AnyValueEmptyItem::GetStaticType()), types.end());
   EXPECT_NE(std::find(types.begin(), types.end(), AnyValueScalarItem::GetStaticType()),
@@ -272,6 +298,8 @@ TEST_F(AnyValueItemUtilsTest, GetAnyValueItemTypes)
   EXPECT_NE(std::find(types.begin(), types.end(), AnyValueStructItem::GetStaticType()),
             types.end());
   EXPECT_NE(std::find(types.begin(), types.end(), AnyValueArrayItem::GetStaticType()), types.end());
+  EXPECT_NE(std::find(types.begin(), types.end(), AnyValueScalarArrayItem::GetStaticType()),
+            types.end());
 
   EXPECT_EQ(std::find(types.begin(), types.end(), AnyValueItem::GetStaticType()), types.end());
 }
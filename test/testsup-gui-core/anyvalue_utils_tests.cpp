@@ -121,4 +121,23 @@ TEST_F(AnyValueUtilsTest, AnyValueFromJSONString)
   }
 }
 
+//! Exception message for the huge broken input doesn't contain the whole input.
+
+TEST_F(AnyValueUtilsTest, AnyValueFromBrokenJSONString)
+{
+  const std::string json_value = "[" + std::string(1000000, '1') + "x]";
+
+  try
+  {
+    (void)AnyValueFromJSONString(json_value);
+    FAIL() << "Exception expected";
+  }
+  catch (const RuntimeException& ex)
+  {
+    const std::string message(ex.what());
+    EXPECT_LT(message.size(), 1000);
+    EXPECT_NE(message.find("line 1, column 1000002: expected ',' or ']'"), std::string::npos);
+  }
+}
+
 }  // namespace sup::gui::test
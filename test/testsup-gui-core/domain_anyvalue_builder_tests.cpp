@@ -222,6 +222,27 @@ TEST_F(DomainAnyValueBuilderTest, FromScalarArray)
   EXPECT_EQ(any_value, expected);
 }
 
+//! Construction of string array, which is built element by element.
+
+TEST_F(DomainAnyValueBuilderTest, FromStringArray)
+{
+  auto expected = sup::dto::ArrayValue({{sup::dto::StringType, "abc"}, "def"}, "array_name");
+
+  AnyValueArrayItem item;
+  item.SetAnyTypeName("array_name");
+
+  auto child0 = item.InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+  child0->SetAnyTypeName(sup::dto::kStringTypeName);
+  child0->SetData(std::string("abc"));
+
+  auto child1 = item.InsertItem<AnyValueScalarItem>(mvvm::TagIndex::Append());
+  child1->SetAnyTypeName(sup::dto::kStringTypeName);
+  child1->SetData(std::string("def"));
+
+  auto any_value = CreateAnyValue(item);
+  EXPECT_EQ(any_value, expected);
+}
+
 //! Building a structure with scalar array as a single field.
 
 TEST_F(DomainAnyValueBuilderTest, StructWithScalarArrayAsField)
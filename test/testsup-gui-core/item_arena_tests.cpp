@@ -0,0 +1,280 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/model/item_arena.h"
+
+#include <sup/gui/model/anyvalue_conversion_utils.h>
+#include <sup/gui/model/anyvalue_item.h>
+
+#include <mvvm/model/tagindex.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace sup::gui::test
+{
+
+//! Testing ItemArena and ItemArenaScope classes.
+
+class ItemArenaTest : public ::testing::Test
+{
+public:
+  static sup::dto::AnyValue CreateStructValue()
+  {
+    return sup::dto::AnyValue{{"signed", {sup::dto::SignedInteger32Type, 42}},
+                              {"bool", {sup::dto::BooleanType, true}},
+                              {"string", {sup::dto::StringType, std::string("abc")}}};
+  }
+
+  static sup::dto::AnyValue CreateArrayValue(int element_count)
+  {
+    return sup::dto::AnyValue(static_cast<std::size_t>(element_count),
+                              sup::dto::SignedInteger32Type);
+  }
+};
+
+TEST_F(ItemArenaTest, AllocateWithoutScope)
+{
+  EXPECT_EQ(ItemArenaScope::GetCurrentArena(), nullptr);
+
+  auto ptr = AllocateItemMemory(10);
+  EXPECT_NE(ptr, nullptr);
+  DeallocateItemMemory(ptr);
+
+  // deallocation of nullptr is allowed
+  DeallocateItemMemory(nullptr);
+}
+
+TEST_F(ItemArenaTest, AllocateInScope)
+{
+  const ItemArenaScope scope;
+  auto arena = scope.GetArena();
+  EXPECT_EQ(ItemArenaScope::GetCurrentArena(), arena);
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+  EXPECT_EQ(arena->GetChunkCount(), 0);
+
+  auto ptr1 = AllocateItemMemory(10);
+  auto ptr2 = AllocateItemMemory(10);
+  EXPECT_EQ(arena->GetAllocationCount(), 2);
+  EXPECT_EQ(arena->GetChunkCount(), 1);
+
+  // allocations are aligned and follow each other
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr1) % alignof(std::max_align_t), 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr2) % alignof(std::max_align_t), 0);
+  EXPECT_LT(ptr1, ptr2);
+
+  DeallocateItemMemory(ptr1);
+  DeallocateItemMemory(ptr2);
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+}
+
+//! Allocation which doesn't fit into the standard chunk gets its own chunk.
+
+TEST_F(ItemArenaTest, LargeAllocation)
+{
+  const ItemArenaScope scope;
+  auto arena = scope.GetArena();
+
+  auto ptr1 = AllocateItemMemory(10);
+  auto ptr2 = AllocateItemMemory(1024 * 1024);
+  auto ptr3 = AllocateItemMemory(10);
+  EXPECT_EQ(arena->GetChunkCount(), 3);
+
+  DeallocateItemMemory(ptr1);
+  DeallocateItemMemory(ptr2);
+  DeallocateItemMemory(ptr3);
+}
+
+//! Chunks grow geometrically, so a small subtree doesn't reserve much memory.
+
+TEST_F(ItemArenaTest, GrowingChunks)
+{
+  const ItemArenaScope scope;
+  auto arena = scope.GetArena();
+
+  std::vector<void*> allocations({AllocateItemMemory(10)});
+  EXPECT_EQ(arena->GetChunkCount(), 1);
+  EXPECT_EQ(arena->GetReservedSize(), 4 * 1024);
+
+  // 4K, 8K, 16K, 32K chunks are filled with 1K allocations, the first one has 3 of them
+  while (allocations.size() < 60)
+  {
+    allocations.push_back(AllocateItemMemory(1024));
+  }
+  EXPECT_EQ(arena->GetChunkCount(), 4);
+  EXPECT_EQ(arena->GetReservedSize(), 60 * 1024);
+
+  allocations.push_back(AllocateItemMemory(1024));
+  EXPECT_EQ(arena->GetChunkCount(), 5);
+  EXPECT_EQ(arena->GetReservedSize(), 124 * 1024);
+
+  for (auto ptr : allocations)
+  {
+    DeallocateItemMemory(ptr);
+  }
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+}
+
+//! Chunks are released as soon as their allocations are gone, the current chunk stays.
+
+TEST_F(ItemArenaTest, ReleaseEmptyChunks)
+{
+  const ItemArenaScope scope;
+  auto arena = scope.GetArena();
+
+  std::vector<void*> allocations;
+  while (allocations.size() < 2000)
+  {
+    allocations.push_back(AllocateItemMemory(1024));
+  }
+  EXPECT_GT(arena->GetChunkCount(), 8);
+  EXPECT_GT(arena->GetReservedSize(), 2000 * 1024);
+
+  // the last allocation lives in the current chunk of 256K
+  for (std::size_t index = 0; index + 1 < allocations.size(); ++index)
+  {
+    DeallocateItemMemory(allocations[index]);
+  }
+  EXPECT_EQ(arena->GetAllocationCount(), 1);
+  EXPECT_EQ(arena->GetChunkCount(), 1);
+  EXPECT_EQ(arena->GetReservedSize(), 256 * 1024);
+
+  // current chunk is still used for allocations
+  DeallocateItemMemory(allocations.back());
+  EXPECT_EQ(arena->GetChunkCount(), 1);
+  DeallocateItemMemory(AllocateItemMemory(1024));
+  EXPECT_EQ(arena->GetChunkCount(), 1);
+}
+
+//! Heap allocations made while arena exists are given back to the heap.
+
+TEST_F(ItemArenaTest, MixedAllocations)
+{
+  auto heap_ptr1 = AllocateItemMemory(10);
+
+  const ItemArenaScope scope;
+  auto arena = scope.GetArena();
+  auto arena_ptr = AllocateItemMemory(10);
+
+  std::thread thread(
+      [arena_ptr, heap_ptr1]()
+      {
+        // no scope in another thread
+        auto heap_ptr2 = AllocateItemMemory(10);
+        DeallocateItemMemory(heap_ptr2);
+        DeallocateItemMemory(heap_ptr1);
+        DeallocateItemMemory(arena_ptr);
+      });
+  thread.join();
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+}
+
+TEST_F(ItemArenaTest, NestedScopes)
+{
+  const ItemArenaScope scope;
+  {
+    const ItemArenaScope inner_scope;
+    EXPECT_NE(inner_scope.GetArena(), scope.GetArena());
+    EXPECT_EQ(ItemArenaScope::GetCurrentArena(), inner_scope.GetArena());
+  }
+  EXPECT_EQ(ItemArenaScope::GetCurrentArena(), scope.GetArena());
+}
+
+//! Items created in the scope are placed in the arena, and can outlive the scope.
+
+TEST_F(ItemArenaTest, CreateAnyValueItem)
+{
+  std::unique_ptr<AnyValueItem> item;
+  {
+    const ItemArenaScope scope;
+    auto arena = scope.GetArena();
+
+    item = CreateAnyValueItem(CreateStructValue());
+    EXPECT_GT(arena->GetAllocationCount(), 4);
+
+    // clone of the item made in the scope goes into the same arena
+    const auto count = arena->GetAllocationCount();
+    auto clone = item->Clone();
+    EXPECT_GT(arena->GetAllocationCount(), count);
+    clone.reset();
+    EXPECT_EQ(arena->GetAllocationCount(), count);
+  }
+  EXPECT_EQ(ItemArenaScope::GetCurrentArena(), nullptr);
+
+  // item is still fully functional
+  EXPECT_EQ(item->GetChildrenCount(), 3);
+  EXPECT_EQ(CreateAnyValue(*item), CreateStructValue());
+
+  // item made outside of the scope uses the global heap and can be mixed with arena items
+  auto other = CreateAnyValueItem(CreateStructValue());
+  EXPECT_EQ(CreateAnyValue(*other), CreateAnyValue(*item));
+
+  item.reset();
+}
+
+//! Items allocated in the arena can be deleted from another thread.
+
+TEST_F(ItemArenaTest, DeleteFromAnotherThread)
+{
+  std::unique_ptr<AnyValueItem> item;
+  {
+    const ItemArenaScope scope;
+    item = CreateAnyValueItem(CreateStructValue());
+  }
+
+  std::thread thread([&item]() { item.reset(); });
+  thread.join();
+  EXPECT_EQ(item, nullptr);
+}
+
+//! Removal of most items of the subtree gives most of the arena memory back.
+
+TEST_F(ItemArenaTest, RemoveMostItems)
+{
+  const int element_count{10000};
+  const int remaining_count{10};
+
+  std::unique_ptr<AnyValueItem> item;
+  ItemArena* arena{nullptr};
+  {
+    const ItemArenaScope scope;
+    arena = scope.GetArena();
+    item = CreateAnyValueItem(CreateArrayValue(element_count));
+  }
+  const auto reserved_size = arena->GetReservedSize();
+
+  // elements are removed starting from the last one, the first ones share chunks with the array
+  for (int index = element_count - 1; index >= remaining_count; --index)
+  {
+    (void)item->TakeItem(mvvm::TagIndex::Default(index));
+  }
+  ASSERT_EQ(item->GetChildrenCount(), remaining_count);
+  EXPECT_LT(arena->GetReservedSize() * 20, reserved_size);
+
+  // remaining items are fully functional
+  EXPECT_EQ(CreateAnyValue(*item), CreateArrayValue(remaining_count));
+}
+
+}  // namespace sup::gui::test
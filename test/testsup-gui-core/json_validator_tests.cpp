@@ -0,0 +1,176 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/core/json_validator.h"
+
+#include <mvvm/test/test_helper.h>
+
+#include <gtest/gtest.h>
+#include <testutils/folder_test.h>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for JsonValidator class.
+ */
+class JsonValidatorTest : public test::FolderTest
+{
+public:
+  JsonValidatorTest() : test::FolderTest("JsonValidatorTest") {}
+
+  /**
+   * @brief Validates the string feeding it by chunks of the given size.
+   */
+  static bool IsValidByChunks(const std::string& str, std::size_t chunk_size)
+  {
+    JsonValidator validator;
+    for (std::size_t pos = 0; pos < str.size(); pos += chunk_size)
+    {
+      (void)validator.Feed(str.substr(pos, chunk_size));
+    }
+    return validator.Finish();
+  }
+};
+
+TEST_F(JsonValidatorTest, InitialState)
+{
+  const JsonValidator validator;
+  EXPECT_TRUE(validator.IsValid());
+  EXPECT_EQ(validator.GetLine(), 1);
+  EXPECT_EQ(validator.GetColumn(), 1);
+  EXPECT_EQ(validator.GetOffset(), 0);
+  EXPECT_TRUE(validator.GetDescription().empty());
+  EXPECT_TRUE(validator.GetErrorMessage().empty());
+}
+
+TEST_F(JsonValidatorTest, ValidDocuments)
+{
+  const std::vector<std::string> documents = {
+      "{}",
+      "[]",
+      " \n\t{ } \r\n",
+      "42",
+      "-0.5e+10",
+      "0",
+      "true",
+      "null",
+      R"("abc")",
+      R"({"a" : 1, "b" : [true, false, null], "c" : {"d" : "e\"\\\/\b\f\n\r\té"}})",
+      R"([{"encoding":"sup-dto/v1.0/JSON"},{"datatype":{"type":"int32"}},{"instance":42}])",
+      "[1, -2, 3.25, 4E5, 6e-7, 0.0]"};
+
+  for (const auto& document : documents)
+  {
+    EXPECT_TRUE(ValidateJSONString(document).empty()) << document;
+    EXPECT_TRUE(IsValidByChunks(document, 1)) << document;
+  }
+}
+
+TEST_F(JsonValidatorTest, InvalidDocuments)
+{
+  const std::vector<std::string> documents = {"",
+                                              "   ",
+                                              "{",
+                                              "[1, 2",
+                                              "[1, 2,]",
+                                              R"({"a" 1})",
+                                              R"({"a" : 1,})",
+                                              "{a : 1}",
+                                              "[1}",
+                                              "{}}",
+                                              "{} {}",
+                                              "01",
+                                              "-",
+                                              "1.",
+                                              "1e",
+                                              ".5",
+                                              "tru",
+                                              "nul1",
+                                              R"("abc)",
+                                              R"("a\x")",
+                                              R"("\u12g4")",
+                                              "\"a\nb\""};
+
+  for (const auto& document : documents)
+  {
+    EXPECT_FALSE(ValidateJSONString(document).empty()) << document;
+    EXPECT_FALSE(IsValidByChunks(document, 1)) << document;
+  }
+}
+
+//! Location of the error and the excerpt.
+TEST_F(JsonValidatorTest, ErrorLocation)
+{
+  JsonValidator validator;
+  EXPECT_TRUE(validator.Feed("{\n  \"a\" : 1,\n"));
+  EXPECT_FALSE(validator.Feed("  \"b\" 2\n}"));
+  EXPECT_FALSE(validator.IsValid());
+
+  EXPECT_EQ(validator.GetLine(), 3);
+  EXPECT_EQ(validator.GetColumn(), 7);
+  EXPECT_EQ(validator.GetOffset(), 19);
+  EXPECT_EQ(validator.GetDescription(), "expected ':' after object key");
+  EXPECT_EQ(validator.GetExcerpt(), "  \"b\" 2");
+  EXPECT_EQ(validator.GetErrorMessage(),
+            "line 3, column 7: expected ':' after object key, near '  \"b\" 2'");
+
+  // further content is ignored
+  EXPECT_FALSE(validator.Feed("{}"));
+  EXPECT_FALSE(validator.Finish());
+  EXPECT_EQ(validator.GetOffset(), 19);
+}
+
+//! Unfinished document is reported at its end.
+TEST_F(JsonValidatorTest, UnexpectedEnd)
+{
+  JsonValidator validator;
+  EXPECT_TRUE(validator.Feed("[1, 2"));
+  EXPECT_FALSE(validator.Finish());
+  EXPECT_EQ(validator.GetLine(), 1);
+  EXPECT_EQ(validator.GetColumn(), 6);
+  EXPECT_EQ(validator.GetDescription(), "unexpected end of document");
+  EXPECT_EQ(validator.GetExcerpt(), "[1, 2");
+}
+
+//! Error message stays short for huge single line content.
+TEST_F(JsonValidatorTest, BoundedErrorMessage)
+{
+  const std::string document = "[" + std::string(1000000, '1') + "x" + std::string(1000000, '1');
+
+  const auto message = ValidateJSONString(document);
+  EXPECT_EQ(message.find("line 1, column 1000002: expected ',' or ']'"), 0);
+  EXPECT_LT(message.size(), 200);
+}
+
+TEST_F(JsonValidatorTest, ValidateJSONFile)
+{
+  EXPECT_FALSE(ValidateJSONFile(GetFilePath("NonExisting.json")).empty());
+
+  const auto valid_path = GetFilePath("Valid.json");
+  mvvm::test::CreateTextFile(valid_path, "[" + std::string(200000, '1') + ", {\"a\" : \"b\"}]");
+  EXPECT_TRUE(ValidateJSONFile(valid_path).empty());
+
+  const auto invalid_path = GetFilePath("Invalid.json");
+  mvvm::test::CreateTextFile(invalid_path, "[\n" + std::string(200000, '1') + ",\n{\"a\" : }]");
+  EXPECT_EQ(ValidateJSONFile(invalid_path).find("line 3, column 8: expected value"), 0);
+}
+
+}  // namespace sup::gui::test
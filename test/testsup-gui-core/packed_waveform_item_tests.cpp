@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/model/packed_waveform_item.h"
+
+#include <mvvm/commands/i_command_stack.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/test/test_helper.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for PackedWaveformItem class.
+ */
+class PackedWaveformItemTest : public ::testing::Test
+{
+};
+
+TEST_F(PackedWaveformItemTest, InitialState)
+{
+  EXPECT_TRUE(mvvm::test::IsCloneImplemented<PackedWaveformItem>());
+
+  const PackedWaveformItem item;
+  EXPECT_TRUE(item.GetDataItemIdentifier().empty());
+  EXPECT_TRUE(item.GetWaveform().empty());
+  EXPECT_EQ(item.GetPointCount(), 0);
+  EXPECT_FALSE(item.HasUniformX());
+}
+
+//! Equidistant points are stored without x-values.
+TEST_F(PackedWaveformItemTest, UniformX)
+{
+  std::vector<std::pair<double, double>> points;
+  for (int index = 0; index < 100; ++index)
+  {
+    points.emplace_back(-1.0 + index * 0.5, index * index);
+  }
+
+  PackedWaveformItem item;
+  item.SetWaveform(points);
+  EXPECT_TRUE(item.HasUniformX());
+  EXPECT_EQ(item.GetPointCount(), points.size());
+  EXPECT_EQ(item.GetWaveform(), points);
+}
+
+//! Values of non-equidistant points are restored bit to bit.
+TEST_F(PackedWaveformItemTest, NonUniformX)
+{
+  const std::vector<std::pair<double, double>> points = {
+      {0.1, 1.0 / 3.0},
+      {0.2, -0.0},
+      {0.35, std::numeric_limits<double>::max()},
+      {1e-300, std::numeric_limits<double>::lowest()}};
+
+  PackedWaveformItem item;
+  item.SetWaveform(points);
+  EXPECT_FALSE(item.HasUniformX());
+  EXPECT_EQ(item.GetPointCount(), points.size());
+  EXPECT_EQ(item.GetWaveform(), points);
+
+  // single point has no step
+  item.SetWaveform({{1.0, 2.0}});
+  EXPECT_FALSE(item.HasUniformX());
+  EXPECT_EQ(item.GetWaveform(), std::vector<std::pair<double, double>>({{1.0, 2.0}}));
+
+  item.SetWaveform({});
+  EXPECT_TRUE(item.GetWaveform().empty());
+}
+
+//! Packing is a single undoable command.
+TEST_F(PackedWaveformItemTest, Undo)
+{
+  mvvm::ApplicationModel model;
+  model.SetUndoEnabled(true);
+
+  auto item = model.InsertItem<PackedWaveformItem>();
+  item->SetDataItemIdentifier("abc");
+  item->SetWaveform({{1.0, 10.0}, {2.0, 20.0}, {3.0, 30.0}});
+  EXPECT_EQ(item->GetDataItemIdentifier(), "abc");
+  EXPECT_EQ(item->GetPointCount(), 3);
+
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetPointCount(), 0);
+  EXPECT_EQ(item->GetDataItemIdentifier(), "abc");
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,189 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/model/scalar_array_buffer.h"
+
+#include <sup/gui/core/sup_gui_core_exceptions.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace sup::gui::test
+{
+
+//! Testing ScalarArrayBuffer class and conversion functions.
+
+class ScalarArrayBufferTest : public ::testing::Test
+{
+};
+
+TEST_F(ScalarArrayBufferTest, InitialState)
+{
+  const ScalarArrayBuffer buffer;
+  EXPECT_TRUE(buffer.GetElementTypeName().empty());
+  EXPECT_EQ(buffer.GetSize(), 0U);
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_TRUE(buffer.GetData().empty());
+}
+
+TEST_F(ScalarArrayBufferTest, IsSupportedElementType)
+{
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kBooleanTypeName));
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kChar8TypeName));
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kUInt8TypeName));
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kInt64TypeName));
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kFloat32TypeName));
+  EXPECT_TRUE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kFloat64TypeName));
+
+  EXPECT_FALSE(ScalarArrayBuffer::IsSupportedElementType(sup::dto::kStringTypeName));
+  EXPECT_FALSE(ScalarArrayBuffer::IsSupportedElementType("struct"));
+  EXPECT_FALSE(ScalarArrayBuffer::IsSupportedElementType(""));
+}
+
+TEST_F(ScalarArrayBufferTest, CreateWithSize)
+{
+  ScalarArrayBuffer buffer(sup::dto::kInt32TypeName, 3);
+  EXPECT_EQ(buffer.GetElementTypeName(), sup::dto::kInt32TypeName);
+  EXPECT_EQ(buffer.GetSize(), 3U);
+  EXPECT_FALSE(buffer.IsEmpty());
+
+  // elements are kept as raw bytes
+  EXPECT_EQ(buffer.GetElementSize(), 4U);
+  EXPECT_EQ(buffer.GetData(), std::string(12, '\0'));
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(mvvm::int32{0}));
+
+  EXPECT_THROW(ScalarArrayBuffer(sup::dto::kStringTypeName, 3), RuntimeException);
+}
+
+TEST_F(ScalarArrayBufferTest, CreateFromData)
+{
+  const ScalarArrayBuffer buffer(sup::dto::kInt16TypeName, std::string("\x01\x00\xff\xff", 4));
+  EXPECT_EQ(buffer.GetSize(), 2U);
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(mvvm::int16{1}));
+  EXPECT_EQ(buffer.GetElement(1), mvvm::variant_t(mvvm::int16{-1}));
+
+  // data length doesn't match the element type
+  EXPECT_THROW(ScalarArrayBuffer(sup::dto::kInt16TypeName, std::string(3, '\0')),
+               RuntimeException);
+}
+
+TEST_F(ScalarArrayBufferTest, SetElement)
+{
+  ScalarArrayBuffer buffer(sup::dto::kFloat64TypeName, 2);
+
+  buffer.SetElement(1, mvvm::variant_t(-42.5));
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(0.0));
+  EXPECT_EQ(buffer.GetElement(1), mvvm::variant_t(-42.5));
+
+  // wrong type, wrong index
+  EXPECT_THROW(buffer.SetElement(0, mvvm::variant_t(mvvm::int32{1})), RuntimeException);
+  EXPECT_THROW(buffer.SetElement(2, mvvm::variant_t(1.0)), RuntimeException);
+  EXPECT_THROW(buffer.GetElement(2), RuntimeException);
+}
+
+//! Elements should preserve extreme values of all supported types.
+TEST_F(ScalarArrayBufferTest, ExtremeValues)
+{
+  ScalarArrayBuffer buffer(sup::dto::kUInt64TypeName, 1);
+  const auto max_uint64 = std::numeric_limits<mvvm::uint64>::max();
+  buffer.SetElement(0, mvvm::variant_t(max_uint64));
+  EXPECT_EQ(buffer.GetData(), std::string(8, '\xff'));
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(max_uint64));
+
+  ScalarArrayBuffer int8_buffer(sup::dto::kInt8TypeName, 1);
+  const auto min_int8 = std::numeric_limits<mvvm::int8>::min();
+  int8_buffer.SetElement(0, mvvm::variant_t(min_int8));
+  EXPECT_EQ(int8_buffer.GetData(), "\x80");
+  EXPECT_EQ(int8_buffer.GetElement(0), mvvm::variant_t(min_int8));
+
+  ScalarArrayBuffer bool_buffer(sup::dto::kBooleanTypeName, 2);
+  bool_buffer.SetElement(1, mvvm::variant_t(true));
+  EXPECT_EQ(bool_buffer.GetElement(0), mvvm::variant_t(false));
+  EXPECT_EQ(bool_buffer.GetElement(1), mvvm::variant_t(true));
+
+  ScalarArrayBuffer float_buffer(sup::dto::kFloat32TypeName, 1);
+  const auto min_float = std::numeric_limits<mvvm::float32>::lowest();
+  float_buffer.SetElement(0, mvvm::variant_t(min_float));
+  EXPECT_EQ(float_buffer.GetElement(0), mvvm::variant_t(min_float));
+}
+
+//! Buffer is stored in the model as base64 text.
+TEST_F(ScalarArrayBufferTest, TextRoundTrip)
+{
+  EXPECT_EQ(EncodeBase64(""), "");
+  EXPECT_EQ(EncodeBase64("f"), "Zg==");
+  EXPECT_EQ(EncodeBase64("fo"), "Zm8=");
+  EXPECT_EQ(EncodeBase64("foo"), "Zm9v");
+  EXPECT_EQ(DecodeBase64("Zg=="), "f");
+  EXPECT_EQ(DecodeBase64("Zm8="), "fo");
+  EXPECT_EQ(DecodeBase64("Zm9v"), "foo");
+
+  ScalarArrayBuffer buffer(sup::dto::kFloat64TypeName, 5);
+  buffer.SetElement(0, mvvm::variant_t(-1.5));
+  buffer.SetElement(4, mvvm::variant_t(std::numeric_limits<double>::max()));
+
+  const auto text = buffer.ToText();
+  EXPECT_EQ(text.size(), 56U);  // 40 bytes
+  EXPECT_EQ(ScalarArrayBuffer::FromText(sup::dto::kFloat64TypeName, text), buffer);
+
+  // invalid length, invalid characters, length not matching element type
+  EXPECT_THROW(DecodeBase64("Zm9"), RuntimeException);
+  EXPECT_THROW(DecodeBase64("Zm9*"), RuntimeException);
+  EXPECT_THROW(ScalarArrayBuffer::FromText(sup::dto::kInt16TypeName, "Zm9v"), RuntimeException);
+}
+
+TEST_F(ScalarArrayBufferTest, CreateScalarArrayBuffer)
+{
+  const sup::dto::AnyValue array = sup::dto::ArrayValue(
+      {{sup::dto::UnsignedInteger16Type, 1}, {sup::dto::UnsignedInteger16Type, 65535}},
+      "my_array_t");
+  EXPECT_TRUE(IsPackableArray(array));
+
+  const auto buffer = CreateScalarArrayBuffer(array);
+  EXPECT_EQ(buffer.GetElementTypeName(), sup::dto::kUInt16TypeName);
+  EXPECT_EQ(buffer.GetSize(), 2U);
+  EXPECT_EQ(buffer.GetElement(0), mvvm::variant_t(mvvm::uint16{1}));
+  EXPECT_EQ(buffer.GetElement(1), mvvm::variant_t(mvvm::uint16{65535}));
+
+  // round trip
+  EXPECT_EQ(CreateAnyValueFromBuffer(buffer, "my_array_t"), array);
+
+  // scalars can't be packed
+  EXPECT_THROW(CreateScalarArrayBuffer(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 1}),
+               RuntimeException);
+}
+
+TEST_F(ScalarArrayBufferTest, IsPackableArray)
+{
+  EXPECT_FALSE(IsPackableArray(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 1}));
+  EXPECT_FALSE(IsPackableArray(
+      sup::dto::ArrayValue({{sup::dto::StringType, "a"}, {sup::dto::StringType, "b"}})));
+
+  const sup::dto::AnyValue struct_value = {{"value", {sup::dto::SignedInteger32Type, 1}}};
+  EXPECT_FALSE(IsPackableArray(sup::dto::ArrayValue({struct_value, struct_value})));
+
+  EXPECT_TRUE(IsPackableArray(sup::dto::ArrayValue({{sup::dto::BooleanType, true}})));
+}
+
+}  // namespace sup::gui::test
@@ -20,6 +20,7 @@
 
 #include "sup/gui/model/scalar_conversion_utils.h"
 
+#include <sup/gui/core/sup_gui_core_exceptions.h>
 #include <sup/gui/model/anyvalue_conversion_utils.h>
 
 #include <mvvm/core/variant.h>
@@ -283,4 +284,98 @@ TEST_F(ScalarConversionUtilsTest, GetVariantFromScalarTypeName)
   EXPECT_TRUE(IsValidVariantForName<std::string>(sup::dto::kStringTypeName));
 }
 
+//! Scalar type names deduced from the variant.
+TEST_F(ScalarConversionUtilsTest, GetScalarTypeName)
+{
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t()), std::string());
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t(true)), sup::dto::kBooleanTypeName);
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t(mvvm::int8{0})), sup::dto::kInt8TypeName);
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t(mvvm::uint64{0})), sup::dto::kUInt64TypeName);
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t(mvvm::float64{0})), sup::dto::kFloat64TypeName);
+  EXPECT_EQ(GetScalarTypeName(mvvm::variant_t(std::string())), sup::dto::kStringTypeName);
+
+  // every scalar type name has its own variant alternative
+  for (const auto& name : GetScalarTypeNames())
+  {
+    EXPECT_EQ(GetScalarTypeName(GetVariantFromScalarTypeName(name)), name);
+  }
+}
+
+//! Detection of arrays which can be converted in bulk.
+TEST_F(ScalarConversionUtilsTest, IsNumericScalarArray)
+{
+  EXPECT_FALSE(IsNumericScalarArray(sup::dto::AnyValue()));
+  EXPECT_FALSE(IsNumericScalarArray(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}));
+  EXPECT_FALSE(IsNumericScalarArray(sup::dto::AnyValue(0, sup::dto::SignedInteger32Type)));
+  EXPECT_FALSE(IsNumericScalarArray(sup::dto::ArrayValue({{sup::dto::StringType, "abc"}})));
+
+  const sup::dto::AnyValue struct_value = {{{"field", {sup::dto::SignedInteger32Type, 42}}}};
+  EXPECT_FALSE(IsNumericScalarArray(sup::dto::ArrayValue({struct_value})));
+
+  EXPECT_TRUE(IsNumericScalarArray(sup::dto::ArrayValue({{sup::dto::SignedInteger32Type, 42}})));
+  EXPECT_TRUE(IsNumericScalarArray(sup::dto::ArrayValue({{sup::dto::BooleanType, true}})));
+  EXPECT_TRUE(IsNumericScalarArray(sup::dto::AnyValue(3, sup::dto::Float64Type)));
+}
+
+//! Bulk conversion of array elements to variants.
+TEST_F(ScalarConversionUtilsTest, GetVariantsFromScalarArray)
+{
+  EXPECT_THROW(GetVariantsFromScalarArray(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}),
+               RuntimeException);
+  EXPECT_THROW(GetVariantsFromScalarArray(sup::dto::ArrayValue({{sup::dto::StringType, "abc"}})),
+               RuntimeException);
+
+  const auto array = sup::dto::ArrayValue({{sup::dto::UnsignedInteger16Type, 1}, 2, 3});
+  const std::vector<mvvm::variant_t> expected = {mvvm::uint16{1}, mvvm::uint16{2},
+                                                 mvvm::uint16{3}};
+  EXPECT_EQ(GetVariantsFromScalarArray(array), expected);
+
+  // bulk conversion gives the same result as element-wise conversion for every numeric type
+  for (const auto& name : GetScalarTypeNames())
+  {
+    const auto type_code = GetScalarTypeCode(name);
+    if (type_code == sup::dto::TypeCode::String)
+    {
+      continue;
+    }
+
+    const sup::dto::AnyValue array_value(4, sup::dto::AnyType(type_code));
+    const auto variants = GetVariantsFromScalarArray(array_value);
+    ASSERT_EQ(variants.size(), 4);
+    for (std::size_t index = 0; index < variants.size(); ++index)
+    {
+      EXPECT_EQ(variants[index], GetVariantFromScalar(array_value[index]));
+    }
+  }
+}
+
+//! Bulk conversion of variants to array.
+TEST_F(ScalarConversionUtilsTest, GetScalarArrayFromVariants)
+{
+  EXPECT_THROW(GetScalarArrayFromVariants({}, "array_name"), RuntimeException);
+  EXPECT_THROW(GetScalarArrayFromVariants({std::string("abc")}, "array_name"), RuntimeException);
+  EXPECT_THROW(GetScalarArrayFromVariants({mvvm::int32{1}, mvvm::float64{2.0}}, "array_name"),
+               RuntimeException);
+
+  const auto expected =
+      sup::dto::ArrayValue({{sup::dto::Float32Type, 1.5f}, 2.5f, -3.5f}, "array_name");
+  const std::vector<mvvm::variant_t> variants = {mvvm::float32{1.5f}, mvvm::float32{2.5f},
+                                                 mvvm::float32{-3.5f}};
+  EXPECT_EQ(GetScalarArrayFromVariants(variants, "array_name"), expected);
+
+  // round trip for every numeric type
+  for (const auto& name : GetScalarTypeNames())
+  {
+    const auto type_code = GetScalarTypeCode(name);
+    if (type_code == sup::dto::TypeCode::String)
+    {
+      continue;
+    }
+
+    const sup::dto::AnyValue array_value(3, sup::dto::AnyType(type_code), "array_name");
+    EXPECT_EQ(GetScalarArrayFromVariants(GetVariantsFromScalarArray(array_value), "array_name"),
+              array_value);
+  }
+}
+
 }  // namespace sup::gui::test
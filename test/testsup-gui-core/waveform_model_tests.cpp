@@ -42,6 +42,8 @@ TEST_F(WaveformModelTest, InitialState)
 
   ASSERT_NE(model.GetViewPort(), nullptr);
   ASSERT_NE(model.GetDataContainer(), nullptr);
+  ASSERT_NE(model.GetPackedDataContainer(), nullptr);
+  EXPECT_NE(model.GetPackedDataContainer(), model.GetDataContainer());
 
   EXPECT_EQ(model.GetViewPort()->GetLineSeriesCount(), 0);
   EXPECT_EQ(model.GetDataContainer()->GetSize(), 0);
@@ -53,6 +55,7 @@ TEST_F(WaveformModelTest, InitialState)
 
   EXPECT_EQ(model.GetViewPort()->GetLineSeriesCount(), 0);
   EXPECT_EQ(model.GetDataContainer()->GetSize(), 0);
+  EXPECT_EQ(model.GetPackedDataContainer()->GetSize(), 0);
 }
 
 }  // namespace sup::gui::test
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/views/anyvalueeditor/anyvalue_editor_widget.h"
+
+#include <sup/gui/model/anyvalue_item.h>
+#include <sup/gui/model/anyvalue_utils.h>
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/container_item.h>
+#include <mvvm/test/test_helper.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+#include <testutils/folder_test.h>
+
+#include <QTest>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Tests for AnyValueEditorWidget class.
+ */
+class AnyValueEditorWidgetTest : public test::FolderTest
+{
+public:
+  AnyValueEditorWidgetTest() : test::FolderTest("AnyValueEditorWidgetTest")
+  {
+    m_container = m_model.InsertItem<mvvm::ContainerItem>();
+  }
+
+  mvvm::ApplicationModel m_model;
+  mvvm::ContainerItem* m_container{nullptr};
+};
+
+//! Import of JSON file with a large array of float64 creates a single packed item.
+TEST_F(AnyValueEditorWidgetTest, ImportLargeFloatArray)
+{
+  const std::size_t size{1000000};
+  sup::dto::AnyValue anyvalue(size, sup::dto::Float64Type);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    anyvalue[index] = static_cast<double>(index) * 0.5;
+  }
+  const auto file_path = GetFilePath("ImportLargeFloatArray.json");
+  mvvm::test::CreateTextFile(file_path, AnyValueToJSONString(anyvalue));
+
+  AnyValueEditorWidget widget;
+  widget.SetAnyValueItemContainer(m_container);
+  widget.ImportAnyValueFromFile(QString::fromStdString(file_path));
+
+  EXPECT_TRUE(QTest::qWaitFor([&widget]() { return widget.GetTopItem() != nullptr; }, 60000));
+
+  auto packed_item = dynamic_cast<AnyValueScalarArrayItem*>(widget.GetTopItem());
+  ASSERT_NE(packed_item, nullptr);
+  EXPECT_EQ(m_container->GetSize(), 1);
+  EXPECT_EQ(packed_item->GetElementCount(), size);
+  EXPECT_EQ(packed_item->GetChildrenCount(), 0);
+}
+
+}  // namespace sup::gui::test
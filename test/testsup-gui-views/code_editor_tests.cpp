@@ -0,0 +1,134 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/views/codeeditor/code_editor.h"
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QTextBlock>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing CodeEditor class.
+ */
+class CodeEditorTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Creates multi-line text with the given number of lines.
+   */
+  static QString CreateText(int line_count)
+  {
+    QString result;
+    for (int index = 0; index < line_count; ++index)
+    {
+      result.append(QString("  \"field%1\": %1,\n").arg(index));
+    }
+    return result;
+  }
+};
+
+TEST_F(CodeEditorTest, InitialState)
+{
+  CodeEditor editor;
+  EXPECT_FALSE(editor.IsLargeDocumentMode());
+  EXPECT_FALSE(editor.IsLoading());
+  EXPECT_TRUE(editor.toPlainText().isEmpty());
+}
+
+TEST_F(CodeEditorTest, SetText)
+{
+  CodeEditor editor;
+  QSignalSpy spy_loaded(&editor, &CodeEditor::TextLoaded);
+
+  const auto text = CreateText(10);
+  editor.SetText(text, "JSON");
+
+  EXPECT_FALSE(editor.IsLargeDocumentMode());
+  EXPECT_FALSE(editor.IsLoading());
+  EXPECT_EQ(editor.toPlainText(), text);
+  EXPECT_EQ(spy_loaded.count(), 1);
+}
+
+//! Updating text should replace only changed lines and keep the rest of the document intact.
+TEST_F(CodeEditorTest, UpdateText)
+{
+  CodeEditor editor;
+  editor.SetText("a\nb\nc\nd\n");
+
+  const auto first_block = editor.document()->firstBlock();
+  const auto last_block = editor.document()->findBlockByNumber(3);
+
+  editor.UpdateText("a\nb\nX\nd\n");
+  EXPECT_EQ(editor.toPlainText(), QString("a\nb\nX\nd\n"));
+
+  // unchanged blocks are preserved
+  EXPECT_EQ(editor.document()->firstBlock(), first_block);
+  EXPECT_EQ(editor.document()->findBlockByNumber(3), last_block);
+
+  editor.UpdateText("a\nb\nX\nY\nZ\nd\n");
+  EXPECT_EQ(editor.toPlainText(), QString("a\nb\nX\nY\nZ\nd\n"));
+
+  editor.UpdateText("d\n");
+  EXPECT_EQ(editor.toPlainText(), QString("d\n"));
+
+  editor.UpdateText("");
+  EXPECT_TRUE(editor.toPlainText().isEmpty());
+
+  editor.UpdateText("a");
+  EXPECT_EQ(editor.toPlainText(), QString("a"));
+}
+
+//! Large document is loaded in chunks.
+TEST_F(CodeEditorTest, LargeDocument)
+{
+  CodeEditor editor;
+  QSignalSpy spy_loaded(&editor, &CodeEditor::TextLoaded);
+
+  const auto text = CreateText(100000);
+  editor.SetLargeDocumentThreshold(1024);
+  editor.SetText(text, "JSON");
+
+  EXPECT_TRUE(editor.IsLargeDocumentMode());
+  EXPECT_TRUE(editor.IsLoading());
+  EXPECT_LT(editor.toPlainText().size(), text.size());
+
+  EXPECT_TRUE(spy_loaded.wait(10000));
+  EXPECT_FALSE(editor.IsLoading());
+  EXPECT_EQ(editor.toPlainText(), text);
+
+  // partial update of the loaded document
+  auto new_text = text;
+  new_text.replace("\"field500\"", "\"renamed\"");
+  editor.UpdateText(new_text);
+  EXPECT_FALSE(editor.IsLoading());
+  EXPECT_TRUE(editor.IsLargeDocumentMode());
+  EXPECT_EQ(editor.toPlainText(), new_text);
+
+  // small document switches large mode off
+  editor.UpdateText("abc");
+  EXPECT_FALSE(editor.IsLargeDocumentMode());
+  EXPECT_EQ(editor.toPlainText(), QString("abc"));
+}
+
+}  // namespace sup::gui::test
@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP and PSPS
+ *
+ * Description   : Common libraries and tools for Operation Application GUIs
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sup/gui/views/codeeditor/text_diff_helper.h"
+
+#include <gtest/gtest.h>
+
+#include <QTextDocument>
+
+namespace sup::gui::test
+{
+
+/**
+ * @brief Testing helper functions from text_diff_helper.h
+ */
+class TextDiffHelperTest : public ::testing::Test
+{
+public:
+  using hunks_t = std::vector<LineDiffHunk>;
+};
+
+TEST_F(TextDiffHelperTest, ComputeLineDiff)
+{
+  EXPECT_TRUE(ComputeLineDiff({}, {}).empty());
+  EXPECT_TRUE(ComputeLineDiff({"a", "b"}, {"a", "b"}).empty());
+
+  EXPECT_EQ(ComputeLineDiff({}, {"a"}), hunks_t({{0, 0, 0, 1}}));
+  EXPECT_EQ(ComputeLineDiff({"a"}, {}), hunks_t({{0, 1, 0, 0}}));
+
+  // replacement in the middle
+  EXPECT_EQ(ComputeLineDiff({"a", "b", "c"}, {"a", "X", "c"}), hunks_t({{1, 1, 1, 1}}));
+
+  // insertion at the end
+  EXPECT_EQ(ComputeLineDiff({"a", "b"}, {"a", "b", "c"}), hunks_t({{2, 0, 2, 1}}));
+
+  // two separate changes
+  EXPECT_EQ(ComputeLineDiff({"a", "b", "c", "d", "e"}, {"a", "X", "c", "d", "Y", "Z"}),
+            hunks_t({{1, 1, 1, 1}, {4, 1, 4, 2}}));
+
+  // deletion and insertion
+  EXPECT_EQ(ComputeLineDiff({"a", "b", "c", "d"}, {"b", "c", "X", "d"}),
+            hunks_t({{0, 1, 0, 0}, {3, 0, 2, 1}}));
+}
+
+//! When the edit distance is exceeded, the whole changed region is reported as a single hunk.
+TEST_F(TextDiffHelperTest, ComputeLineDiffWithLimit)
+{
+  const QStringList old_lines({"a", "b", "c", "d", "e", "f"});
+  const QStringList new_lines({"a", "X", "c", "Y", "e", "f"});
+
+  EXPECT_EQ(ComputeLineDiff(old_lines, new_lines), hunks_t({{1, 1, 1, 1}, {3, 1, 3, 1}}));
+  EXPECT_EQ(ComputeLineDiff(old_lines, new_lines, 2), hunks_t({{1, 3, 1, 3}}));
+}
+
+TEST_F(TextDiffHelperTest, ApplyLineDiff)
+{
+  QTextDocument document;
+  document.setPlainText("{\n  \"a\": 1,\n  \"b\": 2\n}\n");
+  const int undo_steps = document.availableUndoSteps();
+
+  EXPECT_EQ(ApplyLineDiff(document, document.toPlainText()), 0);
+
+  const QString text1("{\n  \"a\": 42,\n  \"b\": 2,\n  \"c\": 3\n}\n");
+  EXPECT_EQ(ApplyLineDiff(document, text1), 1);
+  EXPECT_EQ(document.toPlainText(), text1);
+
+  // all changes are undone at once
+  EXPECT_EQ(document.availableUndoSteps(), undo_steps + 1);
+
+  const QString text2("[\n  \"a\": 42,\n  \"c\": 3\n]");
+  EXPECT_EQ(ApplyLineDiff(document, text2), 3);
+  EXPECT_EQ(document.toPlainText(), text2);
+  EXPECT_EQ(document.availableUndoSteps(), undo_steps + 2);
+
+  document.undo();
+  EXPECT_EQ(document.toPlainText(), text1);
+
+  EXPECT_EQ(ApplyLineDiff(document, ""), 1);
+  EXPECT_TRUE(document.toPlainText().isEmpty());
+}
+
+}  // namespace sup::gui::test